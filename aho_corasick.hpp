@@ -0,0 +1,250 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_AHO_CORASICK_HPP
+#define DMITIGR_STR_AHO_CORASICK_HPP
+
+#include "exceptions.hpp"
+#include "simd.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace dmitigr::str {
+
+/// The occurrence of the pattern.
+struct Pattern_match final {
+  /// The position of the occurrence.
+  std::size_t position{static_cast<std::size_t>(-1)};
+
+  /// The index of the pattern.
+  std::size_t pattern{};
+
+  /// @returns `true` if the occurrence is found.
+  explicit operator bool() const noexcept
+  {
+    return position != static_cast<std::size_t>(-1);
+  }
+};
+
+/**
+ * @brief The Aho-Corasick automaton for searching many patterns at once.
+ *
+ * @details The automaton is compiled to the deterministic one, so each byte
+ * of the text is processed by the single table lookup regardless of the
+ * number of patterns. The bytes which are not used by the patterns are mapped
+ * to the single class to keep the table small. If the patterns start with at
+ * most three distinct bytes, the text is skipped to the next such byte by the
+ * vectorized search while the automaton is in the initial state.
+ */
+class Aho_corasick final {
+public:
+  /// The size type.
+  using size_type = std::size_t;
+
+  /**
+   * @brief Constructs the automaton of `patterns`.
+   *
+   * @par Requires
+   * The elements of `patterns` are convertible to `std::string_view`.
+   */
+  template<class Range>
+  explicit Aho_corasick(const Range& patterns)
+  {
+    // Compute the byte classes.
+    bool is_used[256]{};
+    unsigned used_count{};
+    for (const auto& p : patterns) {
+      for (const auto ch : std::string_view{p}) {
+        auto& used = is_used[static_cast<unsigned char>(ch)];
+        used_count += !used;
+        used = true;
+      }
+    }
+    class_count_ = used_count < 256; // the class of unused bytes
+    for (unsigned b{}; b < 256; ++b) {
+      if (is_used[b])
+        classes_[b] = static_cast<std::uint8_t>(class_count_++);
+    }
+
+    // Build the trie.
+    constexpr auto none = std::numeric_limits<std::uint32_t>::max();
+    next_.assign(class_count_, none);
+    outputs_.push_back(0);
+    for (const auto& p : patterns) {
+      const std::string_view pattern{p};
+      std::uint32_t state{};
+      for (const auto ch : pattern) {
+        const auto index = state * class_count_
+          + classes_[static_cast<unsigned char>(ch)];
+        if (next_[index] == none) {
+          if (outputs_.size() == none)
+            throw Exception{"cannot build Aho-Corasick automaton: too many "
+              "states"};
+          next_[index] = static_cast<std::uint32_t>(outputs_.size());
+          outputs_.push_back(0);
+          next_.resize(next_.size() + class_count_, none);
+        }
+        state = next_[index];
+      }
+      if (!outputs_[state])
+        outputs_[state] = static_cast<std::uint32_t>(sizes_.size() + 1);
+      sizes_.push_back(pattern.size());
+    }
+
+    // Compute the failure transitions in the breadth-first order, and
+    // replace the missing transitions with the transitions of failure states.
+    std::vector<std::uint32_t> failures(outputs_.size());
+    std::vector<std::uint32_t> queue;
+    for (std::size_t c{}; c < class_count_; ++c) {
+      auto& next = next_[c];
+      if (next == none)
+        next = 0;
+      else
+        queue.push_back(next);
+    }
+    for (std::size_t i{}; i < queue.size(); ++i) {
+      const auto state = queue[i];
+      const auto failure = failures[state];
+      if (!outputs_[state])
+        outputs_[state] = outputs_[failure];
+      for (std::size_t c{}; c < class_count_; ++c) {
+        auto& next = next_[state * class_count_ + c];
+        const auto failure_next = next_[failure * class_count_ + c];
+        if (next == none)
+          next = failure_next;
+        else {
+          failures[next] = failure_next;
+          queue.push_back(next);
+        }
+      }
+    }
+
+    // Collect the first bytes of the patterns.
+    for (unsigned b{}; b < 256; ++b) {
+      if (next_[classes_[b]] && first_byte_count_ <= 3) {
+        if (first_byte_count_ < 3)
+          first_bytes_[first_byte_count_] = static_cast<char>(b);
+        ++first_byte_count_;
+      }
+    }
+  }
+
+  /// @returns The number of patterns.
+  size_type size() const noexcept
+  {
+    return sizes_.size();
+  }
+
+  /// @returns The size of the pattern at `index`.
+  size_type pattern_size(const size_type index) const noexcept
+  {
+    return sizes_[index];
+  }
+
+  /**
+   * @returns The occurrence in `text` starting at or after `pos` which ends
+   * first. If several patterns end at the same position, the longest one is
+   * reported.
+   */
+  Pattern_match find(const std::string_view text,
+    const size_type pos = 0) const noexcept
+  {
+    if (outputs_[0])
+      return {pos, outputs_[0] - 1}; // the empty pattern
+
+    const auto* const data = text.data();
+    const auto size = text.size();
+    std::uint32_t state{};
+    for (auto i = pos; i < size; ++i) {
+      if (!state && first_byte_count_ <= 3) {
+        i = skip(data, i, size);
+        if (i == size)
+          break;
+      }
+      state = next_[state * class_count_
+        + classes_[static_cast<unsigned char>(data[i])]];
+      if (const auto output = outputs_[state]) {
+        const auto pattern = output - 1;
+        return {i + 1 - sizes_[pattern], pattern};
+      }
+    }
+    return {};
+  }
+
+  /// @returns `true` if `text` contains any of the patterns.
+  bool is_match(const std::string_view text) const noexcept
+  {
+    return static_cast<bool>(find(text));
+  }
+
+private:
+  std::uint8_t classes_[256]{};
+  std::size_t class_count_{};
+  std::vector<std::uint32_t> next_;
+  std::vector<std::uint32_t> outputs_; // pattern index + 1, or 0
+  std::vector<std::size_t> sizes_;
+  char first_bytes_[3]{};
+  unsigned first_byte_count_{};
+
+  /// @returns The position of the next first byte of patterns.
+  size_type skip(const char* const data, const size_type pos,
+    const size_type size) const noexcept
+  {
+    return static_cast<size_type>(detail::find_any_byte(data + pos, data + size,
+        first_bytes_, first_byte_count_) - data);
+  }
+};
+
+namespace detail {
+
+/**
+ * @returns The bounds `[begin, end)` of the first line of `text` which starts
+ * at or after `pos` and contains any of the patterns of `matcher`, or the pair
+ * of `std::string_view::npos` and `text.size()` if there is no such a line.
+ *
+ * @par Requires
+ * `pos` is the beginning of the line, and the patterns of `matcher` don't
+ * contain `delimiter`.
+ */
+inline std::pair<std::size_t, std::size_t>
+find_matching_line(const Aho_corasick& matcher, const std::string_view text,
+  const std::size_t pos, const char delimiter) noexcept
+{
+  const auto match = matcher.find(text, pos);
+  if (!match)
+    return {std::string_view::npos, text.size()};
+
+  std::size_t begin{pos};
+  if (match.position > pos) {
+    const auto prev = text.rfind(delimiter, match.position - 1);
+    if (prev != std::string_view::npos && prev >= pos)
+      begin = prev + 1;
+  }
+  const auto end = std::min(text.find(delimiter, match.position), text.size());
+  return {begin, end};
+}
+
+} // namespace detail
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_AHO_CORASICK_HPP
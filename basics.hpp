@@ -35,6 +35,15 @@ enum class Byte_format {
   hex
 };
 
+/// Denotes a text encoding.
+enum class Encoding {
+  utf8 = 1,
+  utf16le,
+  utf16be,
+  utf32le,
+  utf32be
+};
+
 } // namespace str
 
 template<> struct Is_bitmask_enum<str::Trim> : std::true_type {};
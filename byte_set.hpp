@@ -0,0 +1,81 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_BYTE_SET_HPP
+#define DMITIGR_STR_BYTE_SET_HPP
+
+#include <cstdint>
+#include <string_view>
+
+namespace dmitigr::str {
+
+/// The set of bytes represented by the bitmap of 256 bits.
+class Byte_set final {
+public:
+  /// Constructs the empty set.
+  constexpr Byte_set() noexcept = default;
+
+  /// Constructs the set of `bytes`.
+  constexpr explicit Byte_set(const std::string_view bytes) noexcept
+  {
+    for (const auto ch : bytes)
+      insert(static_cast<unsigned char>(ch));
+  }
+
+  /// Inserts `ch` to the set.
+  constexpr void insert(const unsigned char ch) noexcept
+  {
+    bits_[ch >> 6] |= std::uint64_t{1} << (ch & 63);
+  }
+
+  /// Removes `ch` from the set.
+  constexpr void erase(const unsigned char ch) noexcept
+  {
+    bits_[ch >> 6] &= ~(std::uint64_t{1} << (ch & 63));
+  }
+
+  /// @returns `true` if the set contains `ch`.
+  constexpr bool contains(const unsigned char ch) const noexcept
+  {
+    return bits_[ch >> 6] >> (ch & 63) & 1;
+  }
+
+  /// @returns The set of bytes which are not contained in this set.
+  constexpr Byte_set complement() const noexcept
+  {
+    Byte_set result;
+    for (int i{}; i < 4; ++i)
+      result.bits_[i] = ~bits_[i];
+    return result;
+  }
+
+  /// @returns `true` if the set contains any of the bytes of `other` set.
+  constexpr bool intersects(const Byte_set& other) const noexcept
+  {
+    for (int i{}; i < 4; ++i) {
+      if (bits_[i] & other.bits_[i])
+        return true;
+    }
+    return false;
+  }
+
+private:
+  std::uint64_t bits_[4]{};
+};
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_BYTE_SET_HPP
@@ -25,17 +25,46 @@ dmitigr_libs_set_library_info(str 0 0 0 "Standard string extensions")
 # ------------------------------------------------------------------------------
 
 set(dmitigr_str_headers
+  aho_corasick.hpp
   basics.hpp
+  byte_set.hpp
   c_str.h
   c_str.hpp
+  compare.hpp
+  copy_format.hpp
+  dedup.hpp
+  diff.hpp
   exceptions.hpp
+  external_sort.hpp
+  fields.hpp
+  fixed_width.hpp
+  fm_index.hpp
+  front_coding.hpp
+  glob.hpp
+  grep.hpp
+  json.hpp
   line.hpp
+  mapped_file.hpp
   numeric.hpp
+  parallel.hpp
   predicate.hpp
+  radix_tree.hpp
   sequence.hpp
+  simd.hpp
+  sort.hpp
+  sql.hpp
   stream.hpp
+  string_table.hpp
   substr.hpp
+  suffix_array.hpp
   transform.hpp
+  trigram_index.hpp
+  ucd_case.hpp
+  ucd_normalization.hpp
+  url.hpp
+  utf8.hpp
+  utf8_case.hpp
+  utf8_normalization.hpp
   walker.hpp
   )
 
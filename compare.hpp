@@ -0,0 +1,184 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_COMPARE_HPP
+#define DMITIGR_STR_COMPARE_HPP
+
+#include "simd.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace dmitigr::str {
+
+// -----------------------------------------------------------------------------
+// Natural order
+// -----------------------------------------------------------------------------
+
+namespace detail {
+
+constexpr bool is_ascii_digit(const char ch) noexcept
+{
+  return static_cast<unsigned char>(ch - '0') < 10;
+}
+
+/// @returns The byte `ch` to compare according to `is_case_insensitive`.
+constexpr unsigned char natural_byte(const char ch,
+  const bool is_case_insensitive) noexcept
+{
+  return static_cast<unsigned char>(is_case_insensitive ?
+    ascii_to_case<false>(ch) : ch);
+}
+
+} // namespace detail
+
+/**
+ * @returns The negative value, zero or the positive value if `lhs` is less
+ * than, equal to or greater than `rhs` respectively in the natural order.
+ *
+ * @details The runs of ASCII digits are compared by their numeric values
+ * (of any length), so "v9" is less than "v10". The runs which differ only in
+ * leading zeros, such as "01" and "1", are equal. The rest of bytes are
+ * compared as unsigned, with ASCII case folded if `is_case_insensitive`.
+ *
+ * @remarks Doesn't allocate.
+ */
+inline int natural_compare(const std::string_view lhs, const std::string_view rhs,
+  const bool is_case_insensitive = false) noexcept
+{
+  const char* l = lhs.data();
+  const char* r = rhs.data();
+  const char* const le = l + lhs.size();
+  const char* const re = r + rhs.size();
+
+  // Skip the common prefix, but not the digits of the run it may end inside.
+  {
+    const auto size = std::min(lhs.size(), rhs.size());
+    auto n = is_case_insensitive ? detail::ascii_icase_mismatch(l, r, size) :
+      detail::mismatch(l, r, size);
+    while (n && detail::is_ascii_digit(l[n - 1]))
+      --n;
+    l += n;
+    r += n;
+  }
+
+  while (l != le && r != re) {
+    if (detail::is_ascii_digit(*l) && detail::is_ascii_digit(*r)) {
+      for (; l != le && *l == '0'; ++l);
+      for (; r != re && *r == '0'; ++r);
+      const char* const lb = l;
+      const char* const rb = r;
+      for (; l != le && detail::is_ascii_digit(*l); ++l);
+      for (; r != re && detail::is_ascii_digit(*r); ++r);
+      const auto lsize = l - lb;
+      const auto rsize = r - rb;
+      if (lsize != rsize)
+        return lsize < rsize ? -1 : 1;
+      else if (const int c = std::memcmp(lb, rb, static_cast<std::size_t>(lsize)))
+        return c < 0 ? -1 : 1;
+    } else {
+      const auto lc = detail::natural_byte(*l, is_case_insensitive);
+      const auto rc = detail::natural_byte(*r, is_case_insensitive);
+      if (lc != rc)
+        return lc < rc ? -1 : 1;
+      ++l;
+      ++r;
+    }
+  }
+  return (l != le) - (r != re);
+}
+
+/**
+ * @brief The natural order less function object.
+ *
+ * @see natural_compare().
+ */
+struct Natural_less final {
+  /// The indicator of ASCII case insensitive comparison.
+  bool is_case_insensitive{};
+
+  bool operator()(const std::string_view lhs,
+    const std::string_view rhs) const noexcept
+  {
+    return natural_compare(lhs, rhs, is_case_insensitive) < 0;
+  }
+};
+
+/**
+ * @brief Appends the natural order sort key of `str` to `result`.
+ *
+ * @details The keys of two strings compare bytewise (as unsigned) exactly as
+ * the strings compare by natural_compare() with the same `is_case_insensitive`.
+ * Each run of digits is encoded as the byte '0', followed by the number of
+ * significant digits (one byte if less than 255, or 0xFF and eight bytes in
+ * big-endian otherwise), followed by the significant digits.
+ */
+inline void append_natural_sort_key(std::string& result,
+  const std::string_view str, const bool is_case_insensitive = false)
+{
+  result.reserve(result.size() + str.size() + str.size() / 2);
+  const char* p = str.data();
+  const char* const e = p + str.size();
+  while (p != e) {
+    if (detail::is_ascii_digit(*p)) {
+      for (; p != e && *p == '0'; ++p);
+      const char* const b = p;
+      for (; p != e && detail::is_ascii_digit(*p); ++p);
+      const auto size = static_cast<std::size_t>(p - b);
+      result.push_back('0');
+      if (size < 0xFF)
+        result.push_back(static_cast<char>(size));
+      else {
+        result.push_back(static_cast<char>(0xFF));
+        for (int shift = 56; shift >= 0; shift -= 8)
+          result.push_back(static_cast<char>(
+              static_cast<unsigned long long>(size) >> shift & 0xFF));
+      }
+      result.append(b, size);
+    } else {
+      const char* const b = p;
+      for (; p != e && !detail::is_ascii_digit(*p); ++p);
+      const auto offset = result.size();
+      result.append(b, p);
+      if (is_case_insensitive) {
+        char* const out = result.data() + offset;
+        const char* const a = detail::ascii_to_case<false>(b, p, out);
+        for (auto i = a - b; i < p - b; ++i)
+          out[i] = detail::ascii_to_case<false>(out[i]);
+      }
+    }
+  }
+}
+
+/**
+ * @returns The natural order sort key of `str`.
+ *
+ * @see append_natural_sort_key().
+ */
+inline std::string natural_sort_key(const std::string_view str,
+  const bool is_case_insensitive = false)
+{
+  std::string result;
+  append_natural_sort_key(result, str, is_case_insensitive);
+  return result;
+}
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_COMPARE_HPP
@@ -0,0 +1,341 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_COPY_FORMAT_HPP
+#define DMITIGR_STR_COPY_FORMAT_HPP
+
+#include "exceptions.hpp"
+#include "numeric.hpp"
+#include "simd.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace dmitigr::str {
+
+// -----------------------------------------------------------------------------
+// PostgreSQL COPY text format
+// -----------------------------------------------------------------------------
+
+/// @returns The maximum size of the result of copy_text_escape() of `size` bytes.
+constexpr std::size_t copy_text_escaped_max_size(const std::size_t size) noexcept
+{
+  return size * 2;
+}
+
+/**
+ * @brief Writes `str` escaped as the field of PostgreSQL COPY text format with
+ * `delimiter` to `out`.
+ *
+ * @details The backslash, `delimiter` and the characters `\b`, `\f`, `\n`,
+ * `\r`, `\t` and `\v` are escaped. The bytes to escape are found by the
+ * vectorized search, and the clean runs are copied at once.
+ *
+ * @returns The number of bytes written.
+ *
+ * @par Requires
+ * `out` has space for `copy_text_escaped_max_size(str.size())` bytes.
+ */
+inline std::size_t copy_text_escape(const std::string_view str,
+  char* const out, const char delimiter = '\t') noexcept
+{
+  const char specials[]{'\\', delimiter};
+  const char* p{str.data()};
+  const char* const e{p + str.size()};
+  char* o{out};
+  while (true) {
+    const auto* const s = detail::find_control_or_any_byte(p, e, specials, 2);
+    if (s != p) {
+      std::memcpy(o, p, static_cast<std::size_t>(s - p));
+      o += s - p;
+    }
+    if (s == e)
+      break;
+
+    switch (*s) {
+    case '\\': *o++ = '\\'; *o++ = '\\'; break;
+    case '\b': *o++ = '\\'; *o++ = 'b'; break;
+    case '\f': *o++ = '\\'; *o++ = 'f'; break;
+    case '\n': *o++ = '\\'; *o++ = 'n'; break;
+    case '\r': *o++ = '\\'; *o++ = 'r'; break;
+    case '\t': *o++ = '\\'; *o++ = 't'; break;
+    case '\v': *o++ = '\\'; *o++ = 'v'; break;
+    default:
+      if (*s == delimiter)
+        *o++ = '\\';
+      *o++ = *s; // other control character
+    }
+    p = s + 1;
+  }
+  return static_cast<std::size_t>(o - out);
+}
+
+/**
+ * @brief Writes the field `str` of PostgreSQL COPY text format with the escape
+ * sequences replaced by the characters they denote to `out`.
+ *
+ * @details Recognizes `\b`, `\f`, `\n`, `\r`, `\t`, `\v`, the octal `\ddd` and
+ * the hexadecimal `\xhh` sequences, and the backslash followed by any other
+ * character denotes that character. Note, that the field `\N` denotes NULL by
+ * default and must be checked before unescaping.
+ *
+ * @returns The number of bytes written.
+ *
+ * @par Requires
+ * `out` has space for `str.size()` bytes.
+ *
+ * @throws Exception if `str` ends with the single backslash.
+ */
+inline std::size_t copy_text_unescape(const std::string_view str,
+  char* const out)
+{
+  if (str.empty())
+    return 0;
+
+  const char* p{str.data()};
+  const char* const e{p + str.size()};
+  char* o{out};
+  while (true) {
+    const auto* s = static_cast<const char*>(
+      std::memchr(p, '\\', static_cast<std::size_t>(e - p)));
+    if (!s)
+      s = e;
+    if (s != p) {
+      std::memcpy(o, p, static_cast<std::size_t>(s - p));
+      o += s - p;
+    }
+    if (s == e)
+      break;
+    else if (e - s < 2)
+      throw Exception{"cannot unescape COPY text field which ends with "
+        "backslash"};
+
+    p = s + 2;
+    switch (const auto ch = s[1]) {
+    case 'b': *o++ = '\b'; break;
+    case 'f': *o++ = '\f'; break;
+    case 'n': *o++ = '\n'; break;
+    case 'r': *o++ = '\r'; break;
+    case 't': *o++ = '\t'; break;
+    case 'v': *o++ = '\v'; break;
+    default:
+      *o++ = detail::unescape_c_byte(ch, p, e);
+    }
+  }
+  return static_cast<std::size_t>(o - out);
+}
+
+// -----------------------------------------------------------------------------
+// PostgreSQL COPY CSV format
+// -----------------------------------------------------------------------------
+
+/// @returns The maximum size of the result of copy_csv_escape() of `size` bytes.
+constexpr std::size_t copy_csv_escaped_max_size(const std::size_t size) noexcept
+{
+  return size * 2 + 2;
+}
+
+/**
+ * @brief Writes `str` as the field of PostgreSQL COPY CSV format with
+ * `delimiter` and `quote` to `out`.
+ *
+ * @details The field is quoted (and the quotes are doubled) only if it's
+ * empty (to distinguish it from NULL), equals to `\.`, or contains
+ * `delimiter`, `quote`, `\r` or `\n`. The check is performed by the
+ * vectorized search.
+ *
+ * @returns The number of bytes written.
+ *
+ * @par Requires
+ * `out` has space for `copy_csv_escaped_max_size(str.size())` bytes.
+ */
+inline std::size_t copy_csv_escape(const std::string_view str,
+  char* const out, const char delimiter = ',', const char quote = '"') noexcept
+{
+  const char specials[]{delimiter, quote};
+  const char* const b{str.data()};
+  const char* const e{b + str.size()};
+  const char* s{b};
+  while (true) {
+    s = detail::find_control_or_any_byte(s, e, specials, 2);
+    if (s == e || *s == '\r' || *s == '\n' || *s == delimiter || *s == quote)
+      break;
+    ++s; // other control character
+  }
+  if (s == e && !str.empty() && str != "\\.") {
+    std::memcpy(out, b, str.size());
+    return str.size();
+  }
+
+  char* o{out};
+  *o++ = quote;
+  const char* p{b};
+  while (true) {
+    const auto* q = p != e ? static_cast<const char*>(
+      std::memchr(p, quote, static_cast<std::size_t>(e - p))) : e;
+    if (!q)
+      q = e;
+    if (q != p) {
+      std::memcpy(o, p, static_cast<std::size_t>(q - p));
+      o += q - p;
+    }
+    if (q == e)
+      break;
+    *o++ = quote;
+    *o++ = quote;
+    p = q + 1;
+  }
+  *o++ = quote;
+  return static_cast<std::size_t>(o - out);
+}
+
+/**
+ * @brief Writes the field `str` of PostgreSQL COPY CSV format without the
+ * enclosing quotes and with the doubled quotes replaced by the single ones
+ * to `out`.
+ *
+ * @details The field which is not started with `quote` is written as is.
+ * Note, that the unquoted empty field denotes NULL by default.
+ *
+ * @returns The number of bytes written.
+ *
+ * @par Requires
+ * `out` has space for `str.size()` bytes.
+ *
+ * @throws Exception if the quoted `str` is not terminated by `quote` or
+ * contains the single quote.
+ */
+inline std::size_t copy_csv_unescape(const std::string_view str,
+  char* const out, const char quote = '"')
+{
+  if (str.empty() || str.front() != quote) {
+    if (!str.empty())
+      std::memcpy(out, str.data(), str.size());
+    return str.size();
+  }
+
+  const auto invalid = []
+  {
+    throw Exception{"cannot unescape invalid quoted COPY CSV field"};
+  };
+  const char* p{str.data() + 1};
+  const char* const e{str.data() + str.size()};
+  char* o{out};
+  while (true) {
+    const auto* const q = static_cast<const char*>(
+      std::memchr(p, quote, static_cast<std::size_t>(e - p)));
+    if (!q)
+      invalid();
+    std::memcpy(o, p, static_cast<std::size_t>(q - p));
+    o += q - p;
+    if (q + 1 == e)
+      break;
+    else if (q[1] != quote)
+      invalid();
+    *o++ = quote;
+    p = q + 2;
+  }
+  return static_cast<std::size_t>(o - out);
+}
+
+// -----------------------------------------------------------------------------
+// PostgreSQL COPY text rows
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief The builder of rows of PostgreSQL COPY text format.
+ *
+ * @details The fields are escaped directly into the buffer, which can be
+ * cleared and reused without reallocation. The fields without the characters
+ * to escape are appended at once.
+ */
+class Copy_row_builder final {
+public:
+  /**
+   * @brief Constructs the builder of rows with fields separated by `delimiter`
+   * and the NULL denoted by `null`.
+   */
+  explicit Copy_row_builder(const char delimiter = '\t',
+    const std::string_view null = "\\N")
+    : null_{null}
+    , delimiter_{delimiter}
+  {}
+
+  /// Appends the field `value` to the current row.
+  Copy_row_builder& append(const std::string_view value)
+  {
+    start_field();
+    const char specials[]{'\\', delimiter_};
+    const auto* const e = value.data() + value.size();
+    if (detail::find_control_or_any_byte(value.data(), e, specials, 2) == e)
+      buffer_.append(value);
+    else {
+      const auto size = buffer_.size();
+      buffer_.resize(size + copy_text_escaped_max_size(value.size()));
+      buffer_.resize(size + copy_text_escape(value, buffer_.data() + size,
+          delimiter_));
+    }
+    return *this;
+  }
+
+  /// Appends NULL to the current row.
+  Copy_row_builder& append_null()
+  {
+    start_field();
+    buffer_.append(null_);
+    return *this;
+  }
+
+  /// Terminates the current row.
+  void end_row()
+  {
+    buffer_.push_back('\n');
+    is_row_started_ = false;
+  }
+
+  /// @returns The rows.
+  const std::string& data() const noexcept
+  {
+    return buffer_;
+  }
+
+  /// Removes the rows without releasing the memory.
+  void clear() noexcept
+  {
+    buffer_.clear();
+    is_row_started_ = false;
+  }
+
+private:
+  std::string buffer_;
+  std::string null_;
+  char delimiter_{};
+  bool is_row_started_{};
+
+  void start_field()
+  {
+    if (is_row_started_)
+      buffer_.push_back(delimiter_);
+    else
+      is_row_started_ = true;
+  }
+};
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_COPY_FORMAT_HPP
@@ -0,0 +1,257 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_DEDUP_HPP
+#define DMITIGR_STR_DEDUP_HPP
+
+#include "parallel.hpp"
+#include "string_table.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace dmitigr::str {
+
+// -----------------------------------------------------------------------------
+// Removing duplicates
+// -----------------------------------------------------------------------------
+
+namespace detail {
+
+/// The number of strings which are deduplicated by the single thread.
+constexpr std::size_t dedup_parallel_threshold{1 << 14};
+
+/// @returns The hash of `str` with well mixed bits.
+inline std::uint64_t dedup_hash(const std::string_view str) noexcept
+{
+  // The finalizer of MurmurHash3.
+  std::uint64_t result{std::hash<std::string_view>{}(str)};
+  result ^= result >> 33;
+  result *= 0xFF51AFD7ED558CCD;
+  result ^= result >> 33;
+  result *= 0xC4CEB9FE1A85EC53;
+  result ^= result >> 33;
+  return result;
+}
+
+/**
+ * @brief Sets `keep[index(j)]` to `1` for the first occurrences and to `0`
+ * for the duplicates of strings `key(index(j))`, where `j` is in `[0, n)`.
+ *
+ * @par Requires
+ * `index(j)` is increasing.
+ */
+template<class Index, class Key>
+void mark_first_occurrences(const std::size_t n, const Index& index,
+  const std::uint64_t* const hashes, const Key& key, char* const keep)
+{
+  constexpr auto empty = static_cast<std::size_t>(-1);
+  std::size_t capacity{16};
+  while (capacity < 2 * n)
+    capacity *= 2;
+  const auto mask = capacity - 1;
+  std::vector<std::size_t> slots(capacity, empty);
+  for (std::size_t j{}; j < n; ++j) {
+    const auto i = index(j);
+    const auto hash = hashes[i];
+    for (auto pos = static_cast<std::size_t>(hash) & mask;;
+         pos = (pos + 1) & mask) {
+      const auto slot = slots[pos];
+      if (slot == empty) {
+        slots[pos] = i;
+        keep[i] = 1;
+        break;
+      } else if (hashes[slot] == hash && key(slot) == key(i)) {
+        keep[i] = 0;
+        break;
+      }
+    }
+  }
+}
+
+/// @returns The marks of the first occurrences of `n` strings `key(i)`.
+template<class Key>
+std::vector<char> first_occurrences(const std::size_t n, const Key& key)
+{
+  std::vector<std::uint64_t> hashes(n);
+  for (std::size_t i{}; i < n; ++i)
+    hashes[i] = dedup_hash(key(i));
+  std::vector<char> result(n);
+  mark_first_occurrences(n, [](const std::size_t j) noexcept {return j;},
+    hashes.data(), key, result.data());
+  return result;
+}
+
+/**
+ * @returns The marks of the first occurrences of `n` strings `key(i)`.
+ *
+ * @details The hashes are computed in parallel, then the strings are
+ * distributed over `thread_count` shards by hash (in the original order) and
+ * the shards are processed in parallel.
+ */
+template<class Key>
+std::vector<char> first_occurrences_parallel(const std::size_t n,
+  const Key& key, unsigned thread_count)
+{
+  thread_count = thread_count_or_default(thread_count);
+  if (thread_count == 1 || n < dedup_parallel_threshold)
+    return first_occurrences(n, key);
+
+  const auto shard = [thread_count](const std::uint64_t hash) noexcept
+  {
+    return static_cast<std::size_t>((hash >> 32) % thread_count);
+  };
+
+  // Compute hashes and count the strings of each shard in each part.
+  std::vector<std::uint64_t> hashes(n);
+  std::vector<std::size_t> counts(thread_count * thread_count);
+  run_parallel(thread_count, [&](const unsigned t)
+  {
+    const auto [b, e] = part_bounds(n, thread_count, t);
+    auto* const part_counts = counts.data() + t * thread_count;
+    for (auto i = b; i < e; ++i) {
+      hashes[i] = dedup_hash(key(i));
+      ++part_counts[shard(hashes[i])];
+    }
+  });
+
+  // Compute the offsets of parts in the shards.
+  std::vector<std::size_t> offsets(thread_count * thread_count);
+  std::vector<std::size_t> shard_offsets(thread_count + 1);
+  for (std::size_t s{}, offset{}; s < thread_count; ++s) {
+    shard_offsets[s] = offset;
+    for (std::size_t t{}; t < thread_count; ++t) {
+      offsets[t * thread_count + s] = offset;
+      offset += counts[t * thread_count + s];
+    }
+  }
+  shard_offsets[thread_count] = n;
+
+  // Distribute the indices over shards, then process the shards.
+  std::vector<std::size_t> indices(n);
+  run_parallel(thread_count, [&](const unsigned t)
+  {
+    const auto [b, e] = part_bounds(n, thread_count, t);
+    auto* const part_offsets = offsets.data() + t * thread_count;
+    for (auto i = b; i < e; ++i)
+      indices[part_offsets[shard(hashes[i])]++] = i;
+  });
+  std::vector<char> result(n);
+  run_parallel(thread_count, [&](const unsigned s)
+  {
+    const auto* const shard_indices = indices.data() + shard_offsets[s];
+    mark_first_occurrences(shard_offsets[s + 1] - shard_offsets[s],
+      [shard_indices](const std::size_t j) noexcept {return shard_indices[j];},
+      hashes.data(), key, result.data());
+  });
+  return result;
+}
+
+/**
+ * @brief Removes the elements of `container` which are not marked by `keep`
+ * preserving the order of the rest.
+ *
+ * @returns The number of removed elements.
+ */
+template<class Container>
+std::size_t remove_unmarked(Container& container, const std::vector<char>& keep)
+{
+  const auto size = container.size();
+  std::size_t j{};
+  for (std::size_t i{}; i < size; ++i) {
+    if (keep[i]) {
+      if (i != j)
+        container[j] = std::move(container[i]);
+      ++j;
+    }
+  }
+  container.erase(container.begin() + static_cast<std::ptrdiff_t>(j),
+    container.end());
+  return size - j;
+}
+
+} // namespace detail
+
+/**
+ * @brief Removes the duplicates of `strings` in place.
+ *
+ * @details The first occurrences are preserved in the original order. The
+ * strings are found by the hash table, so no sorting is required.
+ *
+ * @returns The number of removed duplicates.
+ */
+inline std::size_t remove_duplicates(std::vector<std::string>& strings)
+{
+  return detail::remove_unmarked(strings, detail::first_occurrences(
+      strings.size(), [&strings](const std::size_t i) noexcept
+      {
+        return std::string_view{strings[i]};
+      }));
+}
+
+/**
+ * @overload
+ *
+ * @details Only the entries of `table` are removed.
+ *
+ * @see String_table::compact().
+ */
+inline std::size_t remove_duplicates(String_table& table)
+{
+  return detail::remove_unmarked(table.entries(), detail::first_occurrences(
+      table.size(), [&table](const std::size_t i) noexcept {return table[i];}));
+}
+
+/**
+ * @brief Removes the duplicates of `strings` in place by using up to
+ * `thread_count` threads, or `std::thread::hardware_concurrency()` threads if
+ * `thread_count == 0`.
+ *
+ * @details The strings are sharded by hash, so each shard is processed by
+ * one thread without any synchronization. The small inputs are processed by
+ * the calling thread only.
+ *
+ * @returns The number of removed duplicates.
+ *
+ * @see remove_duplicates().
+ */
+inline std::size_t remove_duplicates_parallel(std::vector<std::string>& strings,
+  const unsigned thread_count = 0)
+{
+  return detail::remove_unmarked(strings, detail::first_occurrences_parallel(
+      strings.size(), [&strings](const std::size_t i) noexcept
+      {
+        return std::string_view{strings[i]};
+      }, thread_count));
+}
+
+/// @overload
+inline std::size_t remove_duplicates_parallel(String_table& table,
+  const unsigned thread_count = 0)
+{
+  return detail::remove_unmarked(table.entries(),
+    detail::first_occurrences_parallel(table.size(),
+      [&table](const std::size_t i) noexcept {return table[i];}, thread_count));
+}
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_DEDUP_HPP
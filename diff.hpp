@@ -0,0 +1,387 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_DIFF_HPP
+#define DMITIGR_STR_DIFF_HPP
+
+#include "dedup.hpp"
+#include "numeric.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace dmitigr::str {
+
+// -----------------------------------------------------------------------------
+// Diff
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief The change which replaces `old_count` lines of the old sequence
+ * starting at `old_offset` with `new_count` lines of the new sequence
+ * starting at `new_offset`.
+ */
+struct Diff_change final {
+  std::size_t old_offset{};
+  std::size_t old_count{};
+  std::size_t new_offset{};
+  std::size_t new_count{};
+};
+
+namespace detail {
+
+/**
+ * @brief Replaces each line of `old_lines` and `new_lines` with the integer,
+ * which is equal for equal lines only.
+ */
+template<class Range>
+void intern_lines(const Range& old_lines, const Range& new_lines,
+  std::vector<std::uint32_t>& old_ids, std::vector<std::uint32_t>& new_ids)
+{
+  const auto old_size = static_cast<std::size_t>(std::size(old_lines));
+  const auto new_size = static_cast<std::size_t>(std::size(new_lines));
+  std::size_t capacity{16};
+  while (capacity < 2 * (old_size + new_size))
+    capacity *= 2;
+  const auto mask = capacity - 1;
+
+  struct Slot final {
+    std::uint64_t hash{};
+    std::string_view line;
+    std::uint32_t id{};
+    bool is_used{};
+  };
+  std::vector<Slot> slots(capacity);
+  std::uint32_t next_id{};
+  const auto intern = [&](const std::string_view line)
+  {
+    const auto hash = dedup_hash(line);
+    for (auto pos = static_cast<std::size_t>(hash) & mask;;
+         pos = (pos + 1) & mask) {
+      auto& slot = slots[pos];
+      if (!slot.is_used) {
+        slot = {hash, line, next_id, true};
+        return next_id++;
+      } else if (slot.hash == hash && slot.line == line)
+        return slot.id;
+    }
+  };
+
+  old_ids.resize(old_size);
+  new_ids.resize(new_size);
+  auto i = std::begin(old_lines);
+  for (std::size_t j{}; j < old_size; ++j, ++i)
+    old_ids[j] = intern(std::string_view{*i});
+  i = std::begin(new_lines);
+  for (std::size_t j{}; j < new_size; ++j, ++i)
+    new_ids[j] = intern(std::string_view{*i});
+}
+
+/**
+ * @brief The Myers O(ND) difference algorithm with linear space refinement.
+ *
+ * @details The middle snake of the shortest edit script is found by the
+ * simultaneous forward and backward searches, then both halves are processed
+ * recursively. The found edits are marked in `is_deleted` and `is_inserted`.
+ */
+class Myers_diff final {
+public:
+  Myers_diff(const std::vector<std::uint32_t>& a,
+    const std::vector<std::uint32_t>& b)
+    : is_deleted(a.size())
+    , is_inserted(b.size())
+    , a_{a}
+    , b_{b}
+  {
+    const auto max = static_cast<std::ptrdiff_t>((a.size() + b.size() + 1) / 2);
+    offset_ = max + 1;
+    forward_.resize(static_cast<std::size_t>(2 * max + 3));
+    backward_.resize(forward_.size());
+    compare(0, static_cast<std::ptrdiff_t>(a.size()),
+      0, static_cast<std::ptrdiff_t>(b.size()));
+  }
+
+  /// The marks of deleted lines of the old sequence.
+  std::vector<char> is_deleted;
+
+  /// The marks of inserted lines of the new sequence.
+  std::vector<char> is_inserted;
+
+private:
+  using Index = std::ptrdiff_t;
+
+  const std::vector<std::uint32_t>& a_;
+  const std::vector<std::uint32_t>& b_;
+
+  struct Snake final {
+    Index x0{}, y0{}, x1{}, y1{};
+  };
+
+  std::vector<Index> forward_;
+  std::vector<Index> backward_;
+  Index offset_{};
+
+  Index& vf(const Index k) noexcept
+  {
+    return forward_[static_cast<std::size_t>(k + offset_)];
+  }
+
+  Index& vb(const Index c) noexcept
+  {
+    return backward_[static_cast<std::size_t>(c + offset_)];
+  }
+
+  bool is_equal(const Index x, const Index y) const noexcept
+  {
+    return a_[static_cast<std::size_t>(x)] == b_[static_cast<std::size_t>(y)];
+  }
+
+  void compare(Index left, Index right, Index top, Index bottom)
+  {
+    for (; left < right && top < bottom && is_equal(left, top); ++left, ++top);
+    for (; left < right && top < bottom && is_equal(right - 1, bottom - 1);
+         --right, --bottom);
+
+    if (left == right) {
+      for (; top < bottom; ++top)
+        is_inserted[static_cast<std::size_t>(top)] = 1;
+    } else if (top == bottom) {
+      for (; left < right; ++left)
+        is_deleted[static_cast<std::size_t>(left)] = 1;
+    } else {
+      const auto s = middle_snake(left, right, top, bottom);
+      compare(left, s.x0, top, s.y0);
+      compare(s.x0, s.x1, s.y0, s.y1);
+      compare(s.x1, right, s.y1, bottom);
+    }
+  }
+
+  Snake middle_snake(const Index left, const Index right, const Index top,
+    const Index bottom)
+  {
+    const auto width = right - left;
+    const auto height = bottom - top;
+    const auto delta = width - height;
+    const bool is_odd = delta & 1;
+    const auto max = (width + height + 1) / 2;
+    vf(1) = left;
+    vb(1) = bottom;
+    for (Index d{}; d <= max; ++d) {
+      // Forward search.
+      for (auto k = d; k >= -d; k -= 2) {
+        const auto c = k - delta;
+        Index px, x;
+        if (k == -d || (k != d && vf(k - 1) < vf(k + 1)))
+          px = x = vf(k + 1);
+        else {
+          px = vf(k - 1);
+          x = px + 1;
+        }
+        auto y = top + (x - left) - k;
+        const auto py = !d || x != px ? y : y - 1;
+        for (; x < right && y < bottom && is_equal(x, y); ++x, ++y);
+        vf(k) = x;
+        if (is_odd && c >= -(d - 1) && c <= d - 1 && y >= vb(c))
+          return {px, py, x, y};
+      }
+
+      // Backward search.
+      for (auto c = d; c >= -d; c -= 2) {
+        const auto k = c + delta;
+        Index py, y;
+        if (c == -d || (c != d && vb(c - 1) > vb(c + 1)))
+          py = y = vb(c + 1);
+        else {
+          py = vb(c - 1);
+          y = py - 1;
+        }
+        auto x = left + (y - top) + k;
+        const auto px = !d || y != py ? x : x + 1;
+        for (; x > left && y > top && is_equal(x - 1, y - 1); --x, --y);
+        vb(c) = y;
+        if (!is_odd && k >= -d && k <= d && x <= vf(k))
+          return {x, y, px, py};
+      }
+    }
+    return {left, top, right, bottom}; // unreachable
+  }
+};
+
+/// Appends the range of unified diff hunk header to `result`.
+inline void append_hunk_range(std::string& result, const std::size_t offset,
+  const std::size_t count)
+{
+  result.append(to_string(count ? offset + 1 : offset));
+  if (count != 1) {
+    result.push_back(',');
+    result.append(to_string(count));
+  }
+}
+
+} // namespace detail
+
+/**
+ * @returns The changes which turn `old_lines` into `new_lines` in the order
+ * of offsets.
+ *
+ * @details The lines are interned into integers first, and the common prefix
+ * and suffix are skipped, so the cost depends mostly on the number of
+ * differences (D) rather than on the number of lines: O((N + M) * D) time
+ * and O(N + M) space.
+ *
+ * @par Requires
+ * The elements of `Range` are convertible to `std::string_view`, and are
+ * either lvalues or views of the strings which outlive the call.
+ */
+template<class Range>
+std::vector<Diff_change> diff(const Range& old_lines, const Range& new_lines)
+{
+  using Reference = decltype(*std::begin(old_lines));
+  static_assert(std::is_lvalue_reference_v<Reference>
+    || std::is_same_v<std::decay_t<Reference>, std::string_view>,
+    "the lines of range must outlive the call of diff()");
+
+  std::vector<std::uint32_t> a, b;
+  detail::intern_lines(old_lines, new_lines, a, b);
+  const detail::Myers_diff d{a, b};
+
+  std::vector<Diff_change> result;
+  std::size_t i{}, j{};
+  while (i < a.size() || j < b.size()) {
+    if ((i < a.size() && d.is_deleted[i]) || (j < b.size() && d.is_inserted[j])) {
+      Diff_change change{i, 0, j, 0};
+      for (; i < a.size() && d.is_deleted[i]; ++i)
+        ++change.old_count;
+      for (; j < b.size() && d.is_inserted[j]; ++j)
+        ++change.new_count;
+      result.push_back(change);
+    } else {
+      ++i;
+      ++j;
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Calls `f(hunk)` for each hunk of the unified diff of `old_lines` and
+ * `new_lines` with `context` lines of context around the changes.
+ *
+ * @details Each hunk starts with the header of form "@@ -l,s +l,s @@",
+ * followed by the lines prefixed with ' ', '-' or '+', each terminated with
+ * '\n'. The `hunk` is valid only during the call.
+ *
+ * @par Requires
+ * The requirements of diff().
+ *
+ * @see diff().
+ */
+template<class Range, typename F>
+void unified_diff(const Range& old_lines, const Range& new_lines, const F& f,
+  const std::size_t context = 3)
+{
+  using Reference = decltype(*std::begin(old_lines));
+  static_assert(std::is_lvalue_reference_v<Reference>
+    || std::is_same_v<std::decay_t<Reference>, std::string_view>,
+    "the lines of range must outlive the call of unified_diff()");
+
+  // Collect the lines at once, since `Range` might be not random access.
+  const auto views = [](const Range& lines)
+  {
+    std::vector<std::string_view> result;
+    result.reserve(static_cast<std::size_t>(std::size(lines)));
+    for (const auto& line : lines)
+      result.emplace_back(line);
+    return result;
+  };
+  const auto old_views = views(old_lines);
+  const auto new_views = views(new_lines);
+  const auto changes = diff(old_views, new_views);
+  const auto old_size = old_views.size();
+
+  std::string hunk;
+  for (std::size_t c{}; c < changes.size();) {
+    // Group the changes which are separated by at most 2*context lines.
+    auto e = c + 1;
+    for (; e < changes.size(); ++e) {
+      const auto& prev = changes[e - 1];
+      if (changes[e].old_offset - (prev.old_offset + prev.old_count) > 2*context)
+        break;
+    }
+
+    const auto& first = changes[c];
+    const auto& last = changes[e - 1];
+    const auto lead = std::min(context, first.old_offset);
+    const auto old_begin = first.old_offset - lead;
+    const auto new_begin = first.new_offset - lead;
+    const auto old_end = std::min(last.old_offset + last.old_count + context,
+      old_size);
+    const auto new_end = last.new_offset + last.new_count
+      + (old_end - (last.old_offset + last.old_count));
+
+    hunk.assign("@@ -");
+    detail::append_hunk_range(hunk, old_begin, old_end - old_begin);
+    hunk.append(" +");
+    detail::append_hunk_range(hunk, new_begin, new_end - new_begin);
+    hunk.append(" @@\n");
+    const auto append = [&hunk](const char prefix, const std::string_view str)
+    {
+      hunk.push_back(prefix);
+      hunk.append(str);
+      hunk.push_back('\n');
+    };
+    auto i = old_begin;
+    for (auto k = c; k < e; ++k) {
+      const auto& change = changes[k];
+      for (; i < change.old_offset; ++i)
+        append(' ', old_views[i]);
+      for (std::size_t n{}; n < change.old_count; ++n, ++i)
+        append('-', old_views[i]);
+      for (std::size_t n{}; n < change.new_count; ++n)
+        append('+', new_views[change.new_offset + n]);
+    }
+    for (; i < old_end; ++i)
+      append(' ', old_views[i]);
+
+    f(std::string_view{hunk});
+    c = e;
+  }
+}
+
+/**
+ * @brief Appends the unified diff of `old_lines` and `new_lines` to `result`.
+ *
+ * @see unified_diff().
+ */
+template<class Range>
+void unified_diff(std::string& result, const Range& old_lines,
+  const Range& new_lines, const std::size_t context = 3)
+{
+  unified_diff(old_lines, new_lines, [&result](const std::string_view hunk)
+  {
+    result.append(hunk);
+  }, context);
+}
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_DIFF_HPP
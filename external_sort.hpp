@@ -0,0 +1,482 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_EXTERNAL_SORT_HPP
+#define DMITIGR_STR_EXTERNAL_SORT_HPP
+
+#include "../base/fsx.hpp"
+#include "exceptions.hpp"
+#include "sort.hpp"
+#include "string_table.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace dmitigr::str {
+
+// -----------------------------------------------------------------------------
+// Line I/O
+// -----------------------------------------------------------------------------
+
+namespace detail {
+
+/// The reader of lines which reads the file by large blocks.
+class Line_reader final {
+public:
+  /// Opens the file at `path`.
+  Line_reader(const std::filesystem::path& path, const std::size_t buffer_size,
+    const char delimiter)
+    : input_{path, std::ios_base::in | std::ios_base::binary}
+    , buffer_(std::max<std::size_t>(buffer_size, 1), '\0')
+    , delimiter_{delimiter}
+  {
+    if (!input_)
+      throw Exception{"cannot open file \"" + path.generic_string() + "\""};
+  }
+
+  /**
+   * @brief Reads the next line without the delimiter into `line`.
+   *
+   * @details The `line` refers to the internal buffer and is valid until
+   * the next call.
+   *
+   * @returns `false` if there are no more lines.
+   */
+  bool next(std::string_view& line)
+  {
+    while (true) {
+      const auto size = end_ - begin_;
+      if (const auto* const d = static_cast<const char*>(
+            std::memchr(buffer_.data() + begin_, delimiter_, size))) {
+        const auto pos = static_cast<std::size_t>(d - buffer_.data());
+        line = {buffer_.data() + begin_, pos - begin_};
+        begin_ = pos + 1;
+        return true;
+      } else if (is_eof_) {
+        if (!size)
+          return false;
+        line = {buffer_.data() + begin_, size};
+        begin_ = end_;
+        return true;
+      }
+
+      // Move the incomplete line to the beginning and read the next block.
+      std::memmove(buffer_.data(), buffer_.data() + begin_, size);
+      begin_ = 0;
+      end_ = size;
+      if (end_ == buffer_.size())
+        buffer_.resize(2 * buffer_.size());
+      input_.read(buffer_.data() + end_,
+        static_cast<std::streamsize>(buffer_.size() - end_));
+      const auto count = static_cast<std::size_t>(input_.gcount());
+      if (input_.bad())
+        throw Exception{"cannot read lines"};
+      end_ += count;
+      is_eof_ = !count;
+    }
+  }
+
+private:
+  std::ifstream input_;
+  std::string buffer_;
+  std::size_t begin_{};
+  std::size_t end_{};
+  char delimiter_{};
+  bool is_eof_{};
+};
+
+/// The writer of lines which writes the file by large blocks.
+class Buffered_writer final {
+public:
+  /// Creates or truncates the file at `path`.
+  Buffered_writer(const std::filesystem::path& path,
+    const std::size_t buffer_size, const char delimiter)
+    : output_{path, std::ios_base::out | std::ios_base::binary
+        | std::ios_base::trunc}
+    , buffer_size_{std::max<std::size_t>(buffer_size, 1)}
+    , delimiter_{delimiter}
+  {
+    if (!output_)
+      throw Exception{"cannot open file \"" + path.generic_string() + "\""};
+    buffer_.reserve(buffer_size_);
+  }
+
+  /// Writes `line` followed by the delimiter.
+  void write(const std::string_view line)
+  {
+    if (buffer_.size() + line.size() + 1 > buffer_size_)
+      flush();
+    if (line.size() >= buffer_size_) {
+      write(line.data(), line.size());
+      write(&delimiter_, 1);
+    } else {
+      buffer_.append(line);
+      buffer_.push_back(delimiter_);
+    }
+  }
+
+  /// Writes the buffered data to the file.
+  void flush()
+  {
+    write(buffer_.data(), buffer_.size());
+    buffer_.clear();
+    if (!output_.flush())
+      throw Exception{"cannot write lines"};
+  }
+
+private:
+  std::ofstream output_;
+  std::string buffer_;
+  std::size_t buffer_size_{};
+  char delimiter_{};
+
+  void write(const char* const data, const std::size_t size)
+  {
+    if (!output_.write(data, static_cast<std::streamsize>(size)))
+      throw Exception{"cannot write lines"};
+  }
+};
+
+// -----------------------------------------------------------------------------
+// Loser tree
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief The tournament tree of losers for the k-way merge.
+ *
+ * @details Each internal node stores the loser of the match between the
+ * winners of its subtrees, so replacing the winner requires one comparison
+ * per level only.
+ */
+class Loser_tree final {
+public:
+  /**
+   * @brief Plays the tournament of `k` sources.
+   *
+   * @param less The function of form `less(i, j)` which returns `true` if the
+   * current item of source `i` must be merged before the one of source `j`.
+   */
+  template<class Less>
+  Loser_tree(const std::size_t k, const Less& less)
+    : tree_(std::max<std::size_t>(k, 1))
+  {
+    if (k <= 1)
+      return;
+
+    std::vector<std::size_t> winners(2 * k);
+    for (std::size_t i{}; i < k; ++i)
+      winners[k + i] = i;
+    for (auto n = k - 1; n; --n) {
+      auto w = winners[2*n];
+      auto l = winners[2*n + 1];
+      if (less(l, w))
+        std::swap(w, l);
+      winners[n] = w;
+      tree_[n] = l;
+    }
+    tree_[0] = winners[1];
+  }
+
+  /// @returns The index of the winning source.
+  std::size_t winner() const noexcept
+  {
+    return tree_[0];
+  }
+
+  /// Replays the tournament after the current item of winner() is changed.
+  template<class Less>
+  void replay(const Less& less)
+  {
+    const auto k = tree_.size();
+    auto w = tree_[0];
+    for (auto n = (k + w) / 2; n; n /= 2) {
+      if (less(tree_[n], w))
+        std::swap(tree_[n], w);
+    }
+    tree_[0] = w;
+  }
+
+private:
+  std::vector<std::size_t> tree_;
+};
+
+// -----------------------------------------------------------------------------
+// Temporary files
+// -----------------------------------------------------------------------------
+
+/// The set of temporary files which are removed on destruction.
+class Temporary_files final {
+public:
+  explicit Temporary_files(std::filesystem::path directory)
+    : directory_{directory.empty() ?
+        std::filesystem::temp_directory_path() : std::move(directory)}
+    , prefix_{"dmitigr_str_sort_" + std::to_string(std::random_device{}())
+        + "_"}
+  {}
+
+  ~Temporary_files()
+  {
+    for (const auto& path : paths_) {
+      std::error_code ec;
+      std::filesystem::remove(path, ec);
+    }
+  }
+
+  Temporary_files(const Temporary_files&) = delete;
+  Temporary_files& operator=(const Temporary_files&) = delete;
+
+  /// @returns The path of the new temporary file.
+  std::filesystem::path make()
+  {
+    paths_.push_back(directory_ / (prefix_ + std::to_string(counter_++)));
+    return paths_.back();
+  }
+
+  /// Removes the file at `path`.
+  void remove(const std::filesystem::path& path)
+  {
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+    paths_.erase(std::find(paths_.begin(), paths_.end(), path));
+  }
+
+private:
+  std::filesystem::path directory_;
+  std::string prefix_;
+  std::size_t counter_{};
+  std::vector<std::filesystem::path> paths_;
+};
+
+/// The maximum number of runs which are merged at once.
+constexpr std::size_t external_sort_max_fan_in{128};
+
+/// The minimum size of the buffer of run.
+constexpr std::size_t external_sort_min_buffer_size{4096};
+
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+// External sort
+// -----------------------------------------------------------------------------
+
+/// The options of external_sort().
+struct External_sort_options final {
+  /// The approximate limit of memory used for sorting.
+  std::size_t memory_limit{std::size_t{256} << 20};
+
+  /// The directory of temporary files, or the system one if empty.
+  std::filesystem::path temp_directory;
+
+  /// The indicator to write only the first of the equivalent lines.
+  bool is_unique{};
+
+  /// The delimiter of lines.
+  char delimiter{'\n'};
+};
+
+namespace detail {
+
+/**
+ * @brief Merges the sorted `runs` into `output`.
+ *
+ * @returns The number of lines written.
+ */
+template<class Compare>
+std::size_t merge_runs(const std::vector<std::filesystem::path>& runs,
+  const std::filesystem::path& output, const External_sort_options& options,
+  const Compare& compare)
+{
+  const auto k = runs.size();
+  const auto buffer_size = std::max(options.memory_limit / (k + 1),
+    external_sort_min_buffer_size);
+  std::vector<std::unique_ptr<Line_reader>> readers;
+  std::vector<std::string_view> lines(k);
+  std::vector<char> is_valid(k);
+  readers.reserve(k);
+  for (std::size_t i{}; i < k; ++i) {
+    readers.push_back(std::make_unique<Line_reader>(runs[i], buffer_size,
+        options.delimiter));
+    is_valid[i] = readers[i]->next(lines[i]);
+  }
+
+  // Exhausted sources are greater than anything else.
+  const auto less = [&](const std::size_t i, const std::size_t j)
+  {
+    if (!is_valid[i] || !is_valid[j])
+      return is_valid[i] > is_valid[j];
+    else if (compare(lines[i], lines[j]))
+      return true;
+    else if (compare(lines[j], lines[i]))
+      return false;
+    return i < j;
+  };
+
+  Buffered_writer writer{output, buffer_size, options.delimiter};
+  Loser_tree tree{k, less};
+  std::size_t count{};
+  std::string last;
+  while (true) {
+    const auto w = tree.winner();
+    if (!is_valid[w])
+      break;
+
+    const auto line = lines[w];
+    if (!options.is_unique || !count || compare(last, line)) {
+      writer.write(line);
+      if (options.is_unique)
+        last.assign(line);
+      ++count;
+    }
+    is_valid[w] = readers[w]->next(lines[w]);
+    tree.replay(less);
+  }
+  writer.flush();
+  return count;
+}
+
+} // namespace detail
+
+/**
+ * @brief Sorts the lines of the file `input` into the file `output` by
+ * using the bounded amount of memory.
+ *
+ * @details The input is splitted into the runs of lines which fit into
+ * `options.memory_limit`. Each run is sorted in memory and written to the
+ * temporary file, then the runs are merged by the k-way merge with the loser
+ * tree. If there are too many runs, they are merged in several passes. The
+ * lines are read and written by the large blocks.
+ *
+ * @param compare The function of form `compare(lhs, rhs)` which returns `true`
+ * if `lhs` must be placed before `rhs`. The default comparison compares the
+ * bytes as unsigned and sorts runs by sort_strings().
+ *
+ * @par Requires
+ * `input` and `output` are different files.
+ *
+ * @returns The number of lines written.
+ */
+template<class Compare = std::less<std::string_view>>
+std::size_t external_sort(const std::filesystem::path& input,
+  const std::filesystem::path& output,
+  const External_sort_options& options = {}, const Compare& compare = {})
+{
+  const auto buffer_size = std::max(options.memory_limit / 16,
+    detail::external_sort_min_buffer_size);
+  detail::Temporary_files temp{options.temp_directory};
+  std::vector<std::filesystem::path> runs;
+  String_table table;
+  std::size_t count{};
+
+  const auto sort_table = [&]
+  {
+    auto& entries = table.entries();
+    if constexpr (std::is_same_v<Compare, std::less<std::string_view>>)
+      sort_strings(table);
+    else
+      std::stable_sort(entries.begin(), entries.end(),
+        [&](const String_table::Entry& lhs, const String_table::Entry& rhs)
+        {
+          const auto& data = table.data();
+          return compare(std::string_view{data}.substr(lhs.offset, lhs.size),
+            std::string_view{data}.substr(rhs.offset, rhs.size));
+        });
+
+    if (options.is_unique && !entries.empty()) {
+      std::size_t j{};
+      for (std::size_t i{1}; i < entries.size(); ++i) {
+        if (compare(table[j], table[i]))
+          entries[++j] = entries[i];
+      }
+      entries.resize(j + 1);
+    }
+  };
+
+  const auto write_table = [&](const std::filesystem::path& path)
+  {
+    detail::Buffered_writer writer{path, buffer_size, options.delimiter};
+    for (const auto line : table)
+      writer.write(line);
+    writer.flush();
+    count = table.size();
+    table.clear();
+  };
+
+  // Create the sorted runs.
+  {
+    detail::Line_reader reader{input, buffer_size, options.delimiter};
+    std::string_view line;
+    const auto table_limit = std::max(options.memory_limit
+      - std::min(options.memory_limit, 2 * buffer_size), options.memory_limit / 2);
+    std::size_t table_size{};
+    while (reader.next(line)) {
+      table.push_back(line);
+      table_size += line.size() + sizeof(String_table::Entry);
+      if (table_size >= table_limit) {
+        sort_table();
+        runs.push_back(temp.make());
+        write_table(runs.back());
+        table_size = 0;
+      }
+    }
+  }
+
+  // Write the only run directly.
+  if (runs.empty()) {
+    sort_table();
+    write_table(output);
+    return count;
+  } else if (!table.empty()) {
+    sort_table();
+    runs.push_back(temp.make());
+    write_table(runs.back());
+  }
+
+  // Merge the runs. Each group of consecutive runs is replaced by the merged
+  // run in place, so the runs remain in the order of input (the ties of
+  // merge_runs() are broken by the order of runs).
+  while (runs.size() > detail::external_sort_max_fan_in) {
+    std::vector<std::filesystem::path> merged;
+    for (std::size_t i{}; i < runs.size(); i += detail::external_sort_max_fan_in) {
+      const std::vector<std::filesystem::path> group(runs.begin() + i,
+        runs.begin() + std::min(i + detail::external_sort_max_fan_in,
+          runs.size()));
+      if (group.size() == 1) {
+        merged.push_back(group.front());
+        continue;
+      }
+      merged.push_back(temp.make());
+      detail::merge_runs(group, merged.back(), options, compare);
+      for (const auto& path : group)
+        temp.remove(path);
+    }
+    runs.swap(merged);
+  }
+  return detail::merge_runs(runs, output, options, compare);
+}
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_EXTERNAL_SORT_HPP
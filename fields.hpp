@@ -0,0 +1,178 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_FIELDS_HPP
+#define DMITIGR_STR_FIELDS_HPP
+
+#include "simd.hpp"
+#include "string_table.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace dmitigr::str {
+
+/**
+ * @brief The selector of fields of the lines (like `cut -f`).
+ *
+ * @details Unlike to_vector(), the line is scanned only up to the end of the
+ * last selected field, and the fields are returned as views without copying.
+ * If there are at most three separators, they are searched by the vectorized
+ * search, otherwise by the lookup table.
+ */
+class Field_selector final {
+public:
+  /// The size type.
+  using size_type = std::size_t;
+
+  /**
+   * @brief Constructs the selector of fields at `indices` (which starts at 0)
+   * separated by any of `separators`.
+   *
+   * @details The indices may be in any order and may repeat. The selected
+   * fields are always reported in the order of `indices`.
+   */
+  explicit Field_selector(std::vector<size_type> indices,
+    const std::string_view separators = "\t")
+    : indices_{std::move(indices)}
+    , order_(indices_.size())
+    , separators_{separators}
+  {
+    std::iota(order_.begin(), order_.end(), size_type{});
+    std::stable_sort(order_.begin(), order_.end(),
+      [this](const size_type lhs, const size_type rhs) noexcept
+      {
+        return indices_[lhs] < indices_[rhs];
+      });
+    for (const auto ch : separators)
+      is_separator_[static_cast<unsigned char>(ch)] = true;
+  }
+
+  /// @returns The number of selected fields.
+  size_type size() const noexcept
+  {
+    return indices_.size();
+  }
+
+  /// @returns The indices of selected fields.
+  const std::vector<size_type>& indices() const noexcept
+  {
+    return indices_;
+  }
+
+  /**
+   * @brief Stores the views of selected fields of `line` to `fields`. The
+   * fields which are missing in `line` are stored as empty views.
+   *
+   * @returns `true` if all of the selected fields are present in `line`.
+   *
+   * @par Requires
+   * `fields` points to at least `size()` elements.
+   */
+  bool select(const std::string_view line,
+    std::string_view* const fields) const noexcept
+  {
+    const auto* const data = line.data();
+    const auto* const end = data + line.size();
+    const auto* pos = data;
+    size_type index{};
+    auto o = order_.cbegin();
+    while (o != order_.cend()) {
+      const auto* const sep = find_separator(pos, end);
+      for (; o != order_.cend() && indices_[*o] == index; ++o)
+        fields[*o] = std::string_view{pos, static_cast<size_type>(sep - pos)};
+      if (sep == end)
+        break;
+      pos = sep + 1;
+      ++index;
+    }
+    const bool result{o == order_.cend()};
+    for (; o != order_.cend(); ++o)
+      fields[*o] = {};
+    return result;
+  }
+
+  /// @returns The views of selected fields of `line`.
+  std::vector<std::string_view> select(const std::string_view line) const
+  {
+    std::vector<std::string_view> result(size());
+    select(line, result.data());
+    return result;
+  }
+
+  /**
+   * @brief Appends the selected fields of each line of `lines` to the
+   * corresponding tables of `columns`.
+   *
+   * @details The lines are separated by `delimiter`, and the delimiter at the
+   * end of `lines` doesn't start the new line. Since the tables are appended,
+   * the large input can be processed by the consecutive buffers of lines.
+   *
+   * @par Effects
+   * `columns.size() == size()`.
+   */
+  void select_columns(const std::string_view lines,
+    std::vector<String_table>& columns, const char delimiter = '\n') const
+  {
+    columns.resize(size());
+    std::vector<std::string_view> fields(size());
+    const auto* const data = lines.data();
+    for (size_type pos{}; pos < lines.size();) {
+      const auto* const delim = static_cast<const char*>(
+        std::memchr(data + pos, delimiter, lines.size() - pos));
+      const size_type end = delim ? delim - data : lines.size();
+      select(lines.substr(pos, end - pos), fields.data());
+      for (size_type i{}; i < fields.size(); ++i)
+        columns[i].push_back(fields[i]);
+      pos = end + 1;
+    }
+  }
+
+  /// @returns The tables of selected fields of each line of `lines`.
+  std::vector<String_table> select_columns(const std::string_view lines,
+    const char delimiter = '\n') const
+  {
+    std::vector<String_table> result;
+    select_columns(lines, result, delimiter);
+    return result;
+  }
+
+private:
+  std::vector<size_type> indices_;
+  std::vector<size_type> order_; // of indices_ by field indices
+  std::string separators_;
+  bool is_separator_[256]{};
+
+  /// @returns The pointer to the first separator of `[b, e)`, or `e`.
+  const char* find_separator(const char* b, const char* const e) const noexcept
+  {
+    if (separators_.size() <= 3)
+      return detail::find_any_byte(b, e, separators_.data(),
+        static_cast<unsigned>(separators_.size()));
+    for (; b != e && !is_separator_[static_cast<unsigned char>(*b)]; ++b);
+    return b;
+  }
+};
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_FIELDS_HPP
@@ -0,0 +1,229 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_FIXED_WIDTH_HPP
+#define DMITIGR_STR_FIXED_WIDTH_HPP
+
+#include "basics.hpp"
+#include "exceptions.hpp"
+#include "numeric.hpp"
+#include "parallel.hpp"
+#include "simd.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace dmitigr::str {
+
+namespace detail {
+
+/// The number of records which are handled by the single thread.
+constexpr std::size_t record_layout_parallel_threshold{1 << 14};
+
+} // namespace detail
+
+/**
+ * @brief The layout of fixed-width records.
+ *
+ * @details Each record occupies exactly record_size() bytes (including the
+ * line terminator, if any), and each field occupies the fixed range of bytes
+ * of the record. The fields are sliced as views of the data (e.g. of the
+ * content of Mapped_file) without copying.
+ */
+class Record_layout final {
+public:
+  /// The size type.
+  using size_type = std::size_t;
+
+  /// The field of the record.
+  struct Field final {
+    /// The offset of the field in the record.
+    size_type offset{};
+
+    /// The width of the field.
+    size_type width{};
+
+    /// The trimming mode of ASCII white spaces of the field, if any.
+    std::optional<Trim> trim{Trim::all};
+  };
+
+  /**
+   * @brief Constructs the layout of `fields` of records of `record_size`
+   * bytes, or of the size up to the end of the last field if `record_size`
+   * is zero.
+   *
+   * @par Requires
+   * `(!record_size || record_size >= end)` and the size of the record is not
+   * zero, where `end` is the maximum end of the fields.
+   */
+  explicit Record_layout(std::vector<Field> fields, size_type record_size = 0)
+    : fields_{std::move(fields)}
+  {
+    for (const auto& field : fields_)
+      fields_end_ = std::max(fields_end_, field.offset + field.width);
+    if (record_size && record_size < fields_end_)
+      throw Exception{"cannot create record layout with fields which exceed "
+        "the record"};
+    record_size_ = record_size ? record_size : fields_end_;
+    if (!record_size_)
+      throw Exception{"cannot create record layout of zero size"};
+  }
+
+  /// @returns The number of fields.
+  size_type size() const noexcept
+  {
+    return fields_.size();
+  }
+
+  /// @returns The field at `index`.
+  const Field& field(const size_type index) const noexcept
+  {
+    return fields_[index];
+  }
+
+  /// @returns The size of the record.
+  size_type record_size() const noexcept
+  {
+    return record_size_;
+  }
+
+  /**
+   * @returns The number of records of `data`.
+   *
+   * @details The incomplete last record is counted if it's not empty and
+   * contains all of the fields (e.g. if the last line has no terminator).
+   */
+  size_type record_count(const std::string_view data) const noexcept
+  {
+    const auto tail_size = data.size() % record_size_;
+    return data.size() / record_size_ + (tail_size && tail_size >= fields_end_);
+  }
+
+  /**
+   * @returns The record of `data` at `index`.
+   *
+   * @par Requires
+   * `index < record_count(data)`.
+   */
+  std::string_view record(const std::string_view data,
+    const size_type index) const noexcept
+  {
+    return data.substr(index * record_size_, record_size_);
+  }
+
+  /**
+   * @returns The value of the field at `index` of `record`, trimmed according
+   * to the field.
+   *
+   * @details The white spaces are skipped by the vectorized search.
+   */
+  std::string_view value(const std::string_view record,
+    const size_type index) const noexcept
+  {
+    const auto& field = fields_[index];
+    auto result = record.substr(std::min(field.offset, record.size()),
+      field.width);
+    if (field.trim) {
+      const auto* b = result.data();
+      const auto* e = b + result.size();
+      if (static_cast<bool>(*field.trim & Trim::lhs))
+        b = detail::find_non_ascii_space(b, e);
+      if (static_cast<bool>(*field.trim & Trim::rhs))
+        e = detail::rfind_non_ascii_space(b, e);
+      result = {b, static_cast<size_type>(e - b)};
+    }
+    return result;
+  }
+
+  /**
+   * @returns The value of the field at `index` of `record` converted to the
+   * integer, or `std::nullopt` if the value is not a decimal integer.
+   *
+   * @see to_integer().
+   */
+  std::optional<std::int64_t> integer(const std::string_view record,
+    const size_type index) const noexcept
+  {
+    return to_integer(value(record, index));
+  }
+
+  /**
+   * @brief Calls `f(index, record)` for each record of `data`.
+   *
+   * @details The records are splitted into the ranges, which are handled by
+   * up to `thread_count` threads, or `std::thread::hardware_concurrency()`
+   * threads if `thread_count == 0`. The records of each range are handled in
+   * order, so `f` must be safe to call concurrently for different records.
+   */
+  template<typename F>
+  void for_each_record(const std::string_view data, const F& f,
+    unsigned thread_count = 1) const
+  {
+    const auto count = record_count(data);
+    thread_count = static_cast<unsigned>(std::max<std::size_t>(1,
+      std::min<std::size_t>(detail::thread_count_or_default(thread_count),
+        count / detail::record_layout_parallel_threshold)));
+    detail::run_parallel(thread_count, [&](const unsigned t)
+    {
+      const auto [b, e] = detail::part_bounds(count, thread_count, t);
+      for (auto i = b; i < e; ++i)
+        f(i, record(data, i));
+    });
+  }
+
+  /// @returns The values of the field at `index` of each record of `data`.
+  std::vector<std::string_view> values(const std::string_view data,
+    const size_type index, const unsigned thread_count = 1) const
+  {
+    std::vector<std::string_view> result(record_count(data));
+    for_each_record(data, [&](const size_type i, const std::string_view rec)
+    {
+      result[i] = value(rec, index);
+    }, thread_count);
+    return result;
+  }
+
+  /**
+   * @returns The values of the field at `index` of each record of `data`
+   * converted to the integers.
+   *
+   * @see integer().
+   */
+  std::vector<std::optional<std::int64_t>> integers(const std::string_view data,
+    const size_type index, const unsigned thread_count = 1) const
+  {
+    std::vector<std::optional<std::int64_t>> result(record_count(data));
+    for_each_record(data, [&](const size_type i, const std::string_view rec)
+    {
+      result[i] = integer(rec, index);
+    }, thread_count);
+    return result;
+  }
+
+private:
+  std::vector<Field> fields_;
+  size_type fields_end_{};
+  size_type record_size_{};
+};
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_FIXED_WIDTH_HPP
@@ -0,0 +1,556 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_FM_INDEX_HPP
+#define DMITIGR_STR_FM_INDEX_HPP
+
+#include "../base/fsx.hpp"
+#include "exceptions.hpp"
+#include "mapped_file.hpp"
+#include "numeric.hpp"
+#include "parallel.hpp"
+#include "simd.hpp"
+#include "suffix_array.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace dmitigr::str {
+
+/**
+ * @brief The FM-index of the text for counting and locating the occurrences
+ * of substrings without scanning the text.
+ *
+ * @details The index consists of the Burrows-Wheeler transform (BWT) of the
+ * text, the rank checkpoints of the BWT and the sampled suffix array. The
+ * text itself is not stored.
+ *
+ * The occurrences are counted by the backward search in O(m) steps, where m
+ * is the size of pattern, and each step takes two rank queries. The rank is
+ * computed from the 64-bit counts of each character per 64 KiB superblock,
+ * the 16-bit counts per 256-byte block and the vectorized count of bytes of
+ * the block. Each occurrence is located by walking the BWT back to the
+ * nearest sampled position, i.e. in less than sample_rate() steps.
+ *
+ * The index is represented by the single image which is written to the file
+ * by save() and can be memory mapped without any decoding (the image is only
+ * validated on load by the walk over the whole BWT):
+ *   - the header of six 64-bit integers: the magic, text_size(),
+ *     sample_rate(), the row of the end marker, the number of samples and the
+ *     number of distinct characters of the text;
+ *   - the number of characters less than each byte, as 257 64-bit integers;
+ *   - the BWT;
+ *   - the superblock counts and the block counts of each distinct character;
+ *   - the bit vector of rows of the sampled positions with the 64-bit ranks
+ *     of each group of 512 bits;
+ *   - the sampled positions as 64-bit integers.
+ * All of the integers are little-endian, and each area is aligned on 8 bytes.
+ */
+class Fm_index final {
+public:
+  /// The size type.
+  using size_type = std::size_t;
+
+  /**
+   * @brief Constructs the index of `text` with the suffix array sampled at
+   * each `sample_rate` position by using up to `thread_count` threads, or
+   * `std::thread::hardware_concurrency()` threads if `thread_count == 0`.
+   *
+   * @details The suffix array is built by the single thread, then the BWT,
+   * the rank checkpoints and the samples are computed in parallel.
+   *
+   * @par Requires
+   * `sample_rate > 0`.
+   *
+   * @see suffix_array().
+   */
+  explicit Fm_index(const std::string_view text, const size_type sample_rate = 32,
+    const unsigned thread_count = 1)
+  {
+    if (!sample_rate)
+      throw Exception{"cannot create FM-index with zero sample rate"};
+
+    if (text.size() < std::numeric_limits<std::uint32_t>::max())
+      build(text, suffix_array<std::uint32_t>(text), sample_rate, thread_count);
+    else
+      build(text, suffix_array<std::uint64_t>(text), sample_rate, thread_count);
+    init();
+  }
+
+  /**
+   * @brief Constructs the index from the image mapped by `file`.
+   *
+   * @see save().
+   */
+  explicit Fm_index(Mapped_file file)
+    : file_{std::move(file)}
+  {
+    init();
+  }
+
+  /// @returns The size of the indexed text.
+  size_type text_size() const noexcept
+  {
+    return rows_ - 1;
+  }
+
+  /// @returns The sample rate of the suffix array.
+  size_type sample_rate() const noexcept
+  {
+    return sample_rate_;
+  }
+
+  /// @returns The number of occurrences of non-empty `pattern` in the text.
+  size_type count(const std::string_view pattern) const noexcept
+  {
+    const auto [b, e] = rows(pattern);
+    return e - b;
+  }
+
+  /**
+   * @brief Calls `f(position)` for each occurrence of non-empty `pattern` in
+   * the text.
+   *
+   * @details The positions are not ordered.
+   */
+  template<typename F>
+  void for_each_position(const std::string_view pattern, F&& f) const
+  {
+    const auto [b, e] = rows(pattern);
+    for (auto row = b; row < e; ++row)
+      f(position(row));
+  }
+
+  /// @returns The positions of occurrences of `pattern` in increasing order.
+  std::vector<size_type> locate(const std::string_view pattern) const
+  {
+    std::vector<size_type> result;
+    result.reserve(count(pattern));
+    for_each_position(pattern, [&result](const size_type position)
+    {
+      result.push_back(position);
+    });
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  /// @returns The image of the index.
+  std::string_view image() const noexcept
+  {
+    return file_.is_open() ? file_.view() : std::string_view{storage_};
+  }
+
+  /// Writes image() to the file at `path`.
+  void save(const std::filesystem::path& path) const
+  {
+    const auto img = image();
+    std::ofstream output{path, std::ios_base::out | std::ios_base::binary
+      | std::ios_base::trunc};
+    if (!output.write(img.data(), static_cast<std::streamsize>(img.size()))
+      || !output.flush())
+      throw Exception{"cannot save FM-index to \""
+        + path.generic_string() + "\""};
+  }
+
+private:
+  static constexpr std::uint64_t magic{0x31304D4654534D44}; // "DMSTFM01"
+  static constexpr size_type header_size{48};
+  static constexpr unsigned block_bits{8};
+  static constexpr unsigned superblock_bits{16};
+
+  /// The offsets of areas of the image.
+  struct Layout final {
+    size_type counts{};
+    size_type bwt{};
+    size_type superblocks{};
+    size_type blocks{};
+    size_type bits{};
+    size_type bit_ranks{};
+    size_type samples{};
+    size_type size{};
+  };
+
+  Mapped_file file_;
+  std::string storage_;
+  size_type rows_{};
+  size_type sample_rate_{};
+  size_type end_row_{};
+  size_type sigma_{};
+  Layout layout_;
+  std::uint64_t counts_[257]{};
+  std::uint16_t ranks_[256]{};
+
+  /// @returns The size rounded up to the multiple of 8.
+  static size_type aligned(const size_type size) noexcept
+  {
+    return (size + 7) & ~size_type{7};
+  }
+
+  static Layout make_layout(const size_type rows, const size_type sigma,
+    const size_type sample_count) noexcept
+  {
+    Layout result;
+    result.counts = header_size;
+    result.bwt = result.counts + 257*8;
+    result.superblocks = aligned(result.bwt + rows);
+    result.blocks = result.superblocks
+      + ((rows >> superblock_bits) + 1) * sigma * 8;
+    result.bits = aligned(result.blocks + ((rows >> block_bits) + 1) * sigma * 2);
+    const auto word_count = rows / 64 + 1;
+    result.bit_ranks = result.bits + word_count * 8;
+    result.samples = result.bit_ranks + (word_count / 8 + 1) * 8;
+    result.size = result.samples + sample_count * 8;
+    return result;
+  }
+
+  /**
+   * @brief Builds the image of the index of `text` with the suffix array `sa`.
+   *
+   * @details The rows of the BWT are the sorted suffixes of the text followed
+   * by the end marker, and the first row is the empty suffix. The end marker
+   * is stored as zero byte which is excluded from the counts.
+   */
+  template<typename Index>
+  void build(const std::string_view text, const std::vector<Index>& sa,
+    const size_type sample_rate, unsigned thread_count)
+  {
+    const auto n = text.size();
+    const size_type rows{n + 1};
+    const auto position = [&sa, n](const size_type row) noexcept
+    {
+      return row ? static_cast<size_type>(sa[row - 1]) : n;
+    };
+    thread_count = detail::thread_count_or_default(thread_count);
+    const auto word_count = rows / 64 + 1;
+    thread_count = static_cast<unsigned>(std::min<size_type>(thread_count,
+        (rows >> superblock_bits) + 1));
+
+    // Count the characters.
+    std::uint64_t counts[257]{};
+    for (const auto ch : text)
+      ++counts[static_cast<unsigned char>(ch) + 1];
+    std::uint16_t ranks[256]{};
+    size_type sigma{};
+    for (unsigned c{}; c < 256; ++c) {
+      if (counts[c + 1])
+        ranks[c] = static_cast<std::uint16_t>(sigma++);
+    }
+    counts[0] = 1; // the end marker
+    for (unsigned c{1}; c < 257; ++c)
+      counts[c] += counts[c - 1];
+
+    // Count the samples of each part of words of the bit vector.
+    const auto is_sampled = [&](const size_type row) noexcept
+    {
+      return !(position(row) % sample_rate);
+    };
+    std::vector<size_type> part_samples(thread_count + 1);
+    detail::run_parallel(thread_count, [&](const unsigned t)
+    {
+      const auto [b, e] = detail::part_bounds(word_count, thread_count, t);
+      for (auto row = b * 64, end = std::min(e * 64, rows); row < end; ++row)
+        part_samples[t + 1] += is_sampled(row);
+    });
+    for (unsigned t{}; t < thread_count; ++t)
+      part_samples[t + 1] += part_samples[t];
+
+    const auto layout = make_layout(rows, sigma, part_samples[thread_count]);
+    storage_.assign(layout.size, '\0');
+    const auto img = storage_.data();
+    write_little_endian<std::uint64_t>(img, magic);
+    write_little_endian<std::uint64_t>(img + 8, n);
+    write_little_endian<std::uint64_t>(img + 16, sample_rate);
+    write_little_endian<std::uint64_t>(img + 32, part_samples[thread_count]);
+    write_little_endian<std::uint64_t>(img + 40, sigma);
+    for (unsigned c{}; c < 257; ++c)
+      write_little_endian(img + layout.counts + c*8, counts[c]);
+
+    // Compute the BWT, the bit vector and the samples.
+    detail::run_parallel(thread_count, [&](const unsigned t)
+    {
+      const auto [b, e] = detail::part_bounds(word_count, thread_count, t);
+      auto sample = img + layout.samples + part_samples[t] * 8;
+      for (auto row = b * 64, end = std::min(e * 64, rows); row < end; ++row) {
+        const auto pos = position(row);
+        if (pos)
+          img[layout.bwt + row] = text[pos - 1];
+        else
+          write_little_endian<std::uint64_t>(img + 24, row);
+        if (!(pos % sample_rate)) {
+          img[layout.bits + row / 64 * 8 + row % 64 / 8] |=
+            static_cast<char>(1 << row % 8);
+          write_little_endian<std::uint64_t>(sample, pos);
+          sample += 8;
+        }
+      }
+    });
+    std::uint64_t bit_rank{};
+    for (size_type w{}; w < word_count; ++w) {
+      if (!(w % 8))
+        write_little_endian(img + layout.bit_ranks + w / 8 * 8, bit_rank);
+      bit_rank += detail::popcount(read_little_endian<std::uint64_t>(
+          img + layout.bits + w*8));
+    }
+
+    // Compute the rank checkpoints of each superblock.
+    const size_type superblock_count{(rows >> superblock_bits) + 1};
+    std::vector<std::uint64_t> totals(superblock_count * sigma);
+    const auto end_row = read_little_endian<std::uint64_t>(img + 24);
+    detail::run_parallel(thread_count, [&](const unsigned t)
+    {
+      const auto [b, e] = detail::part_bounds(superblock_count, thread_count, t);
+      for (auto s = b; s < e; ++s) {
+        std::uint32_t local[256]{};
+        const auto first = s << superblock_bits;
+        const auto last = std::min(first + (size_type{1} << superblock_bits), rows);
+        for (auto row = first; row < last; ++row) {
+          if (!(row & ((1 << block_bits) - 1))) {
+            auto* const block = img + layout.blocks
+              + (row >> block_bits) * sigma * 2;
+            for (unsigned c{}; c < 256; ++c) {
+              if (counts[c + 1] != counts[c])
+                write_little_endian(block + ranks[c] * 2,
+                  static_cast<std::uint16_t>(local[c]));
+            }
+          }
+          if (row != end_row)
+            ++local[static_cast<unsigned char>(img[layout.bwt + row])];
+        }
+        // The block of the row `rows` might begin the next superblock.
+        if (last == rows && !(rows & ((1 << block_bits) - 1))
+          && (rows >> superblock_bits) == s) {
+          auto* const block = img + layout.blocks + (rows >> block_bits) * sigma * 2;
+          for (unsigned c{}; c < 256; ++c) {
+            if (counts[c + 1] != counts[c])
+              write_little_endian(block + ranks[c] * 2,
+                static_cast<std::uint16_t>(local[c]));
+          }
+        }
+        for (unsigned c{}; c < 256; ++c) {
+          if (counts[c + 1] != counts[c])
+            totals[s * sigma + ranks[c]] = local[c];
+        }
+      }
+    });
+    std::vector<std::uint64_t> sums(sigma);
+    for (size_type s{}; s < superblock_count; ++s) {
+      for (size_type r{}; r < sigma; ++r) {
+        write_little_endian(img + layout.superblocks + (s * sigma + r) * 8,
+          sums[r]);
+        sums[r] += totals[s * sigma + r];
+      }
+    }
+  }
+
+  /// Validates the image and initializes the fields of header.
+  void init()
+  {
+    const auto img = image();
+    const auto invalid = []
+    {
+      return Exception{"cannot use invalid image of FM-index"};
+    };
+    if (img.size() < header_size + 257*8
+      || read_little_endian<std::uint64_t>(img.data()) != magic)
+      throw invalid();
+
+    const auto field = [&img](const size_type index)
+    {
+      return read_little_endian<std::uint64_t>(img.data() + 8*index);
+    };
+    const auto text_size = field(1);
+    const auto sample_rate = field(2);
+    const auto end_row = field(3);
+    const auto sample_count = field(4);
+    const auto sigma = field(5);
+    if (text_size >= img.size() || !sample_rate || end_row > text_size
+      || sample_count > text_size + 1 || sigma > 256)
+      throw invalid();
+
+    rows_ = static_cast<size_type>(text_size + 1);
+    sample_rate_ = static_cast<size_type>(sample_rate);
+    end_row_ = static_cast<size_type>(end_row);
+    sigma_ = static_cast<size_type>(sigma);
+    layout_ = make_layout(rows_, sigma_, static_cast<size_type>(sample_count));
+    if (layout_.size != img.size())
+      throw invalid();
+
+    size_type distinct{};
+    for (unsigned c{}; c < 257; ++c) {
+      counts_[c] = read_little_endian<std::uint64_t>(img.data()
+        + layout_.counts + c*8);
+      if (c && counts_[c] < counts_[c - 1])
+        throw invalid();
+      else if (c && counts_[c] != counts_[c - 1])
+        ranks_[c - 1] = static_cast<std::uint16_t>(distinct++);
+    }
+    if (counts_[0] != 1 || counts_[256] != rows_ || distinct != sigma_)
+      throw invalid();
+
+    // Validate the rank checkpoints against the BWT, since rows() relies on
+    // them to stay within `[0, rows_]`.
+    const auto* const bwt = img.data() + layout_.bwt;
+    if (bwt[end_row_])
+      throw invalid();
+    std::uint64_t totals[256]{};
+    std::uint64_t superblock_totals[256]{};
+    for (size_type row{};; ++row) {
+      if (!(row & ((size_type{1} << block_bits) - 1))) {
+        const bool is_superblock{!(row & ((size_type{1} << superblock_bits) - 1))};
+        for (unsigned c{}; c < 256; ++c) {
+          if (counts_[c + 1] == counts_[c])
+            continue;
+          if (is_superblock) {
+            superblock_totals[c] = totals[c];
+            if (read_little_endian<std::uint64_t>(img.data()
+                + layout_.superblocks + ((row >> superblock_bits) * sigma_
+                  + ranks_[c]) * 8) != totals[c])
+              throw invalid();
+          }
+          if (read_little_endian<std::uint16_t>(img.data() + layout_.blocks
+              + ((row >> block_bits) * sigma_ + ranks_[c]) * 2)
+            != totals[c] - superblock_totals[c])
+            throw invalid();
+        }
+      }
+      if (row == rows_)
+        break;
+      else if (row != end_row_)
+        ++totals[static_cast<unsigned char>(bwt[row])];
+    }
+    for (unsigned c{}; c < 256; ++c) {
+      if (totals[c] != counts_[c + 1] - counts_[c])
+        throw invalid();
+    }
+
+    // Validate the ranks of the bit vector, since position() relies on them to
+    // stay within the samples.
+    std::uint64_t bit_rank{};
+    for (size_type w{}, word_count{rows_ / 64 + 1}; w < word_count; ++w) {
+      if (!(w % 8) && read_little_endian<std::uint64_t>(img.data()
+          + layout_.bit_ranks + w / 8 * 8) != bit_rank)
+        throw invalid();
+      bit_rank += detail::popcount(read_little_endian<std::uint64_t>(
+          img.data() + layout_.bits + w*8));
+    }
+    if (bit_rank != sample_count)
+      throw invalid();
+
+    // Walk the BWT back from the last position of the text to the first one,
+    // since position() relies on the walk from each row to reach the sampled
+    // row of the right position in less than sample_rate_ steps. The walk
+    // must visit all of the rows, i.e. the BWT must be the single cycle.
+    size_type row{};
+    for (auto pos = rows_ - 1;; --pos) {
+      const bool is_sampled_row{is_sampled(row)};
+      if (is_sampled_row != !(pos % sample_rate_)
+        || (is_sampled_row && sampled_position(row) != pos))
+        throw invalid();
+      else if (!pos)
+        break;
+      else if (row == end_row_)
+        throw invalid();
+      const auto ch = static_cast<unsigned char>(bwt[row]);
+      row = static_cast<size_type>(counts_[ch]) + occurrences(ch, row);
+    }
+    if (row != end_row_)
+      throw invalid();
+  }
+
+  /// @returns The number of characters `ch` in the rows `[0, row)` of BWT.
+  size_type occurrences(const unsigned char ch, const size_type row) const noexcept
+  {
+    const auto img = image().data();
+    const auto r = ranks_[ch];
+    const auto first = row & ~((size_type{1} << block_bits) - 1);
+    auto result = static_cast<size_type>(
+      read_little_endian<std::uint64_t>(img + layout_.superblocks
+        + ((row >> superblock_bits) * sigma_ + r) * 8)
+      + read_little_endian<std::uint16_t>(img + layout_.blocks
+        + ((row >> block_bits) * sigma_ + r) * 2)
+      + detail::count_byte(img + layout_.bwt + first, img + layout_.bwt + row,
+        static_cast<char>(ch)));
+    if (!ch && first <= end_row_ && end_row_ < row)
+      --result; // the end marker
+    return result;
+  }
+
+  /// @returns The rows of BWT which are prefixed with `pattern`.
+  std::pair<size_type, size_type> rows(const std::string_view pattern) const noexcept
+  {
+    if (pattern.empty())
+      return {};
+
+    size_type b{}, e{rows_};
+    for (auto i = pattern.size(); i-- > 0;) {
+      const auto ch = static_cast<unsigned char>(pattern[i]);
+      if (counts_[ch + 1] == counts_[ch])
+        return {};
+      b = static_cast<size_type>(counts_[ch]) + occurrences(ch, b);
+      e = static_cast<size_type>(counts_[ch]) + occurrences(ch, e);
+      if (b >= e)
+        return {};
+    }
+    return {b, e};
+  }
+
+  /// @returns `true` if the position of `row` is sampled.
+  bool is_sampled(const size_type row) const noexcept
+  {
+    return static_cast<unsigned char>(
+      image()[layout_.bits + row / 64 * 8 + row % 64 / 8]) >> row % 8 & 1;
+  }
+
+  /// @returns The position in the text of the suffix of `row`.
+  size_type position(size_type row) const noexcept
+  {
+    const auto img = image().data();
+    size_type steps{};
+    for (; !is_sampled(row); ++steps) {
+      const auto ch = static_cast<unsigned char>(img[layout_.bwt + row]);
+      row = static_cast<size_type>(counts_[ch]) + occurrences(ch, row);
+    }
+    return sampled_position(row) + steps;
+  }
+
+  /// @returns The position stored for the sampled `row`.
+  size_type sampled_position(const size_type row) const noexcept
+  {
+    const auto img = image().data();
+    const auto word = row / 64;
+    const auto group = word / 8;
+    auto rank = static_cast<size_type>(read_little_endian<std::uint64_t>(
+        img + layout_.bit_ranks + group * 8));
+    for (auto w = group * 8; w < word; ++w)
+      rank += detail::popcount(read_little_endian<std::uint64_t>(
+          img + layout_.bits + w * 8));
+    rank += detail::popcount(read_little_endian<std::uint64_t>(
+        img + layout_.bits + word * 8) & ((std::uint64_t{1} << row % 64) - 1));
+    return static_cast<size_type>(read_little_endian<std::uint64_t>(
+        img + layout_.samples + rank * 8));
+  }
+};
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_FM_INDEX_HPP
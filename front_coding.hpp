@@ -0,0 +1,436 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_FRONT_CODING_HPP
+#define DMITIGR_STR_FRONT_CODING_HPP
+
+#include "../base/fsx.hpp"
+#include "exceptions.hpp"
+#include "mapped_file.hpp"
+#include "numeric.hpp"
+#include "simd.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace dmitigr::str {
+
+/**
+ * @brief The immutable front coded (prefix compressed) sorted dictionary.
+ *
+ * @details The keys are stored in the blocks of `block_size()` keys. The first
+ * key of each block is stored as is, which allows the binary search over the
+ * blocks, and each following key of the block is stored as the length of its
+ * common prefix with the preceding key and the rest of key.
+ *
+ * The dictionary is represented by the single image which is written to the
+ * file by save() and can be memory mapped without decoding of the keys (only
+ * their lengths are validated on load):
+ *   - the header of four 64-bit integers: the magic, block_size(), size() and
+ *     the number of blocks;
+ *   - the offsets of blocks in the data area as 64-bit integers, followed by
+ *     the size of data area;
+ *   - the data area.
+ * All of the integers of header and offsets are little-endian, the lengths
+ * are stored by using append_varint().
+ */
+class Front_coded_dictionary final {
+public:
+  /// The size type.
+  using size_type = std::size_t;
+
+  /// The constant forward iterator over the keys in the sorted order.
+  class const_iterator final {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::string;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::string*;
+    using reference = const std::string&;
+
+    const_iterator() = default;
+
+    /// @returns The current key.
+    reference operator*() const noexcept
+    {
+      return key_;
+    }
+
+    /// @returns The pointer to the current key.
+    pointer operator->() const noexcept
+    {
+      return &key_;
+    }
+
+    /// @returns The index of the current key.
+    size_type index() const noexcept
+    {
+      return index_;
+    }
+
+    const_iterator& operator++()
+    {
+      if (++index_ < dict_->size())
+        decode();
+      else
+        key_.clear();
+      return *this;
+    }
+
+    const_iterator operator++(int)
+    {
+      auto result = *this;
+      ++*this;
+      return result;
+    }
+
+    friend bool operator==(const const_iterator& lhs,
+      const const_iterator& rhs) noexcept
+    {
+      return lhs.index_ == rhs.index_ && lhs.dict_ == rhs.dict_;
+    }
+
+    friend bool operator!=(const const_iterator& lhs,
+      const const_iterator& rhs) noexcept
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+    friend Front_coded_dictionary;
+
+    const Front_coded_dictionary* dict_{};
+    size_type index_{};
+    const char* pos_{};
+    std::string key_;
+
+    /// Constructs the iterator to the first key of the block `block`.
+    const_iterator(const Front_coded_dictionary* const dict,
+      const size_type block)
+      : dict_{dict}
+      , index_{std::min(block * dict->block_size_, dict->size_)}
+    {
+      if (index_ < dict_->size_)
+        decode();
+    }
+
+    /// Decodes the key at `index_`.
+    void decode()
+    {
+      if (!(index_ % dict_->block_size_)) {
+        pos_ = dict_->block(index_ / dict_->block_size_);
+        const auto size = static_cast<size_type>(read_varint(pos_));
+        key_.assign(pos_, size);
+        pos_ += size;
+      } else {
+        const auto prefix_size = static_cast<size_type>(read_varint(pos_));
+        const auto size = static_cast<size_type>(read_varint(pos_));
+        key_.resize(prefix_size);
+        key_.append(pos_, size);
+        pos_ += size;
+      }
+    }
+  };
+
+  /// Constructs the empty dictionary.
+  Front_coded_dictionary()
+    : Front_coded_dictionary{std::vector<std::string_view>{}}
+  {}
+
+  /**
+   * @brief Constructs the dictionary of `sorted_keys`.
+   *
+   * @par Requires
+   * `sorted_keys` are sorted lexicographically and `block_size > 0`.
+   */
+  template<class Range,
+    typename = std::enable_if_t<!std::is_same_v<Range, Mapped_file>>>
+  explicit Front_coded_dictionary(const Range& sorted_keys,
+    const size_type block_size = 16)
+  {
+    if (!block_size)
+      throw Exception{"cannot create front coded dictionary with "
+        "invalid block size"};
+
+    std::string data;
+    std::vector<std::uint64_t> offsets;
+    std::string prev; // a copy, since `sorted_keys` might yield temporaries
+    size_type count{};
+    for (const auto& k : sorted_keys) {
+      const std::string_view key{k};
+      if (count && key < prev)
+        throw Exception{"cannot create front coded dictionary of "
+          "unsorted keys"};
+
+      if (!(count % block_size)) {
+        offsets.push_back(data.size());
+        append_varint(data, key.size());
+        data.append(key);
+      } else {
+        const auto prefix_size = detail::mismatch(prev.data(), key.data(),
+          std::min(prev.size(), key.size()));
+        append_varint(data, prefix_size);
+        append_varint(data, key.size() - prefix_size);
+        data.append(key.substr(prefix_size));
+      }
+      prev.assign(key);
+      ++count;
+    }
+    offsets.push_back(data.size());
+
+    storage_.reserve(header_size + offsets.size() * 8 + data.size());
+    append_little_endian<std::uint64_t>(storage_, magic);
+    append_little_endian<std::uint64_t>(storage_, block_size);
+    append_little_endian<std::uint64_t>(storage_, count);
+    append_little_endian<std::uint64_t>(storage_, offsets.size() - 1);
+    for (const auto offset : offsets)
+      append_little_endian(storage_, offset);
+    storage_.append(data);
+    init();
+  }
+
+  /**
+   * @brief Constructs the dictionary from the image mapped by `file`.
+   *
+   * @see save().
+   */
+  explicit Front_coded_dictionary(Mapped_file file)
+    : file_{std::move(file)}
+  {
+    init();
+  }
+
+  /// @returns The number of keys.
+  size_type size() const noexcept
+  {
+    return size_;
+  }
+
+  /// @returns `!size()`.
+  bool empty() const noexcept
+  {
+    return !size_;
+  }
+
+  /// @returns The maximum number of keys in the block.
+  size_type block_size() const noexcept
+  {
+    return block_size_;
+  }
+
+  /// @returns The iterator to the first key.
+  const_iterator begin() const
+  {
+    return const_iterator{this, 0};
+  }
+
+  /// @returns The iterator past the last key.
+  const_iterator end() const
+  {
+    return const_iterator{this, block_count_};
+  }
+
+  /// @returns The key at `index`.
+  std::string at(const size_type index) const
+  {
+    if (!(index < size_))
+      throw Exception{"cannot get key of front coded dictionary by invalid "
+        "index"};
+
+    const_iterator result{this, index / block_size_};
+    while (result.index_ != index)
+      ++result;
+    return std::move(result.key_);
+  }
+
+  /// @returns The iterator to the first key which is not less than `key`.
+  const_iterator lower_bound(const std::string_view key) const
+  {
+    // Find the first block whose first key is not less than `key`.
+    size_type lo{}, hi{block_count_};
+    while (lo < hi) {
+      const auto mid = lo + (hi - lo) / 2;
+      if (key <= first_key(mid))
+        hi = mid;
+      else
+        lo = mid + 1;
+    }
+    if (!lo)
+      return begin();
+
+    // Scan the preceding block.
+    const_iterator result{this, lo - 1};
+    const auto e = std::min(lo * block_size_, size_);
+    while (result.index_ < e && *result < key)
+      ++result;
+    return result;
+  }
+
+  /// @returns The iterator to `key`, or end() if there is no such a key.
+  const_iterator find(const std::string_view key) const
+  {
+    auto result = lower_bound(key);
+    return result != end() && *result == key ? result : end();
+  }
+
+  /// @returns `true` if the dictionary contains `key`.
+  bool contains(const std::string_view key) const
+  {
+    return find(key) != end();
+  }
+
+  /// @returns The range of keys which starts with `prefix`.
+  std::pair<const_iterator, const_iterator>
+  prefix_range(const std::string_view prefix) const
+  {
+    // The successor of `prefix` is the least string which is greater than
+    // all of the strings which start with `prefix`.
+    std::string successor{prefix};
+    while (!successor.empty()
+      && static_cast<unsigned char>(successor.back()) == 0xFF)
+      successor.pop_back();
+    if (successor.empty())
+      return {lower_bound(prefix), end()};
+    ++successor.back();
+    return {lower_bound(prefix), lower_bound(successor)};
+  }
+
+  /// @returns The image of the dictionary.
+  std::string_view image() const noexcept
+  {
+    return file_.is_open() ? file_.view() : std::string_view{storage_};
+  }
+
+  /// Writes image() to the file at `path`.
+  void save(const std::filesystem::path& path) const
+  {
+    const auto img = image();
+    std::ofstream output{path, std::ios_base::out | std::ios_base::binary
+      | std::ios_base::trunc};
+    if (!output.write(img.data(), static_cast<std::streamsize>(img.size()))
+      || !output.flush())
+      throw Exception{"cannot save front coded dictionary to \""
+        + path.generic_string() + "\""};
+  }
+
+private:
+  static constexpr std::uint64_t magic{0x3130434654534D44}; // "DMSTFC01"
+  static constexpr size_type header_size{32};
+
+  Mapped_file file_;
+  std::string storage_;
+  size_type block_size_{};
+  size_type size_{};
+  size_type block_count_{};
+
+  /// Validates the image and initializes the fields of header.
+  void init()
+  {
+    const auto img = image();
+    const auto invalid = []
+    {
+      return Exception{"cannot use invalid image of front coded dictionary"};
+    };
+    if (img.size() < header_size + 8
+      || read_little_endian<std::uint64_t>(img.data()) != magic)
+      throw invalid();
+
+    const auto field = [&img](const size_type index)
+    {
+      return read_little_endian<std::uint64_t>(img.data() + 8*index);
+    };
+    const auto block_size = field(1);
+    const auto size = field(2);
+    const auto block_count = field(3);
+    if (!block_size || block_count != size / block_size + !!(size % block_size)
+      || block_count > (img.size() - header_size) / 8 - 1)
+      throw invalid();
+
+    block_size_ = static_cast<size_type>(block_size);
+    size_ = static_cast<size_type>(size);
+    block_count_ = static_cast<size_type>(block_count);
+    const auto data_size = img.size() - data_offset();
+    for (size_type i{}; i < block_count_; ++i) {
+      if (offset(i) >= offset(i + 1))
+        throw invalid();
+    }
+    if (offset(block_count_) != data_size)
+      throw invalid();
+
+    // Decode the lengths of each block, since decode() and first_key() rely
+    // on them without any checks.
+    for (size_type i{}; i < block_count_; ++i) {
+      const char* p = block(i);
+      const char* const e = block(i + 1);
+      const auto key_count = std::min(block_size_, size_ - i * block_size_);
+      std::uint64_t key_size{};
+      for (size_type j{}; j < key_count; ++j) {
+        std::uint64_t prefix_size{};
+        if (j) {
+          const auto value = read_varint(p, e);
+          if (!value || *value > key_size)
+            throw invalid();
+          prefix_size = *value;
+        }
+        const auto suffix_size = read_varint(p, e);
+        if (!suffix_size || *suffix_size > static_cast<std::uint64_t>(e - p))
+          throw invalid();
+        p += *suffix_size;
+        key_size = prefix_size + *suffix_size;
+      }
+      if (p != e)
+        throw invalid();
+    }
+  }
+
+  /// @returns The offset of the data area in image().
+  size_type data_offset() const noexcept
+  {
+    return header_size + (block_count_ + 1) * 8;
+  }
+
+  /// @returns The offset of the block `index` in the data area.
+  std::uint64_t offset(const size_type index) const noexcept
+  {
+    return read_little_endian<std::uint64_t>(image().data() + header_size
+      + index * 8);
+  }
+
+  /// @returns The pointer to the block `index`.
+  const char* block(const size_type index) const noexcept
+  {
+    return image().data() + data_offset() + offset(index);
+  }
+
+  /// @returns The first key of the block `index`.
+  std::string_view first_key(const size_type index) const noexcept
+  {
+    const char* p = block(index);
+    const auto size = static_cast<size_type>(read_varint(p));
+    return {p, size};
+  }
+};
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_FRONT_CODING_HPP
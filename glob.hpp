@@ -0,0 +1,383 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_GLOB_HPP
+#define DMITIGR_STR_GLOB_HPP
+
+#include "byte_set.hpp"
+#include "simd.hpp"
+
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace dmitigr::str {
+
+/**
+ * @brief The compiled wildcard pattern.
+ *
+ * @details The pattern syntax is the one of `fnmatch()` without flags:
+ *   - `*` matches any string (including empty one);
+ *   - `?` matches any character;
+ *   - `[...]` matches any of the enclosed characters, ranges (like `a-z`) and
+ *     classes (like `[:alpha:]`), `[!...]` or `[^...]` matches any character
+ *     which is not enclosed. The `]` is enclosed if it goes first. The `[`
+ *     without the closing `]` matches itself;
+ *   - `\` makes the following character matching itself, the trailing `\`
+ *     matches itself.
+ * The characters are bytes, the classes are of the "C" locale.
+ *
+ * The pattern is compiled into the segments separated by `*`. Each segment
+ * is the sequence of literals, `?` and bitmaps of character sets, so it
+ * matches the strings of the fixed size only. The first and the last segments
+ * are matched at the start and at the end of the string, and each of the
+ * remaining segments is searched for leftmost after the preceding one. Since
+ * `*` matches anything, the leftmost matches are always the right choice and
+ * there is no backtracking. To find the segment, its longest literal is
+ * searched by the vectorized substring search first.
+ */
+class Glob final {
+public:
+  /// The size type.
+  using size_type = std::size_t;
+
+  /// Constructs the pattern which matches the empty string only.
+  Glob()
+    : Glob{std::string_view{}}
+  {}
+
+  /// Compiles `pattern`.
+  explicit Glob(const std::string_view pattern)
+    : pattern_{pattern}
+  {
+    segments_.emplace_back();
+    for (std::size_t i{}; i < pattern.size();) {
+      const auto ch = pattern[i];
+      if (ch == '*') {
+        has_star_ = true;
+        finish_segment();
+        segments_.emplace_back();
+        for (; i < pattern.size() && pattern[i] == '*'; ++i);
+      } else if (ch == '?') {
+        auto& seg = segments_.back();
+        if (seg.item_count && items_.back().kind == Kind::any)
+          ++items_.back().size;
+        else
+          add_item(Item{Kind::any, 0, 1});
+        ++i;
+      } else if (ch == '[' && parse_set(pattern, i)) {
+        continue;
+      } else {
+        if (ch == '\\' && i + 1 < pattern.size())
+          ++i;
+        add_literal(pattern[i]);
+        ++i;
+      }
+    }
+    finish_segment();
+  }
+
+  /// @returns The source pattern.
+  const std::string& pattern() const noexcept
+  {
+    return pattern_;
+  }
+
+  /// @returns The minimum size of the matching string.
+  size_type min_size() const noexcept
+  {
+    return min_size_;
+  }
+
+  /// @returns `true` if `str` matches the pattern.
+  bool is_match(const std::string_view str) const noexcept
+  {
+    const auto& first = segments_.front();
+    if (!has_star_)
+      return str.size() == first.size && is_match(first, str.data());
+    else if (str.size() < min_size_)
+      return false;
+
+    const auto& last = segments_.back();
+    if (!is_match(first, str.data())
+      || !is_match(last, str.data() + str.size() - last.size))
+      return false;
+
+    std::size_t pos{first.size};
+    const auto end = str.size() - last.size;
+    for (std::size_t s{1}; s + 1 < segments_.size(); ++s) {
+      const auto& seg = segments_[s];
+      const auto found = find(seg, str, pos, end);
+      if (found == npos)
+        return false;
+      pos = found + seg.size;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Calls `f(index)` for each string of `strings` which matches the
+   * pattern in the order of strings.
+   *
+   * @par Requires
+   * The elements of `strings` are convertible to `std::string_view`.
+   */
+  template<class Range, typename F>
+  void for_each_match(const Range& strings, F&& f) const
+  {
+    size_type index{};
+    for (const auto& s : strings) {
+      if (is_match(std::string_view{s}))
+        f(index);
+      ++index;
+    }
+  }
+
+  /// @returns The indices of `strings` which match the pattern.
+  template<class Range>
+  std::vector<size_type> match(const Range& strings) const
+  {
+    std::vector<size_type> result;
+    for_each_match(strings, [&result](const size_type index)
+    {
+      result.push_back(index);
+    });
+    return result;
+  }
+
+private:
+  static constexpr auto npos = static_cast<std::size_t>(-1);
+
+  enum class Kind : std::uint8_t {
+    literal = 1,
+    any,
+    set
+  };
+
+  /// The literal, the run of `?` or the character set of the segment.
+  struct Item final {
+    Kind kind{};
+    std::uint32_t offset{}; // of literal in literals_, or index of set
+    std::uint32_t size{};
+  };
+
+  /// The sequence of items between the stars.
+  struct Segment final {
+    std::uint32_t first_item{};
+    std::uint32_t item_count{};
+    std::size_t size{};
+    std::uint32_t literal{}; // the index of the longest literal item + 1
+    std::size_t literal_offset{};
+  };
+
+  std::string pattern_;
+  std::string literals_;
+  std::vector<Item> items_;
+  std::vector<Segment> segments_;
+  std::vector<Byte_set> sets_;
+  std::size_t min_size_{};
+  bool has_star_{};
+
+  // ---------------------------------------------------------------------------
+  // Compilation
+  // ---------------------------------------------------------------------------
+
+  void add_item(const Item item)
+  {
+    auto& seg = segments_.back();
+    if (!seg.item_count)
+      seg.first_item = static_cast<std::uint32_t>(items_.size());
+    items_.push_back(item);
+    ++seg.item_count;
+  }
+
+  void add_literal(const char ch)
+  {
+    auto& seg = segments_.back();
+    if (seg.item_count && items_.back().kind == Kind::literal)
+      ++items_.back().size;
+    else
+      add_item(Item{Kind::literal,
+        static_cast<std::uint32_t>(literals_.size()), 1});
+    literals_.push_back(ch);
+  }
+
+  /// Computes the size and the longest literal of the last segment.
+  void finish_segment() noexcept
+  {
+    auto& seg = segments_.back();
+    std::size_t longest{};
+    for (auto i = seg.first_item; i < seg.first_item + seg.item_count; ++i) {
+      const auto& item = items_[i];
+      if (item.kind == Kind::literal && item.size > longest) {
+        longest = item.size;
+        seg.literal = i + 1;
+        seg.literal_offset = seg.size;
+      }
+      seg.size += item.size;
+    }
+    min_size_ += seg.size;
+  }
+
+  /**
+   * @brief Parses the bracket expression at `pattern[i]` and advances `i`
+   * past it.
+   *
+   * @returns `false` if there is no closing bracket.
+   */
+  bool parse_set(const std::string_view pattern, std::size_t& i)
+  {
+    Byte_set set;
+    auto j = i + 1;
+    const bool is_negated{j < pattern.size()
+      && (pattern[j] == '!' || pattern[j] == '^')};
+    if (is_negated)
+      ++j;
+    for (bool is_first{true}; j < pattern.size(); is_first = false) {
+      auto ch = static_cast<unsigned char>(pattern[j]);
+      if (ch == ']' && !is_first) {
+        if (is_negated)
+          set = set.complement();
+        sets_.push_back(set);
+        add_item(Item{Kind::set, static_cast<std::uint32_t>(sets_.size() - 1), 1});
+        i = j + 1;
+        return true;
+      } else if (ch == '[' && j + 1 < pattern.size() && pattern[j + 1] == ':') {
+        const auto end = pattern.find(":]", j + 2);
+        if (end != std::string_view::npos
+          && insert_class(set, pattern.substr(j + 2, end - j - 2))) {
+          j = end + 2;
+          continue;
+        }
+      } else if (ch == '\\' && j + 1 < pattern.size())
+        ch = static_cast<unsigned char>(pattern[++j]);
+      ++j;
+
+      // Parse the range.
+      if (j + 1 < pattern.size() && pattern[j] == '-' && pattern[j + 1] != ']') {
+        auto last = static_cast<unsigned char>(pattern[j + 1]);
+        j += 2;
+        if (last == '\\' && j < pattern.size())
+          last = static_cast<unsigned char>(pattern[j++]);
+        for (unsigned c{ch}; c <= last; ++c)
+          set.insert(static_cast<unsigned char>(c));
+      } else
+        set.insert(ch);
+    }
+    return false;
+  }
+
+  /// Inserts the characters of the class `name` to `set`.
+  static bool insert_class(Byte_set& set, const std::string_view name)
+  {
+    using Predicate = int(*)(int);
+    static const std::pair<std::string_view, Predicate> classes[]{
+      {"alnum", [](const int c){return std::isalnum(c);}},
+      {"alpha", [](const int c){return std::isalpha(c);}},
+      {"blank", [](const int c){return std::isblank(c);}},
+      {"cntrl", [](const int c){return std::iscntrl(c);}},
+      {"digit", [](const int c){return std::isdigit(c);}},
+      {"graph", [](const int c){return std::isgraph(c);}},
+      {"lower", [](const int c){return std::islower(c);}},
+      {"print", [](const int c){return std::isprint(c);}},
+      {"punct", [](const int c){return std::ispunct(c);}},
+      {"space", [](const int c){return std::isspace(c);}},
+      {"upper", [](const int c){return std::isupper(c);}},
+      {"xdigit", [](const int c){return std::isxdigit(c);}}};
+    for (const auto& [class_name, predicate] : classes) {
+      if (name == class_name) {
+        for (int c{}; c < 128; ++c) {
+          if (predicate(c))
+            set.insert(static_cast<unsigned char>(c));
+        }
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // ---------------------------------------------------------------------------
+  // Matching
+  // ---------------------------------------------------------------------------
+
+  /**
+   * @returns `true` if the segment matches the string at `str`.
+   *
+   * @par Requires
+   * `str` points to at least `seg.size` characters.
+   */
+  bool is_match(const Segment& seg, const char* str) const noexcept
+  {
+    for (auto i = seg.first_item; i < seg.first_item + seg.item_count; ++i) {
+      const auto& item = items_[i];
+      switch (item.kind) {
+      case Kind::literal:
+        if (std::memcmp(str, literals_.data() + item.offset, item.size))
+          return false;
+        break;
+      case Kind::any:
+        break;
+      case Kind::set:
+        if (!sets_[item.offset].contains(static_cast<unsigned char>(*str)))
+          return false;
+        break;
+      }
+      str += item.size;
+    }
+    return true;
+  }
+
+  /// @returns The leftmost position of `seg` in `str[pos, end)`, or `npos`.
+  std::size_t find(const Segment& seg, const std::string_view str,
+    const std::size_t pos, const std::size_t end) const noexcept
+  {
+    if (end - pos < seg.size)
+      return npos;
+
+    const auto last = end - seg.size; // the last position to check
+    if (!seg.literal) {
+      for (auto p = pos; p <= last; ++p) {
+        if (is_match(seg, str.data() + p))
+          return p;
+      }
+      return npos;
+    }
+
+    const auto& literal = items_[seg.literal - 1];
+    const auto* const needle = literals_.data() + literal.offset;
+    for (auto p = pos; p <= last;) {
+      const auto offset = detail::search(str.data() + p + seg.literal_offset,
+        last - p + literal.size, needle, literal.size);
+      if (offset == npos)
+        return npos;
+      p += offset;
+      if (is_match(seg, str.data() + p))
+        return p;
+      ++p;
+    }
+    return npos;
+  }
+};
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_GLOB_HPP
@@ -0,0 +1,181 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_GREP_HPP
+#define DMITIGR_STR_GREP_HPP
+
+#include "aho_corasick.hpp"
+#include "parallel.hpp"
+#include "simd.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace dmitigr::str {
+
+/// The matching line.
+struct Line_match final {
+  /// The line number (which starts at 0).
+  std::size_t number{};
+
+  /// The line without the delimiter.
+  std::string_view line;
+};
+
+namespace detail {
+
+/// The minimum number of bytes which are searched by the single thread.
+constexpr std::size_t grep_parallel_threshold{1 << 20};
+
+/**
+ * @returns The matching lines of `text` in the order of lines.
+ *
+ * @details The text is splitted into nearly equal chunks which end with
+ * `delimiter` (except the last one), and the chunks are searched concurrently.
+ * The call `find_line(chunk, pos)` must return the bounds `[begin, end)` of
+ * the next matching line of `chunk` which starts at or after `pos`, where
+ * `end` is the position of delimiter or `chunk.size()`, or the `begin` which
+ * equals to `npos` if there is no such a line. The numbers of lines which are
+ * skipped between the matching lines are computed by counting the delimiters,
+ * and the numbers of chunk lines are offset by the prefix sum of numbers of
+ * delimiters of preceding chunks.
+ */
+template<class Find>
+std::vector<Line_match> grep(const std::string_view text,
+  unsigned thread_count, const char delimiter, const Find& find_line)
+{
+  constexpr auto npos = std::string_view::npos;
+  thread_count = static_cast<unsigned>(std::max<std::size_t>(1,
+    std::min<std::size_t>(thread_count_or_default(thread_count),
+      text.size() / grep_parallel_threshold)));
+
+  // Compute the chunk bounds aligned to the lines.
+  std::vector<std::size_t> bounds(thread_count + 1, text.size());
+  bounds[0] = 0;
+  for (unsigned t{1}; t < thread_count; ++t) {
+    const auto pos = std::max(part_bounds(text.size(), thread_count, t).first,
+      bounds[t - 1]);
+    const auto delim = text.find(delimiter, pos);
+    bounds[t] = delim != npos ? delim + 1 : text.size();
+  }
+
+  // Search the chunks.
+  std::vector<std::vector<Line_match>> matches(thread_count);
+  std::vector<std::size_t> line_counts(thread_count);
+  run_parallel(thread_count, [&](const unsigned t)
+  {
+    const auto chunk = text.substr(bounds[t], bounds[t + 1] - bounds[t]);
+    const auto* const data = chunk.data();
+    auto& result = matches[t];
+    std::size_t line{};
+    std::size_t pos{};
+    while (pos < chunk.size()) {
+      const auto [begin, end] = find_line(chunk, pos);
+      if (begin == npos)
+        break;
+      line += count_byte(data + pos, data + begin, delimiter);
+      result.push_back(Line_match{line, chunk.substr(begin, end - begin)});
+      line += end < chunk.size();
+      pos = end + 1;
+    }
+    if (pos < chunk.size())
+      line += count_byte(data + pos, data + chunk.size(), delimiter);
+    line_counts[t] = line;
+  });
+
+  // Concatenate the results and offset the line numbers.
+  std::size_t size{};
+  for (const auto& m : matches)
+    size += m.size();
+  std::vector<Line_match> result;
+  result.reserve(size);
+  std::size_t offset{};
+  for (unsigned t{}; t < thread_count; ++t) {
+    for (auto match : matches[t]) {
+      match.number += offset;
+      result.push_back(match);
+    }
+    offset += line_counts[t];
+  }
+  return result;
+}
+
+} // namespace detail
+
+/**
+ * @returns The lines of `text` for which `predicate(line)` returns `true`,
+ * in the order of lines. The lines are separated by `delimiter`, and the
+ * delimiter at the end of `text` doesn't start the new line.
+ *
+ * @details The search is performed by up to `thread_count` threads, or
+ * `std::thread::hardware_concurrency()` threads if `thread_count == 0`. Each
+ * thread handles its own range of lines, so `predicate` must be safe to call
+ * concurrently. To search the file without reading it, pass the content of
+ * the Mapped_file.
+ *
+ * @par Requires
+ * `predicate` is callable with `std::string_view` argument.
+ */
+template<class Predicate>
+std::vector<Line_match> grep(const std::string_view text,
+  const Predicate& predicate, const unsigned thread_count = 1,
+  const char delimiter = '\n')
+{
+  return detail::grep(text, thread_count, delimiter,
+    [&predicate, delimiter](const std::string_view chunk, std::size_t pos)
+    {
+      const auto* const data = chunk.data();
+      while (pos < chunk.size()) {
+        const auto* const delim = static_cast<const char*>(
+          std::memchr(data + pos, delimiter, chunk.size() - pos));
+        const std::size_t end = delim ? delim - data : chunk.size();
+        if (predicate(chunk.substr(pos, end - pos)))
+          return std::make_pair(pos, end);
+        pos = end + 1;
+      }
+      return std::make_pair(std::string_view::npos, chunk.size());
+    });
+}
+
+/**
+ * @overload
+ *
+ * @returns The lines of `text` which contain any of the patterns of `matcher`.
+ *
+ * @details Unlike the version with the predicate, `matcher` runs over the
+ * whole chunks, so the non-matching lines are never visited one by one.
+ *
+ * @par Requires
+ * The patterns of `matcher` don't contain `delimiter`.
+ */
+inline std::vector<Line_match> grep(const std::string_view text,
+  const Aho_corasick& matcher, const unsigned thread_count = 1,
+  const char delimiter = '\n')
+{
+  return detail::grep(text, thread_count, delimiter,
+    [&matcher, delimiter](const std::string_view chunk, const std::size_t pos)
+    {
+      return detail::find_matching_line(matcher, chunk, pos, delimiter);
+    });
+}
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_GREP_HPP
@@ -0,0 +1,377 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_JSON_HPP
+#define DMITIGR_STR_JSON_HPP
+
+#include "exceptions.hpp"
+#include "numeric.hpp"
+#include "simd.hpp"
+#include "utf8.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dmitigr::str {
+
+// -----------------------------------------------------------------------------
+// JSON strings
+// -----------------------------------------------------------------------------
+
+/// @returns The maximum size of the result of json_escape() of `size` bytes.
+constexpr std::size_t json_escaped_max_size(const std::size_t size) noexcept
+{
+  return size * 6; // \u00XX
+}
+
+/**
+ * @brief Writes `str` escaped as the content of JSON string (without the
+ * enclosing quotes) to `out`.
+ *
+ * @details Only `"`, `\` and the control characters (below 0x20) are escaped,
+ * so the UTF-8 sequences are written as is. The runs of characters which are
+ * not escaped are found by the vectorized search and copied at once.
+ *
+ * @returns The number of bytes written.
+ *
+ * @par Requires
+ * `out` has space for `json_escaped_max_size(str.size())` bytes.
+ */
+inline std::size_t json_escape(const std::string_view str,
+  char* const out) noexcept
+{
+  const char* p{str.data()};
+  const char* const e{p + str.size()};
+  char* o{out};
+  while (true) {
+    const auto* const s = detail::find_control_or_any_byte(p, e, "\"\\", 2);
+    if (s != p) {
+      std::memcpy(o, p, static_cast<std::size_t>(s - p));
+      o += s - p;
+    }
+    if (s == e)
+      break;
+
+    const auto ch = static_cast<unsigned char>(*s);
+    *o++ = '\\';
+    switch (ch) {
+    case '"': *o++ = '"'; break;
+    case '\\': *o++ = '\\'; break;
+    case '\b': *o++ = 'b'; break;
+    case '\f': *o++ = 'f'; break;
+    case '\n': *o++ = 'n'; break;
+    case '\r': *o++ = 'r'; break;
+    case '\t': *o++ = 't'; break;
+    default:
+      std::memcpy(o, "u00", 3);
+      o[3] = detail::lower_hex_digits[ch >> 4];
+      o[4] = detail::lower_hex_digits[ch & 0xF];
+      o += 5;
+    }
+    p = s + 1;
+  }
+  return static_cast<std::size_t>(o - out);
+}
+
+/// @returns `str` escaped as the content of JSON string.
+inline std::string to_json_escaped(const std::string_view str)
+{
+  std::string result(json_escaped_max_size(str.size()), '\0');
+  result.resize(json_escape(str, result.data()));
+  return result;
+}
+
+/**
+ * @brief Writes the content of JSON string `str` (without the enclosing
+ * quotes) with the escape sequences replaced by the characters they denote
+ * to `out`.
+ *
+ * @details The `\uXXXX` sequences are written in UTF-8, the surrogate pairs
+ * are combined, and the unpaired surrogates are replaced with
+ * `utf8::replacement_character`. The runs of characters without escapes are
+ * copied at once.
+ *
+ * @returns The number of bytes written.
+ *
+ * @par Requires
+ * `out` has space for `str.size()` bytes.
+ *
+ * @throws Exception if `str` contains the invalid escape sequence.
+ */
+inline std::size_t json_unescape(const std::string_view str, char* const out)
+{
+  const auto invalid = []
+  {
+    throw Exception{"cannot unescape JSON string with invalid escape sequence"};
+  };
+
+  if (str.empty())
+    return 0;
+
+  const char* p{str.data()};
+  const char* const e{p + str.size()};
+  char* o{out};
+  while (true) {
+    const auto* s = static_cast<const char*>(
+      std::memchr(p, '\\', static_cast<std::size_t>(e - p)));
+    if (!s)
+      s = e;
+    if (s != p) {
+      std::memcpy(o, p, static_cast<std::size_t>(s - p));
+      o += s - p;
+    }
+    if (s == e)
+      break;
+    else if (e - s < 2)
+      invalid();
+
+    p = s + 2;
+    switch (s[1]) {
+    case '"': *o++ = '"'; break;
+    case '\\': *o++ = '\\'; break;
+    case '/': *o++ = '/'; break;
+    case 'b': *o++ = '\b'; break;
+    case 'f': *o++ = '\f'; break;
+    case 'n': *o++ = '\n'; break;
+    case 'r': *o++ = '\r'; break;
+    case 't': *o++ = '\t'; break;
+    case 'u': {
+      const auto cp = utf8::detail::read_unicode_escape(p, e);
+      if (!cp)
+        invalid();
+      o += utf8::encode(*cp >= 0xD800 && *cp <= 0xDFFF ?
+        utf8::replacement_character : *cp, o);
+      break;
+    }
+    default:
+      invalid();
+    }
+  }
+  return static_cast<std::size_t>(o - out);
+}
+
+/**
+ * @returns The content of JSON string `str` with the escape sequences
+ * replaced by the characters they denote.
+ *
+ * @see json_unescape().
+ */
+inline std::string to_json_unescaped(const std::string_view str)
+{
+  std::string result(str.size(), '\0');
+  result.resize(json_unescape(str, result.data()));
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+// JSON structural index
+// -----------------------------------------------------------------------------
+
+namespace detail {
+
+/**
+ * @returns The mask of characters of the block which are escaped by the
+ * backslashes of `backslash` mask, i.e. which follow the odd sequences of
+ * backslashes.
+ *
+ * @param escaped_carry The indicator that the first character of the block is
+ * escaped, which is updated for the next block.
+ */
+inline std::uint64_t json_escaped_mask(std::uint64_t backslash,
+  std::uint64_t& escaped_carry) noexcept
+{
+  constexpr std::uint64_t even_bits{0x5555555555555555};
+  backslash &= ~escaped_carry;
+  const auto follows_escape = backslash << 1 | escaped_carry;
+  const auto odd_sequence_starts = backslash & ~even_bits & ~follows_escape;
+  const auto sequences_starting_on_even_bits = odd_sequence_starts + backslash;
+  escaped_carry = sequences_starting_on_even_bits < odd_sequence_starts;
+  const auto invert_mask = sequences_starting_on_even_bits << 1;
+  return (even_bits ^ invert_mask) & follows_escape;
+}
+
+/// @returns The mask where each bit is the XOR of itself and all lower bits.
+inline std::uint64_t prefix_xor(std::uint64_t value) noexcept
+{
+  for (unsigned shift{1}; shift < 64; shift *= 2)
+    value ^= value << shift;
+  return value;
+}
+
+} // namespace detail
+
+/**
+ * @brief The index of structural characters of JSON text.
+ *
+ * @details This is the first stage of parsing of the parsers like simdjson.
+ * The text is classified by the blocks of 64 bytes at once: the masks of
+ * quotes, backslashes, operators (`{}[]:,`) and white spaces are computed by
+ * the vectorized comparisons, the escaped quotes are excluded, and the mask
+ * of the string contents is computed as the prefix XOR of quotes. The index
+ * consists of the positions of operators outside the strings, opening quotes
+ * and starts of the other scalars (numbers, `true`, `false` and `null`).
+ *
+ * The text is not validated, but the queries never read out of bounds of the
+ * invalid text.
+ */
+class Json_index final {
+public:
+  /// The size type.
+  using size_type = std::size_t;
+
+  /// Constructs the index of the empty text.
+  Json_index() = default;
+
+  /// Constructs the index of `json`.
+  explicit Json_index(const std::string_view json)
+  {
+    assign(json);
+  }
+
+  /**
+   * @brief Indexes `json` by reusing the memory of the index.
+   *
+   * @par Requires
+   * `json.size() <= std::numeric_limits<std::uint32_t>::max()`.
+   *
+   * @throws Exception if `json` ends within the string.
+   */
+  void assign(const std::string_view json)
+  {
+    if (json.size() > std::numeric_limits<std::uint32_t>::max())
+      throw Exception{"cannot index JSON text larger than 4 GiB"};
+
+    json_ = json;
+    positions_.clear();
+    std::uint64_t escaped_carry{};
+    std::uint64_t string_carry{};
+    std::uint64_t scalar_carry{};
+    char tail[64];
+    for (size_type offset{}; offset < json.size(); offset += 64) {
+      const char* block{json.data() + offset};
+      if (json.size() - offset < 64) {
+        std::memset(tail, ' ', sizeof(tail));
+        std::memcpy(tail, block, json.size() - offset);
+        block = tail;
+      }
+
+      const auto backslash = detail::any_byte_mask64(block, "\\", 1);
+      const auto escaped = detail::json_escaped_mask(backslash, escaped_carry);
+      const auto quotes = detail::any_byte_mask64(block, "\"", 1) & ~escaped;
+      const auto in_string = detail::prefix_xor(quotes) ^ string_carry;
+      string_carry = static_cast<std::uint64_t>(
+        static_cast<std::int64_t>(in_string) >> 63);
+
+      const auto ops = detail::any_byte_mask64(block, "{}[]:,", 6);
+      const auto spaces = detail::any_byte_mask64(block, " \t\n\r", 4);
+      const auto scalars = ~(ops | spaces | quotes | in_string);
+      const auto scalar_starts = scalars & ~(scalars << 1 | scalar_carry);
+      scalar_carry = scalars >> 63;
+
+      auto structurals = (ops & ~in_string) | (quotes & in_string) | scalar_starts;
+      for (; structurals; structurals &= structurals - 1)
+        positions_.push_back(static_cast<std::uint32_t>(
+          offset + detail::ctz64(structurals)));
+    }
+    if (string_carry)
+      throw Exception{"cannot index JSON text with unterminated string"};
+  }
+
+  /// @returns The indexed text.
+  std::string_view json() const noexcept
+  {
+    return json_;
+  }
+
+  /// @returns The positions of structural characters in increasing order.
+  const std::vector<std::uint32_t>& positions() const noexcept
+  {
+    return positions_;
+  }
+
+  /**
+   * @returns The value of the member `key` of the top-level object as the
+   * view of JSON text (strings are enclosed in quotes and not unescaped), or
+   * `std::nullopt` if there is no such a member or if the text is not an
+   * object.
+   *
+   * @details The members are examined in order without building the tree of
+   * values: the nested objects and arrays are skipped by the nesting level of
+   * their structural characters only. The keys with escape sequences are
+   * compared unescaped.
+   */
+  std::optional<std::string_view> find(const std::string_view key) const
+  {
+    const auto& p = positions_;
+    const auto at = [this, &p](const size_type i)
+    {
+      return json_[p[i]];
+    };
+    if (p.empty() || at(0) != '{')
+      return std::nullopt;
+
+    for (size_type i{1}; i + 2 < p.size() && at(i) == '"' && at(i + 1) == ':';) {
+      // The closing quote of the key is the last quote before the colon.
+      const auto key_begin = p[i] + size_type{1};
+      const auto key_end = json_.rfind('"', p[i + 1]);
+      const auto raw_key = json_.substr(key_begin,
+        key_end > key_begin ? key_end - key_begin : 0);
+
+      // Find the value.
+      const auto value = i + 2;
+      auto next = value + 1;
+      size_type end{};
+      if (at(value) == '{' || at(value) == '[') {
+        size_type depth{1};
+        for (; next < p.size() && depth; ++next) {
+          const auto ch = at(next);
+          depth += ch == '{' || ch == '[';
+          depth -= ch == '}' || ch == ']';
+        }
+        if (depth)
+          return std::nullopt;
+        end = p[next - 1] + size_type{1};
+      } else {
+        end = next < p.size() ? p[next] : json_.size();
+        const auto last = json_.find_last_not_of(" \t\n\r", end - 1);
+        end = last != std::string_view::npos && last >= p[value] ? last + 1 : end;
+      }
+
+      if (raw_key.find('\\') == std::string_view::npos ?
+        raw_key == key : to_json_unescaped(raw_key) == key)
+        return json_.substr(p[value], end - p[value]);
+
+      if (next >= p.size() || at(next) != ',')
+        break;
+      i = next + 1;
+    }
+    return std::nullopt;
+  }
+
+private:
+  std::string_view json_;
+  std::vector<std::uint32_t> positions_;
+};
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_JSON_HPP
@@ -0,0 +1,201 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_MAPPED_FILE_HPP
+#define DMITIGR_STR_MAPPED_FILE_HPP
+
+#include "../base/fsx.hpp"
+#include "exceptions.hpp"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace dmitigr::str {
+
+/**
+ * @brief The read-only memory mapped file.
+ *
+ * @details The content of file can be accessed without copying it into the
+ * memory of process, so the large files can be processed without reading.
+ */
+class Mapped_file final {
+public:
+  /// Constructs not opened instance.
+  Mapped_file() = default;
+
+  /**
+   * @brief Maps the file at `path` into the memory.
+   *
+   * @par Effects
+   * `is_open()`.
+   */
+  explicit Mapped_file(const std::filesystem::path& path)
+  {
+    const auto error = [&path]
+    {
+      return Exception{"cannot map file \"" + path.generic_string() + "\""};
+    };
+#ifdef _WIN32
+    const HANDLE file{CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+      nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr)};
+    if (file == INVALID_HANDLE_VALUE)
+      throw error();
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+      CloseHandle(file);
+      throw error();
+    }
+    size_ = static_cast<std::size_t>(size.QuadPart);
+    if (size_) {
+      const HANDLE mapping{CreateFileMappingW(file, nullptr, PAGE_READONLY,
+        0, 0, nullptr)};
+      CloseHandle(file);
+      if (!mapping)
+        throw error();
+      data_ = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ,
+        0, 0, 0));
+      CloseHandle(mapping);
+      if (!data_)
+        throw error();
+    } else
+      CloseHandle(file);
+#else
+    const int fd{::open(path.c_str(), O_RDONLY)};
+    if (fd < 0)
+      throw error();
+    struct stat st;
+    if (::fstat(fd, &st)) {
+      ::close(fd);
+      throw error();
+    }
+    size_ = static_cast<std::size_t>(st.st_size);
+    if (size_) {
+      void* const data{::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0)};
+      ::close(fd);
+      if (data == MAP_FAILED)
+        throw error();
+      data_ = static_cast<const char*>(data);
+    } else
+      ::close(fd);
+#endif
+    is_open_ = true;
+  }
+
+  /// The destructor.
+  ~Mapped_file()
+  {
+    close();
+  }
+
+  /// Non copy-constructible.
+  Mapped_file(const Mapped_file&) = delete;
+
+  /// Non copy-assignable.
+  Mapped_file& operator=(const Mapped_file&) = delete;
+
+  /// The move constructor.
+  Mapped_file(Mapped_file&& rhs) noexcept
+    : data_{std::exchange(rhs.data_, nullptr)}
+    , size_{std::exchange(rhs.size_, 0)}
+    , is_open_{std::exchange(rhs.is_open_, false)}
+  {}
+
+  /// The move assignment operator.
+  Mapped_file& operator=(Mapped_file&& rhs) noexcept
+  {
+    if (this != &rhs) {
+      Mapped_file tmp{std::move(rhs)};
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  /// Swaps `*this` with `other`.
+  void swap(Mapped_file& other) noexcept
+  {
+    using std::swap;
+    swap(data_, other.data_);
+    swap(size_, other.size_);
+    swap(is_open_, other.is_open_);
+  }
+
+  /**
+   * @brief Unmaps the file.
+   *
+   * @par Effects
+   * `!is_open()`.
+   */
+  void close() noexcept
+  {
+    if (data_) {
+#ifdef _WIN32
+      UnmapViewOfFile(data_);
+#else
+      ::munmap(const_cast<char*>(data_), size_);
+#endif
+    }
+    data_ = nullptr;
+    size_ = 0;
+    is_open_ = false;
+  }
+
+  /// @returns `true` if the file is mapped.
+  bool is_open() const noexcept
+  {
+    return is_open_;
+  }
+
+  /// @returns The pointer to the content of file, or `nullptr` if it's empty.
+  const char* data() const noexcept
+  {
+    return data_;
+  }
+
+  /// @returns The size of file.
+  std::size_t size() const noexcept
+  {
+    return size_;
+  }
+
+  /// @returns The view of the content of file.
+  std::string_view view() const noexcept
+  {
+    return {data_, size_};
+  }
+
+private:
+  const char* data_{};
+  std::size_t size_{};
+  bool is_open_{};
+};
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_MAPPED_FILE_HPP
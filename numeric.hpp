@@ -20,8 +20,12 @@
 #include "exceptions.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <limits>
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <type_traits>
 
 namespace dmitigr::str {
@@ -37,9 +41,11 @@ namespace dmitigr::str {
  * @par Requires
  * `(2 <= base && base <= 36)`.
  */
-template<typename Number>
-std::enable_if_t<std::is_integral<Number>::value, std::string>
-to_string(Number value, const Number base = 10)
+template<typename CharT, class Traits = std::char_traits<CharT>,
+  class Allocator = std::allocator<CharT>, typename Number>
+std::enable_if_t<std::is_integral<Number>::value,
+  std::basic_string<CharT, Traits, Allocator>>
+to_basic_string(const Number value, const Number base = 10)
 {
   static_assert(std::numeric_limits<Number>::min() <= 2 &&
     std::numeric_limits<Number>::max() >= 36);
@@ -53,22 +59,289 @@ to_string(Number value, const Number base = 10)
      'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T',
      'U', 'V', 'W', 'X', 'Y', 'Z'};
   static_assert(sizeof(digits) == 36);
+
+  // The digits are written from the end of the buffer, so the result is
+  // created at once without reversing.
+  using Unsigned = std::make_unsigned_t<Number>;
   const bool negative = (value < 0);
-  std::string result;
+  auto uvalue = negative ? static_cast<Unsigned>(Unsigned{} -
+    static_cast<Unsigned>(value)) : static_cast<Unsigned>(value);
+  const auto ubase = static_cast<Unsigned>(base);
+  CharT buf[std::numeric_limits<Unsigned>::digits + 1];
+  CharT* const e = buf + sizeof(buf) / sizeof(CharT);
+  CharT* p = e;
+  do {
+    *--p = static_cast<CharT>(digits[uvalue % ubase]);
+    uvalue /= ubase;
+  } while (uvalue);
   if (negative)
-    value = -value;
-  while (value >= base) {
-    const auto rem = value % base;
-    value /= base;
-    result += digits[rem];
+    *--p = static_cast<CharT>('-');
+  return std::basic_string<CharT, Traits, Allocator>(p, e);
+}
+
+/**
+ * @returns The string with the character representation
+ * of the `value` according to the given `base`.
+ *
+ * @par Requires
+ * `(2 <= base && base <= 36)`.
+ */
+template<typename Number>
+std::enable_if_t<std::is_integral<Number>::value, std::string>
+to_string(const Number value, const Number base = 10)
+{
+  return to_basic_string<char>(value, base);
+}
+
+// -----------------------------------------------------------------------------
+// Binary encodings
+// -----------------------------------------------------------------------------
+
+/// Appends `value` encoded as the little-endian integer of `sizeof(UInt)` bytes.
+template<typename UInt>
+std::enable_if_t<std::is_unsigned<UInt>::value>
+append_little_endian(std::string& result, const UInt value)
+{
+  char buf[sizeof(UInt)];
+  for (std::size_t i{}; i < sizeof(UInt); ++i)
+    buf[i] = static_cast<char>(value >> 8*i & 0xFF);
+  result.append(buf, sizeof(buf));
+}
+
+/**
+ * @brief Writes `value` encoded as the little-endian integer of
+ * `sizeof(UInt)` bytes to `p`.
+ *
+ * @par Requires
+ * `p` points to at least `sizeof(UInt)` bytes.
+ */
+template<typename UInt>
+std::enable_if_t<std::is_unsigned<UInt>::value>
+write_little_endian(char* const p, const UInt value) noexcept
+{
+  for (std::size_t i{}; i < sizeof(UInt); ++i)
+    p[i] = static_cast<char>(value >> 8*i & 0xFF);
+}
+
+/**
+ * @returns The little-endian integer of `sizeof(UInt)` bytes at `p`.
+ *
+ * @par Requires
+ * `p` points to at least `sizeof(UInt)` bytes.
+ */
+template<typename UInt>
+std::enable_if_t<std::is_unsigned<UInt>::value, UInt>
+read_little_endian(const char* const p) noexcept
+{
+  UInt result{};
+  for (std::size_t i{}; i < sizeof(UInt); ++i)
+    result |= static_cast<UInt>(static_cast<unsigned char>(p[i])) << 8*i;
+  return result;
+}
+
+/**
+ * @brief Appends `value` encoded as the variable-length integer (LEB128), in
+ * which each byte holds 7 bits of `value` and the indicator of continuation.
+ */
+inline void append_varint(std::string& result, std::uint64_t value)
+{
+  char buf[10];
+  std::size_t size{};
+  for (; value >= 0x80; value >>= 7)
+    buf[size++] = static_cast<char>((value & 0x7F) | 0x80);
+  buf[size++] = static_cast<char>(value);
+  result.append(buf, size);
+}
+
+/**
+ * @returns The variable-length integer at `p`, and advances `p` past it.
+ *
+ * @par Requires
+ * `p` points to the valid encoding produced by append_varint().
+ */
+inline std::uint64_t read_varint(const char*& p) noexcept
+{
+  std::uint64_t result{};
+  for (unsigned shift{}; shift < 64; shift += 7) {
+    const auto byte = static_cast<unsigned char>(*p++);
+    result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80))
+      break;
   }
-  result += digits[value];
-  if (negative)
-    result += '-';
-  std::reverse(begin(result), end(result));
   return result;
 }
 
+/**
+ * @overload
+ *
+ * @returns The variable-length integer at `p`, or `std::nullopt` if the
+ * encoding is invalid or isn't terminated before `end`. Advances `p` past the
+ * integer on success.
+ */
+inline std::optional<std::uint64_t> read_varint(const char*& p,
+  const char* const end) noexcept
+{
+  std::uint64_t result{};
+  for (unsigned shift{}; shift < 64 && p + shift / 7 < end; shift += 7) {
+    const auto byte = static_cast<unsigned char>(p[shift / 7]);
+    result |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) {
+      p += shift / 7 + 1;
+      return result;
+    }
+  }
+  return std::nullopt;
+}
+
+// -----------------------------------------------------------------------------
+// Hexadecimal digits
+// -----------------------------------------------------------------------------
+
+namespace detail {
+
+/// The lowercase hexadecimal digits.
+inline constexpr char lower_hex_digits[]{"0123456789abcdef"};
+
+/// The uppercase hexadecimal digits.
+inline constexpr char upper_hex_digits[]{"0123456789ABCDEF"};
+
+/// @returns The value of hexadecimal digit `ch`, or 16 if `ch` is not a digit.
+constexpr unsigned hex_digit_value(const char ch) noexcept
+{
+  if (ch >= '0' && ch <= '9')
+    return static_cast<unsigned>(ch - '0');
+  else if (ch >= 'a' && ch <= 'f')
+    return static_cast<unsigned>(ch - 'a' + 10);
+  else if (ch >= 'A' && ch <= 'F')
+    return static_cast<unsigned>(ch - 'A' + 10);
+  else
+    return 16;
+}
+
+/**
+ * @returns The value of `digit_count` hexadecimal digits at `p`, or
+ * `std::nullopt` if there are no `digit_count` digits before `e`. Advances `p`
+ * past the digits on success.
+ */
+inline std::optional<std::uint32_t> read_hex_digits(const char*& p,
+  const char* const e, const int digit_count) noexcept
+{
+  if (e - p < digit_count)
+    return std::nullopt;
+  std::uint32_t result{};
+  for (int i{}; i < digit_count; ++i) {
+    const auto digit = hex_digit_value(p[i]);
+    if (digit > 15)
+      return std::nullopt;
+    result = result << 4 | digit;
+  }
+  p += digit_count;
+  return result;
+}
+
+/**
+ * @returns The byte denoted by the C-style escape sequence which consists of
+ * the backslash, `ch` and the characters at `p`: `\xh[h]`, `\o[o[o]]`, or
+ * `ch` itself otherwise. Advances `p` past the digits of the sequence.
+ */
+inline char unescape_c_byte(const char ch, const char*& p,
+  const char* const e) noexcept
+{
+  if (ch == 'x') {
+    if (p == e || hex_digit_value(*p) > 15)
+      return ch;
+    unsigned value{hex_digit_value(*p++)};
+    if (p != e && hex_digit_value(*p) < 16)
+      value = value << 4 | hex_digit_value(*p++);
+    return static_cast<char>(value);
+  } else if (ch >= '0' && ch <= '7') {
+    auto value = static_cast<unsigned>(ch - '0');
+    for (int i{}; i < 2 && p != e && *p >= '0' && *p <= '7'; ++i)
+      value = value << 3 | static_cast<unsigned>(*p++ - '0');
+    return static_cast<char>(value & 0xFF);
+  } else
+    return ch;
+}
+
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+// Decimal parsing
+// -----------------------------------------------------------------------------
+
+namespace detail {
+
+/// @returns `true` if each of 8 bytes of `word` is the ASCII digit.
+inline bool is_eight_digits(const std::uint64_t word) noexcept
+{
+  return ((word & 0xF0F0F0F0F0F0F0F0)
+    | (((word + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4))
+    == 0x3333333333333333;
+}
+
+/**
+ * @returns The value of 8 ASCII digits of `word` loaded in little-endian
+ * order (the first digit is the most significant).
+ *
+ * @details Combines the pairs, the quads and the octets of digits by three
+ * multiplications instead of eight.
+ */
+inline std::uint32_t parse_eight_digits(std::uint64_t word) noexcept
+{
+  word -= 0x3030303030303030;
+  word = word * 10 + (word >> 8);
+  word = ((word & 0x000000FF000000FF) * 0x000F424000000064
+    + ((word >> 16) & 0x000000FF000000FF) * 0x0000271000000001) >> 32;
+  return static_cast<std::uint32_t>(word);
+}
+
+} // namespace detail
+
+/**
+ * @returns The value of the decimal integer `str` with the optional sign,
+ * or `std::nullopt` if `str` is not such an integer or if its value is out
+ * of range of `std::int64_t`.
+ *
+ * @details The digits are parsed by 8 at once. The leading zeros are allowed
+ * in any number.
+ */
+inline std::optional<std::int64_t> to_integer(std::string_view str) noexcept
+{
+  const bool is_negative{!str.empty() && str[0] == '-'};
+  if (!str.empty() && (str[0] == '-' || str[0] == '+'))
+    str.remove_prefix(1);
+  if (str.empty())
+    return std::nullopt;
+
+  str.remove_prefix(std::min(str.find_first_not_of('0'), str.size()));
+  if (str.size() > std::numeric_limits<std::int64_t>::digits10 + 1)
+    return std::nullopt;
+
+  std::uint64_t value{};
+  const char* p{str.data()};
+  const char* const e{p + str.size()};
+  for (; e - p >= 8; p += 8) {
+    const auto word = read_little_endian<std::uint64_t>(p);
+    if (!detail::is_eight_digits(word))
+      return std::nullopt;
+    value = value * 100000000 + detail::parse_eight_digits(word);
+  }
+  for (; p != e; ++p) {
+    const auto digit = static_cast<unsigned char>(*p - '0');
+    if (digit > 9)
+      return std::nullopt;
+    value = value * 10 + digit;
+  }
+
+  // The value of 19 digits is less than 2^64.
+  constexpr auto max = static_cast<std::uint64_t>(
+    std::numeric_limits<std::int64_t>::max());
+  if (value > max + is_negative)
+    return std::nullopt;
+  return is_negative ? static_cast<std::int64_t>(0 - value)
+    : static_cast<std::int64_t>(value);
+}
+
 } // namespace dmitigr::str
 
 #endif  // DMITIGR_STR_NUMERIC_HPP
@@ -0,0 +1,98 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_PARALLEL_HPP
+#define DMITIGR_STR_PARALLEL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace dmitigr::str::detail {
+
+/**
+ * @returns `thread_count`, or `std::thread::hardware_concurrency()` if
+ * `thread_count == 0`.
+ */
+inline unsigned thread_count_or_default(const unsigned thread_count) noexcept
+{
+  return thread_count ? thread_count :
+    std::max(std::thread::hardware_concurrency(), 1U);
+}
+
+/**
+ * @brief Calls `f(i)` for each `i` in `[0, count)` concurrently.
+ *
+ * @details The call `f(0)` is made by the calling thread. If a thread cannot
+ * be created, the corresponding calls are made by the calling thread.
+ *
+ * @throws The first exception thrown by `f`, after all of the calls are
+ * completed.
+ */
+template<typename F>
+void run_parallel(const unsigned count, const F& f)
+{
+  if (!count)
+    return;
+
+  std::vector<std::exception_ptr> errors(count);
+  const auto call = [&f, &errors](const unsigned i) noexcept
+  {
+    try {
+      f(i);
+    } catch (...) {
+      errors[i] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  unsigned i{1};
+  try {
+    threads.reserve(count - 1);
+    for (; i < count; ++i)
+      threads.emplace_back(call, i);
+  } catch (...) {}
+  for (unsigned j{i}; j < count; ++j)
+    call(j);
+  call(0);
+  for (auto& thread : threads)
+    thread.join();
+
+  for (const auto& error : errors) {
+    if (error)
+      std::rethrow_exception(error);
+  }
+}
+
+/**
+ * @returns The bounds of the part `i` of `[0, size)` splitted into `count`
+ * nearly equal parts.
+ */
+inline std::pair<std::size_t, std::size_t> part_bounds(const std::size_t size,
+  const std::size_t count, const std::size_t i) noexcept
+{
+  const auto part = size / count;
+  const auto rest = size % count;
+  const auto begin = i * part + std::min(i, rest);
+  return {begin, begin + part + (i < rest)};
+}
+
+} // namespace dmitigr::str::detail
+
+#endif  // DMITIGR_STR_PARALLEL_HPP
@@ -17,20 +17,162 @@
 #ifndef DMITIGR_STR_PREDICATE_HPP
 #define DMITIGR_STR_PREDICATE_HPP
 
+#include "simd.hpp"
+#include "utf8.hpp"
+
 #include <algorithm>
 #include <cctype>
+#include <cwctype>
 #include <string_view>
+#include <type_traits>
 
 namespace dmitigr::str {
 
+// -----------------------------------------------------------------------------
+// Character classification
+// -----------------------------------------------------------------------------
+
+namespace detail {
+
+/// The value is `true` if `CharT` is a type of Unicode code units.
+template<typename CharT>
+constexpr bool is_unicode_unit_v = std::is_same_v<CharT, char16_t>
+  || std::is_same_v<CharT, char32_t>
+#ifdef __cpp_char8_t
+  || std::is_same_v<CharT, char8_t>
+#endif
+  ;
+
+/// @returns `true` if `ch` is a space character.
+template<typename CharT>
+bool is_space(const CharT ch) noexcept
+{
+  if constexpr (std::is_same_v<CharT, char>)
+    return std::isspace(static_cast<unsigned char>(ch));
+  else if constexpr (std::is_same_v<CharT, wchar_t>)
+    return std::iswspace(static_cast<std::wint_t>(ch));
+  else if constexpr (is_unicode_unit_v<CharT>)
+    return sizeof(CharT) == 1 ? is_ascii_space(static_cast<unsigned char>(ch)) :
+      utf8::is_space(static_cast<char32_t>(ch));
+  else
+    return std::isspace(ch);
+}
+
+/// @returns `true` if `ch` is a printable character.
+template<typename CharT>
+bool is_printable(const CharT ch) noexcept
+{
+  if constexpr (std::is_same_v<CharT, char>)
+    return std::isprint(static_cast<unsigned char>(ch));
+  else if constexpr (std::is_same_v<CharT, wchar_t>)
+    return std::iswprint(static_cast<std::wint_t>(ch));
+  else if constexpr (is_unicode_unit_v<CharT>) {
+    // Only the C0 and C1 control characters are considered as non-printable.
+    const auto cp = static_cast<char32_t>(ch);
+    return cp >= 0x20 && cp != 0x7F && (cp < 0x80 || cp >= 0xA0 || sizeof(CharT) == 1);
+  } else
+    return std::isprint(ch);
+}
+
+} // namespace detail
+
+/**
+ * @brief The function object to test if a character is a space character.
+ *
+ * @details The characters of type `char` and `int` are classified according to
+ * the current C locale, `wchar_t` - according to the current C locale as wide
+ * characters, `char8_t` - as ASCII, `char16_t` and `char32_t` - according to
+ * the Unicode property White_Space.
+ */
+struct Is_space final {
+  template<typename CharT>
+  bool operator()(const CharT ch) const noexcept
+  {
+    return detail::is_space(ch);
+  }
+};
+
+/// The function object to test `!Is_space{}(ch)`.
+struct Is_not_space final {
+  template<typename CharT>
+  bool operator()(const CharT ch) const noexcept
+  {
+    return !detail::is_space(ch);
+  }
+};
+
+/**
+ * @brief The function object to test if a character is printable.
+ *
+ * @details The characters are classified like by Is_space except that all
+ * of `char16_t` and `char32_t` characters but C0 and C1 control characters are
+ * considered as printable.
+ */
+struct Is_printable final {
+  template<typename CharT>
+  bool operator()(const CharT ch) const noexcept
+  {
+    return detail::is_printable(ch);
+  }
+};
+
+/// The function object to test `!Is_printable{}(ch)`.
+struct Is_not_printable final {
+  template<typename CharT>
+  bool operator()(const CharT ch) const noexcept
+  {
+    return !detail::is_printable(ch);
+  }
+};
+
+/// The function object to test if a character is printable and not space.
+struct Is_visible final {
+  template<typename CharT>
+  bool operator()(const CharT ch) const noexcept
+  {
+    return detail::is_printable(ch) && !detail::is_space(ch);
+  }
+};
+
+/// The function object to test `!Is_visible{}(ch)`.
+struct Is_not_visible final {
+  template<typename CharT>
+  bool operator()(const CharT ch) const noexcept
+  {
+    return !detail::is_printable(ch) || detail::is_space(ch);
+  }
+};
+
+/// The function object to test if a character is a zero character.
+struct Is_zero final {
+  template<typename CharT>
+  constexpr bool operator()(const CharT ch) const noexcept
+  {
+    return !ch;
+  }
+};
+
+/// The function object to test if a character is a not zero character.
+struct Is_not_zero final {
+  template<typename CharT>
+  constexpr bool operator()(const CharT ch) const noexcept
+  {
+    return ch;
+  }
+};
+
 // -----------------------------------------------------------------------------
 // Predicates
 // -----------------------------------------------------------------------------
 
-/// @returns `true` if `c` is a valid space character.
+/**
+ * @returns `true` if `c` is a valid space character.
+ *
+ * @see Is_space for the characters of other types.
+ */
 inline bool is_space(const int ch) noexcept
 {
-  return std::isspace(ch);
+  return detail::is_space(ch);
 }
 
 /// @returns `!is_space(ch)`.
@@ -39,10 +181,14 @@ inline bool is_not_space(const int ch) noexcept
   return !is_space(ch);
 }
 
-/// @returns `true` if `c` is printable character.
+/**
+ * @returns `true` if `c` is printable character.
+ *
+ * @see Is_printable for the characters of other types.
+ */
 inline bool is_printable(const int ch) noexcept
 {
-  return std::isprint(ch);
+  return detail::is_printable(ch);
 }
 
 /// @returns `!is_printable(ch)`.
@@ -51,10 +197,14 @@ inline bool is_not_printable(const int ch) noexcept
   return !is_printable(ch);
 }
 
-/// @returns `true` if `c` is printable character and not space.
+/**
+ * @returns `true` if `c` is printable character and not space.
+ *
+ * @see Is_visible for the characters of other types.
+ */
 inline bool is_visible(const int ch) noexcept
 {
-  return std::isprint(ch) && is_not_space(ch);
+  return is_printable(ch) && is_not_space(ch);
 }
 
 /// @returns `!is_visible(ch)`.
@@ -76,23 +226,45 @@ inline bool is_not_zero(const int ch) noexcept
 }
 
 /// @returns `true` if `str` is a blank string.
+template<typename CharT, class Traits>
+bool is_blank(const std::basic_string_view<CharT, Traits> str) noexcept
+{
+  return std::all_of(cbegin(str), cend(str), Is_space{});
+}
+
+/// @overload
 inline bool is_blank(const std::string_view str) noexcept
 {
-  return std::all_of(cbegin(str), cend(str), is_space);
+  return is_blank<char, std::string_view::traits_type>(str);
 }
 
 /// @returns `true` if `str` has at least one space character.
+template<typename CharT, class Traits>
+bool has_space(const std::basic_string_view<CharT, Traits> str) noexcept
+{
+  return std::any_of(cbegin(str), cend(str), Is_space{});
+}
+
+/// @overload
 inline bool has_space(const std::string_view str) noexcept
 {
-  return std::any_of(cbegin(str), cend(str), is_space);
+  return has_space<char, std::string_view::traits_type>(str);
 }
 
 /// @returns `true` if `input` is starting with `pattern`.
+template<typename CharT, class Traits>
+bool is_begins_with(const std::basic_string_view<CharT, Traits> input,
+  const std::basic_string_view<CharT, Traits> pattern) noexcept
+{
+  return (pattern.size() <= input.size()) &&
+    !Traits::compare(pattern.data(), input.data(), pattern.size());
+}
+
+/// @overload
 inline bool is_begins_with(const std::string_view input,
   const std::string_view pattern) noexcept
 {
-  return (pattern.size() <= input.size()) &&
-    std::equal(cbegin(pattern), cend(pattern), cbegin(input));
+  return is_begins_with<char, std::string_view::traits_type>(input, pattern);
 }
 
 } // namespace dmitigr::str
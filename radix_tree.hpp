@@ -0,0 +1,569 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_RADIX_TREE_HPP
+#define DMITIGR_STR_RADIX_TREE_HPP
+
+#include "exceptions.hpp"
+#include "simd.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace dmitigr::str {
+
+/**
+ * @brief The compact radix tree (compressed trie) which maps strings to the
+ * values of type `T`.
+ *
+ * @details The keys are copied into the single arena, and the labels of edges
+ * refer to the slices of keys in the arena. The children of the node are
+ * stored in the adaptively sized arrays (as in the adaptive radix tree): up to
+ * 4 or 16 sorted bytes, the 256-byte index of up to 48 children, or the direct
+ * array of 256 children. The children are grown to the next size as needed.
+ *
+ * The lookups don't allocate. The keys are enumerated in the lexicographic
+ * order (bytes are compared as unsigned) as the views into the arena.
+ */
+template<typename T>
+class Radix_tree final {
+public:
+  /// The size type.
+  using size_type = std::size_t;
+
+  /// The value type.
+  using value_type = T;
+
+  /// The result of longest_prefix_match().
+  struct Match final {
+    /// The matched prefix of the string.
+    std::string_view key;
+
+    /// The value of `key`, or `nullptr` if there is no match.
+    const T* value{};
+
+    /// @returns `value != nullptr`.
+    explicit operator bool() const noexcept
+    {
+      return value;
+    }
+  };
+
+  /// Constructs the empty tree.
+  Radix_tree()
+  {
+    nodes_.emplace_back();
+  }
+
+  /**
+   * @brief Constructs the tree of `sorted_items` without splitting the nodes.
+   *
+   * @par Requires
+   * `sorted_items` is a range of pairs of key and value, where keys are
+   * convertible to `std::string_view` and are sorted in strictly increasing
+   * order.
+   */
+  template<class Range>
+  explicit Radix_tree(const Range& sorted_items)
+  {
+    for (const auto& [k, value] : sorted_items) {
+      const std::string_view str{k};
+      if (!entries_.empty() && !(key(entries_.back()) < str))
+        throw Exception{"cannot build radix tree of unsorted or duplicate "
+          "keys"};
+      const auto offset = append_key(str);
+      entries_.push_back(Entry{offset, static_cast<std::uint32_t>(str.size()),
+        value});
+    }
+    nodes_.emplace_back();
+    build(0, 0, static_cast<std::uint32_t>(entries_.size()), 0);
+  }
+
+  /// @returns The number of keys.
+  size_type size() const noexcept
+  {
+    return entries_.size();
+  }
+
+  /// @returns `!size()`.
+  bool empty() const noexcept
+  {
+    return entries_.empty();
+  }
+
+  /**
+   * @brief Inserts `key` with `value` if there is no such a key yet.
+   *
+   * @returns `true` if the key is inserted.
+   */
+  bool insert(const std::string_view key, T value)
+  {
+    std::uint32_t n{};
+    std::size_t pos{};
+    while (true) {
+      const auto label = this->label(nodes_[n]);
+      const auto rest = key.substr(pos);
+      const auto m = detail::mismatch(label.data(), rest.data(),
+        std::min(label.size(), rest.size()));
+      if (m < label.size()) {
+        split(n, static_cast<std::uint32_t>(m));
+        pos += m;
+        if (pos == key.size())
+          set_value(n, key, std::move(value));
+        else
+          add_leaf(n, key, pos, std::move(value));
+        return true;
+      }
+
+      pos += m;
+      if (pos == key.size()) {
+        if (nodes_[n].value != npos)
+          return false;
+        set_value(n, key, std::move(value));
+        return true;
+      }
+
+      const auto child = find_child(nodes_[n], key[pos]);
+      if (child == npos) {
+        add_leaf(n, key, pos, std::move(value));
+        return true;
+      }
+      n = child;
+    }
+  }
+
+  /// @returns The value of `key`, or `nullptr` if there is no such a key.
+  const T* find(const std::string_view key) const noexcept
+  {
+    std::uint32_t n{};
+    std::size_t pos{};
+    while (true) {
+      const auto& node = nodes_[n];
+      const auto label = this->label(node);
+      if (key.size() - pos < label.size()
+        || std::memcmp(label.data(), key.data() + pos, label.size()))
+        return nullptr;
+      pos += label.size();
+      if (pos == key.size())
+        return node.value != npos ? &entries_[node.value].value : nullptr;
+      else if ((n = find_child(node, key[pos])) == npos)
+        return nullptr;
+    }
+  }
+
+  /// @overload
+  T* find(const std::string_view key) noexcept
+  {
+    return const_cast<T*>(static_cast<const Radix_tree*>(this)->find(key));
+  }
+
+  /// @returns The longest key which is a prefix of `str`.
+  Match longest_prefix_match(const std::string_view str) const noexcept
+  {
+    Match result;
+    std::uint32_t n{};
+    std::size_t pos{};
+    while (true) {
+      const auto& node = nodes_[n];
+      const auto label = this->label(node);
+      if (str.size() - pos < label.size()
+        || std::memcmp(label.data(), str.data() + pos, label.size()))
+        break;
+      pos += label.size();
+      if (node.value != npos)
+        result = {str.substr(0, pos), &entries_[node.value].value};
+      if (pos == str.size() || (n = find_child(node, str[pos])) == npos)
+        break;
+    }
+    return result;
+  }
+
+  /**
+   * @brief Calls `f(key, value)` for each key which starts with `prefix` in
+   * the lexicographic order.
+   *
+   * @details The `key` is a view into the arena of the tree.
+   */
+  template<typename F>
+  void for_each_with_prefix(const std::string_view prefix, F&& f) const
+  {
+    std::uint32_t n{};
+    std::size_t pos{};
+    while (true) {
+      const auto& node = nodes_[n];
+      const auto label = this->label(node);
+      const auto size = std::min(label.size(), prefix.size() - pos);
+      if (std::memcmp(label.data(), prefix.data() + pos, size))
+        return;
+      pos += size;
+      if (pos == prefix.size())
+        return for_each(n, f);
+      else if ((n = find_child(node, prefix[pos])) == npos)
+        return;
+    }
+  }
+
+  /// Calls `f(key, value)` for each key in the lexicographic order.
+  template<typename F>
+  void for_each(F&& f) const
+  {
+    for_each(0, f);
+  }
+
+private:
+  static constexpr std::uint32_t npos{std::numeric_limits<std::uint32_t>::max()};
+
+  enum class Kind : std::uint8_t {
+    none,
+    n4,
+    n16,
+    n48,
+    n256
+  };
+
+  struct Node final {
+    std::uint32_t label_offset{};
+    std::uint32_t label_size{};
+    std::uint32_t value{npos};
+    std::uint32_t children{npos};
+    std::uint16_t child_count{};
+    Kind kind{Kind::none};
+  };
+
+  struct Node4 final {
+    std::uint8_t keys[4];
+    std::uint32_t children[4];
+  };
+
+  struct Node16 final {
+    std::uint8_t keys[16];
+    std::uint32_t children[16];
+  };
+
+  struct Node48 final {
+    std::uint8_t index[256]; // slot + 1, or 0 if there is no child
+    std::uint32_t children[48];
+  };
+
+  struct Node256 final {
+    std::uint32_t children[256];
+  };
+
+  template<class N>
+  struct Pool final {
+    std::vector<N> nodes;
+    std::vector<std::uint32_t> free;
+
+    std::uint32_t allocate()
+    {
+      if (!free.empty()) {
+        const auto result = free.back();
+        free.pop_back();
+        return result;
+      }
+      nodes.emplace_back();
+      return static_cast<std::uint32_t>(nodes.size() - 1);
+    }
+  };
+
+  struct Entry final {
+    std::uint32_t key_offset{};
+    std::uint32_t key_size{};
+    T value;
+  };
+
+  std::string keys_;
+  std::vector<Entry> entries_;
+  std::vector<Node> nodes_;
+  Pool<Node4> n4_;
+  Pool<Node16> n16_;
+  Pool<Node48> n48_;
+  Pool<Node256> n256_;
+
+  // ---------------------------------------------------------------------------
+  // Keys
+  // ---------------------------------------------------------------------------
+
+  /// Appends `key` to the arena and returns its offset.
+  std::uint32_t append_key(const std::string_view key)
+  {
+    if (key.size() > npos - keys_.size())
+      throw Exception{"cannot insert key to radix tree: arena is full"};
+    const auto result = static_cast<std::uint32_t>(keys_.size());
+    keys_.append(key);
+    return result;
+  }
+
+  std::string_view label(const Node& node) const noexcept
+  {
+    return {keys_.data() + node.label_offset, node.label_size};
+  }
+
+  std::string_view key(const Entry& entry) const noexcept
+  {
+    return {keys_.data() + entry.key_offset, entry.key_size};
+  }
+
+  void set_value(const std::uint32_t n, const std::string_view key, T&& value)
+  {
+    const auto offset = append_key(key);
+    entries_.push_back(Entry{offset, static_cast<std::uint32_t>(key.size()),
+      std::move(value)});
+    nodes_[n].value = static_cast<std::uint32_t>(entries_.size() - 1);
+  }
+
+  /// Adds the leaf of `key` from `pos` as the child of `n`.
+  void add_leaf(const std::uint32_t n, const std::string_view key,
+    const std::size_t pos, T&& value)
+  {
+    const auto leaf = static_cast<std::uint32_t>(nodes_.size());
+    nodes_.emplace_back();
+    set_value(leaf, key, std::move(value));
+    const auto& entry = entries_.back();
+    nodes_[leaf].label_offset = entry.key_offset + static_cast<std::uint32_t>(pos);
+    nodes_[leaf].label_size = entry.key_size - static_cast<std::uint32_t>(pos);
+    add_child(n, static_cast<std::uint8_t>(key[pos]), leaf);
+  }
+
+  /// Splits the label of `n` at `m`, so the rest of label becomes the child.
+  void split(const std::uint32_t n, const std::uint32_t m)
+  {
+    const auto child = static_cast<std::uint32_t>(nodes_.size());
+    nodes_.push_back(nodes_[n]);
+    auto& c = nodes_[child];
+    c.label_offset += m;
+    c.label_size -= m;
+    auto& node = nodes_[n];
+    node.label_size = m;
+    node.value = npos;
+    node.children = npos;
+    node.child_count = 0;
+    node.kind = Kind::none;
+    add_child(n, static_cast<std::uint8_t>(keys_[c.label_offset]), child);
+  }
+
+  // ---------------------------------------------------------------------------
+  // Bulk build
+  // ---------------------------------------------------------------------------
+
+  /**
+   * @brief Builds the subtree `n` of entries `[lo, hi)`, which have the
+   * common prefix of size `depth` and are sorted.
+   */
+  void build(const std::uint32_t n, std::uint32_t lo, const std::uint32_t hi,
+    const std::uint32_t depth)
+  {
+    if (lo == hi)
+      return;
+
+    const auto first = key(entries_[lo]);
+    const auto last = key(entries_[hi - 1]);
+    const auto lcp = static_cast<std::uint32_t>(detail::mismatch(first.data(),
+        last.data(), std::min(first.size(), last.size())));
+    nodes_[n].label_offset = entries_[lo].key_offset + depth;
+    nodes_[n].label_size = lcp - depth;
+    if (first.size() == lcp)
+      nodes_[n].value = lo++;
+
+    while (lo < hi) {
+      const auto byte = keys_[entries_[lo].key_offset + lcp];
+      auto e = lo + 1;
+      for (; e < hi && keys_[entries_[e].key_offset + lcp] == byte; ++e);
+      const auto child = static_cast<std::uint32_t>(nodes_.size());
+      nodes_.emplace_back();
+      add_child(n, static_cast<std::uint8_t>(byte), child);
+      build(child, lo, e, lcp);
+      lo = e;
+    }
+  }
+
+  // ---------------------------------------------------------------------------
+  // Children
+  // ---------------------------------------------------------------------------
+
+  std::uint32_t find_child(const Node& node, const char ch) const noexcept
+  {
+    const auto byte = static_cast<std::uint8_t>(ch);
+    switch (node.kind) {
+    case Kind::none:
+      return npos;
+    case Kind::n4: {
+      const auto& c = n4_.nodes[node.children];
+      for (unsigned i{}; i < node.child_count; ++i) {
+        if (c.keys[i] == byte)
+          return c.children[i];
+      }
+      return npos;
+    }
+    case Kind::n16: {
+      const auto& c = n16_.nodes[node.children];
+#ifdef DMITIGR_STR_SSE2
+      const auto eq = static_cast<std::uint32_t>(_mm_movemask_epi8(
+          _mm_cmpeq_epi8(_mm_set1_epi8(ch),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(c.keys)))));
+      const auto mask = eq & ((1U << node.child_count) - 1);
+      return mask ? c.children[detail::ctz(mask)] : npos;
+#else
+      const auto e = c.keys + node.child_count;
+      const auto i = std::lower_bound(c.keys, e, byte);
+      return i != e && *i == byte ? c.children[i - c.keys] : npos;
+#endif
+    }
+    case Kind::n48: {
+      const auto& c = n48_.nodes[node.children];
+      return c.index[byte] ? c.children[c.index[byte] - 1] : npos;
+    }
+    case Kind::n256:
+      return n256_.nodes[node.children].children[byte];
+    }
+    return npos;
+  }
+
+  /// Inserts the sorted `byte` and `child` to `keys` and `children`.
+  static void insert_sorted(std::uint8_t* const keys,
+    std::uint32_t* const children, const unsigned count,
+    const std::uint8_t byte, const std::uint32_t child) noexcept
+  {
+    unsigned i{count};
+    for (; i && keys[i - 1] > byte; --i) {
+      keys[i] = keys[i - 1];
+      children[i] = children[i - 1];
+    }
+    keys[i] = byte;
+    children[i] = child;
+  }
+
+  /// Adds `child` with the label starting with `byte` to `n`.
+  void add_child(const std::uint32_t n, const std::uint8_t byte,
+    const std::uint32_t child)
+  {
+    auto& node = nodes_[n];
+    const unsigned count{node.child_count};
+    switch (node.kind) {
+    case Kind::none:
+      node.kind = Kind::n4;
+      node.children = n4_.allocate();
+      [[fallthrough]];
+    case Kind::n4:
+      if (count < 4) {
+        auto& c = n4_.nodes[node.children];
+        insert_sorted(c.keys, c.children, count, byte, child);
+        break;
+      } else {
+        const auto grown = n16_.allocate();
+        auto& c = n16_.nodes[grown];
+        const auto& old = n4_.nodes[node.children];
+        std::copy(old.keys, old.keys + 4, c.keys);
+        std::copy(old.children, old.children + 4, c.children);
+        n4_.free.push_back(node.children);
+        node.kind = Kind::n16;
+        node.children = grown;
+      }
+      [[fallthrough]];
+    case Kind::n16:
+      if (count < 16) {
+        auto& c = n16_.nodes[node.children];
+        insert_sorted(c.keys, c.children, count, byte, child);
+        break;
+      } else {
+        const auto grown = n48_.allocate();
+        auto& c = n48_.nodes[grown];
+        const auto& old = n16_.nodes[node.children];
+        std::fill(std::begin(c.index), std::end(c.index), 0);
+        for (unsigned i{}; i < 16; ++i) {
+          c.index[old.keys[i]] = static_cast<std::uint8_t>(i + 1);
+          c.children[i] = old.children[i];
+        }
+        n16_.free.push_back(node.children);
+        node.kind = Kind::n48;
+        node.children = grown;
+      }
+      [[fallthrough]];
+    case Kind::n48:
+      if (count < 48) {
+        auto& c = n48_.nodes[node.children];
+        c.index[byte] = static_cast<std::uint8_t>(count + 1);
+        c.children[count] = child;
+        break;
+      } else {
+        const auto grown = n256_.allocate();
+        auto& c = n256_.nodes[grown];
+        const auto& old = n48_.nodes[node.children];
+        std::fill(std::begin(c.children), std::end(c.children), npos);
+        for (unsigned b{}; b < 256; ++b) {
+          if (old.index[b])
+            c.children[b] = old.children[old.index[b] - 1];
+        }
+        n48_.free.push_back(node.children);
+        node.kind = Kind::n256;
+        node.children = grown;
+      }
+      [[fallthrough]];
+    case Kind::n256:
+      n256_.nodes[node.children].children[byte] = child;
+      break;
+    }
+    ++node.child_count;
+  }
+
+  /// Calls `f(key, value)` for each key of the subtree `n`.
+  template<typename F>
+  void for_each(const std::uint32_t n, F& f) const
+  {
+    const auto& node = nodes_[n];
+    if (node.value != npos) {
+      const auto& entry = entries_[node.value];
+      f(key(entry), entry.value);
+    }
+    switch (node.kind) {
+    case Kind::none:
+      break;
+    case Kind::n4:
+      for (unsigned i{}; i < node.child_count; ++i)
+        for_each(n4_.nodes[node.children].children[i], f);
+      break;
+    case Kind::n16:
+      for (unsigned i{}; i < node.child_count; ++i)
+        for_each(n16_.nodes[node.children].children[i], f);
+      break;
+    case Kind::n48:
+      for (unsigned b{}; b < 256; ++b) {
+        const auto& c = n48_.nodes[node.children];
+        if (c.index[b])
+          for_each(c.children[c.index[b] - 1], f);
+      }
+      break;
+    case Kind::n256:
+      for (unsigned b{}; b < 256; ++b) {
+        const auto child = n256_.nodes[node.children].children[b];
+        if (child != npos)
+          for_each(child, f);
+      }
+      break;
+    }
+  }
+};
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_RADIX_TREE_HPP
@@ -17,8 +17,10 @@
 #ifndef DMITIGR_STR_SEQUENCE_HPP
 #define DMITIGR_STR_SEQUENCE_HPP
 
+#include <algorithm>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -71,18 +73,19 @@ std::string to_string(const Container& cont, const std::string_view sep)
  *
  * @param input An input string.
  * @param separators Separators.
- * @param to_type A converter from std::string_view to T.
+ * @param to_type A converter from std::basic_string_view<CharT, Traits> to T.
  *
  * @returns The vector of splitted parts converted to T.
  */
-template<class T, typename F>
-std::vector<T> to_vector(const std::string_view input,
-  const std::string_view separators, const F& to_type)
+template<class T, typename CharT, class Traits, typename F>
+std::vector<T> to_vector(const std::basic_string_view<CharT, Traits> input,
+  const std::basic_string_view<CharT, Traits> separators, const F& to_type)
 {
-  using Size = std::string_view::size_type;
+  using View = std::basic_string_view<CharT, Traits>;
+  using Size = typename View::size_type;
   std::vector<T> result;
   result.reserve(8);
-  Size pos{std::string_view::npos};
+  Size pos{View::npos};
   Size offset{};
   while (offset < input.size()) {
     pos = input.find_first_of(separators, offset);
@@ -90,17 +93,38 @@ std::vector<T> to_vector(const std::string_view input,
     result.push_back(to_type(input.substr(offset, part_size)));
     offset += part_size + 1;
   }
-  if (pos != std::string_view::npos) // input ends with a separator
-    result.push_back(to_type(std::string_view{}));
+  if (pos != View::npos) // input ends with a separator
+    result.push_back(to_type(View{}));
   return result;
 }
 
+/// @overload
+template<class T, typename F>
+std::vector<T> to_vector(const std::string_view input,
+  const std::string_view separators, const F& to_type)
+{
+  return to_vector<T, char, std::string_view::traits_type>(input, separators,
+    to_type);
+}
+
 /**
  * @brief Splits the `input` string into the parts separated by the
  * specified `separators`.
  *
+ * @tparam S The type of parts, `std::basic_string<CharT, Traits>` by default.
+ *
  * @returns The vector of splitted parts.
  */
+template<class S = void, typename CharT, class Traits>
+auto to_vector(const std::basic_string_view<CharT, Traits> input,
+  const std::basic_string_view<CharT, Traits> separators)
+{
+  using R = std::conditional_t<std::is_void_v<S>,
+    std::basic_string<CharT, Traits>, S>;
+  return to_vector<R>(input, separators, [](const auto& v){return R{v};});
+}
+
+/// @overload
 template<class S = std::string>
 std::vector<S> to_vector(const std::string_view input,
   const std::string_view separators)
@@ -0,0 +1,624 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_SIMD_HPP
+#define DMITIGR_STR_SIMD_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+  (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DMITIGR_STR_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/*
+ * The byte kernels below are used by the higher level functions of this
+ * library. Each kernel has an SSE2 implementation (which is always available
+ * on x86-64) and a portable scalar implementation.
+ */
+
+namespace dmitigr::str::detail {
+
+// -----------------------------------------------------------------------------
+// Bit operations
+// -----------------------------------------------------------------------------
+
+/// @returns The number of trailing zero bits of non-zero `value`.
+inline unsigned ctz(const std::uint32_t value) noexcept
+{
+#ifdef _MSC_VER
+  unsigned long result;
+  _BitScanForward(&result, value);
+  return static_cast<unsigned>(result);
+#else
+  return static_cast<unsigned>(__builtin_ctz(value));
+#endif
+}
+
+/// @returns The number of trailing zero bits of non-zero `value`.
+inline unsigned ctz64(const std::uint64_t value) noexcept
+{
+#ifdef _MSC_VER
+  const auto low = static_cast<std::uint32_t>(value);
+  return low ? ctz(low) : 32 + ctz(static_cast<std::uint32_t>(value >> 32));
+#else
+  return static_cast<unsigned>(__builtin_ctzll(value));
+#endif
+}
+
+/// @returns The number of leading zero bits of non-zero `value`.
+inline unsigned clz(const std::uint32_t value) noexcept
+{
+#ifdef _MSC_VER
+  unsigned long result;
+  _BitScanReverse(&result, value);
+  return 31 - static_cast<unsigned>(result);
+#else
+  return static_cast<unsigned>(__builtin_clz(value));
+#endif
+}
+
+/// @returns The number of one bits of `value`.
+inline unsigned popcount(std::uint64_t value) noexcept
+{
+#ifdef _MSC_VER
+  value -= value >> 1 & 0x5555555555555555;
+  value = (value & 0x3333333333333333) + (value >> 2 & 0x3333333333333333);
+  value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0F;
+  return static_cast<unsigned>(value * 0x0101010101010101 >> 56);
+#else
+  return static_cast<unsigned>(__builtin_popcountll(value));
+#endif
+}
+
+// -----------------------------------------------------------------------------
+// Byte classification
+// -----------------------------------------------------------------------------
+
+/// @returns `true` if `ch` is one of " \t\n\v\f\r".
+constexpr bool is_ascii_space(const unsigned char ch) noexcept
+{
+  return ch == ' ' || (ch >= '\t' && ch <= '\r');
+}
+
+#ifdef DMITIGR_STR_SSE2
+/// @returns The mask of bytes of `block` which are one of " \t\n\v\f\r".
+inline std::uint32_t ascii_space_mask(const __m128i block) noexcept
+{
+  // (ch - '\t') as unsigned <= ('\r' - '\t') is emulated by signed compare
+  // of the biased value.
+  const __m128i biased = _mm_sub_epi8(block, _mm_set1_epi8(
+      static_cast<char>('\t' + 0x80)));
+  const __m128i ctl = _mm_cmplt_epi8(biased, _mm_set1_epi8(
+      static_cast<char>(-0x80 + ('\r' - '\t' + 1))));
+  const __m128i spc = _mm_cmpeq_epi8(block, _mm_set1_epi8(' '));
+  return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_or_si128(ctl, spc)));
+}
+#endif
+
+/**
+ * @returns The mask of 64 bytes at `p` which are equal to any of `count`
+ * bytes of `bytes`. The bit `i` of the mask corresponds to `p[i]`.
+ */
+inline std::uint64_t any_byte_mask64(const char* const p,
+  const char* const bytes, const unsigned count) noexcept
+{
+  std::uint64_t result{};
+#ifdef DMITIGR_STR_SSE2
+  for (unsigned i{}; i < 4; ++i) {
+    const __m128i block = _mm_loadu_si128(
+      reinterpret_cast<const __m128i*>(p + 16*i));
+    __m128i eq = _mm_setzero_si128();
+    for (unsigned j{}; j < count; ++j)
+      eq = _mm_or_si128(eq, _mm_cmpeq_epi8(block, _mm_set1_epi8(bytes[j])));
+    result |= static_cast<std::uint64_t>(
+      static_cast<std::uint32_t>(_mm_movemask_epi8(eq))) << 16*i;
+  }
+#else
+  for (unsigned i{}; i < 64; ++i) {
+    for (unsigned j{}; j < count; ++j) {
+      if (p[i] == bytes[j]) {
+        result |= std::uint64_t{1} << i;
+        break;
+      }
+    }
+  }
+#endif
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+// Searching
+// -----------------------------------------------------------------------------
+
+/// @returns The pointer to the first byte in `[b, e)` with the high bit set.
+inline const char* find_non_ascii(const char* b, const char* const e) noexcept
+{
+#ifdef DMITIGR_STR_SSE2
+  for (; e - b >= 16; b += 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+    if (const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(block)))
+      return b + ctz(mask);
+  }
+#else
+  for (; e - b >= 8; b += 8) {
+    std::uint64_t word;
+    std::memcpy(&word, b, sizeof(word));
+    if (word & 0x8080808080808080)
+      break;
+  }
+#endif
+  for (; b != e; ++b) {
+    if (static_cast<unsigned char>(*b) & 0x80)
+      break;
+  }
+  return b;
+}
+
+/**
+ * @returns The pointer to the first byte in `[b, e)` which is not one of
+ * " \t\n\v\f\r".
+ */
+inline const char* find_non_ascii_space(const char* b, const char* const e) noexcept
+{
+#ifdef DMITIGR_STR_SSE2
+  for (; e - b >= 16; b += 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+    if (const auto mask = ascii_space_mask(block) ^ 0xffff)
+      return b + ctz(mask);
+  }
+#endif
+  for (; b != e; ++b) {
+    if (!is_ascii_space(static_cast<unsigned char>(*b)))
+      break;
+  }
+  return b;
+}
+
+/**
+ * @returns The pointer to the first byte in `[b, e)` which is one of
+ * " \t\n\v\f\r" or has the high bit set.
+ */
+inline const char* find_ascii_space_or_non_ascii(const char* b,
+  const char* const e) noexcept
+{
+#ifdef DMITIGR_STR_SSE2
+  for (; e - b >= 16; b += 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+    if (const auto mask = ascii_space_mask(block)
+      | static_cast<std::uint32_t>(_mm_movemask_epi8(block)))
+      return b + ctz(mask);
+  }
+#endif
+  for (; b != e; ++b) {
+    const auto ch = static_cast<unsigned char>(*b);
+    if ((ch & 0x80) || is_ascii_space(ch))
+      break;
+  }
+  return b;
+}
+
+/**
+ * @returns The pointer past the last byte in `[b, e)` which is not one of
+ * " \t\n\v\f\r", or `b` if there is no such a byte.
+ */
+inline const char* rfind_non_ascii_space(const char* const b, const char* e) noexcept
+{
+#ifdef DMITIGR_STR_SSE2
+  for (; e - b >= 16; e -= 16) {
+    const __m128i block = _mm_loadu_si128(
+      reinterpret_cast<const __m128i*>(e - 16));
+    if (const auto mask = ascii_space_mask(block) ^ 0xffff)
+      return e - 16 + (32 - clz(mask));
+  }
+#endif
+  for (; e != b; --e) {
+    if (!is_ascii_space(static_cast<unsigned char>(*(e - 1))))
+      break;
+  }
+  return e;
+}
+
+// -----------------------------------------------------------------------------
+// ASCII case
+// -----------------------------------------------------------------------------
+
+/// @returns `ch` converted to lowercase if `!Upper`, or to uppercase otherwise.
+template<bool Upper>
+constexpr char ascii_to_case(const char ch) noexcept
+{
+  if constexpr (Upper)
+    return ch >= 'a' && ch <= 'z' ? static_cast<char>(ch - 0x20) : ch;
+  else
+    return ch >= 'A' && ch <= 'Z' ? static_cast<char>(ch + 0x20) : ch;
+}
+
+#ifdef DMITIGR_STR_SSE2
+/// @returns The `block` with ASCII letters converted according to `Upper`.
+template<bool Upper>
+inline __m128i ascii_to_case(const __m128i block) noexcept
+{
+  constexpr char first = Upper ? 'a' : 'A';
+  const __m128i biased = _mm_sub_epi8(block, _mm_set1_epi8(
+      static_cast<char>(first + 0x80)));
+  const __m128i is_letter = _mm_cmplt_epi8(biased, _mm_set1_epi8(
+      static_cast<char>(-0x80 + 26)));
+  const __m128i delta = _mm_and_si128(is_letter, _mm_set1_epi8(0x20));
+  return Upper ? _mm_sub_epi8(block, delta) : _mm_add_epi8(block, delta);
+}
+#endif
+
+/**
+ * @brief Converts the case of ASCII letters of the leading ASCII run of
+ * `[b, e)` and writes the result to `out`.
+ *
+ * @details `out` may be equal to `b`.
+ *
+ * @returns The pointer to the first non-ASCII byte of `[b, e)`.
+ */
+template<bool Upper>
+const char* ascii_to_case(const char* b, const char* const e, char* out) noexcept
+{
+#ifdef DMITIGR_STR_SSE2
+  for (; e - b >= 16; b += 16, out += 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+    if (_mm_movemask_epi8(block))
+      break;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+      ascii_to_case<Upper>(block));
+  }
+#endif
+  for (; b != e && !(static_cast<unsigned char>(*b) & 0x80); ++b, ++out)
+    *out = ascii_to_case<Upper>(*b);
+  return b;
+}
+
+/// @returns The length of the common prefix of `a` and `b` of size `size`.
+inline std::size_t mismatch(const char* const a, const char* const b,
+  const std::size_t size) noexcept
+{
+  std::size_t i{};
+#ifdef DMITIGR_STR_SSE2
+  for (; size - i >= 16; i += 16) {
+    const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+    const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+    if (const auto mask = static_cast<std::uint32_t>(
+          _mm_movemask_epi8(_mm_cmpeq_epi8(x, y))) ^ 0xffff)
+      return i + ctz(mask);
+  }
+#endif
+  for (; i < size && a[i] == b[i]; ++i);
+  return i;
+}
+
+/// @returns The length of the common suffix of `a` and `b` of size `size`.
+inline std::size_t rmismatch(const char* const a, const char* const b,
+  const std::size_t size) noexcept
+{
+  std::size_t i{};
+#ifdef DMITIGR_STR_SSE2
+  for (; size - i >= 16; i += 16) {
+    const auto offset = size - i - 16;
+    const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + offset));
+    const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + offset));
+    if (const auto mask = static_cast<std::uint32_t>(
+          _mm_movemask_epi8(_mm_cmpeq_epi8(x, y))) ^ 0xffff)
+      return i + clz(mask) - 16;
+  }
+#endif
+  for (; i < size && a[size - i - 1] == b[size - i - 1]; ++i);
+  return i;
+}
+
+/**
+ * @returns The length of the common prefix of `a` and `b` of size `size`
+ * such that both prefixes are ASCII and equal if compared case-insensitively.
+ */
+inline std::size_t ascii_icase_mismatch(const char* const a, const char* const b,
+  const std::size_t size) noexcept
+{
+  std::size_t i{};
+#ifdef DMITIGR_STR_SSE2
+  for (; size - i >= 16; i += 16) {
+    const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+    const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+    const auto eq = static_cast<std::uint32_t>(_mm_movemask_epi8(
+        _mm_cmpeq_epi8(ascii_to_case<false>(x), ascii_to_case<false>(y))));
+    const auto ascii = static_cast<std::uint32_t>(
+      _mm_movemask_epi8(_mm_or_si128(x, y))) ^ 0xffff;
+    if (const auto mask = (eq & ascii) ^ 0xffff)
+      return i + ctz(mask);
+  }
+#endif
+  for (; i < size; ++i) {
+    if (((static_cast<unsigned char>(a[i]) | static_cast<unsigned char>(b[i]))
+        & 0x80) || ascii_to_case<false>(a[i]) != ascii_to_case<false>(b[i]))
+      break;
+  }
+  return i;
+}
+
+/// @returns The number of bytes `ch` in `[b, e)`.
+inline std::size_t count_byte(const char* b, const char* const e,
+  const char ch) noexcept
+{
+  std::size_t result{};
+#ifdef DMITIGR_STR_SSE2
+  const __m128i c = _mm_set1_epi8(ch);
+  const __m128i zero = _mm_setzero_si128();
+  while (e - b >= 16) {
+    // Each lane of the accumulator is incremented at most 255 times.
+    __m128i counts = zero;
+    const auto n = std::min<std::ptrdiff_t>((e - b) / 16, 255);
+    for (std::ptrdiff_t i{}; i < n; ++i, b += 16)
+      counts = _mm_sub_epi8(counts, _mm_cmpeq_epi8(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(b)), c));
+    const __m128i sums = _mm_sad_epu8(counts, zero);
+    result += static_cast<std::size_t>(_mm_cvtsi128_si32(sums))
+      + static_cast<std::size_t>(_mm_extract_epi16(sums, 4));
+  }
+#endif
+  for (; b != e; ++b)
+    result += *b == ch;
+  return result;
+}
+
+/**
+ * @returns The pointer to the first byte of `[b, e)` which is equal to any of
+ * `count` bytes of `bytes`, or `e` if there is no such a byte.
+ *
+ * @par Requires
+ * `count <= 3`.
+ */
+inline const char* find_any_byte(const char* b, const char* const e,
+  const char* const bytes, const unsigned count) noexcept
+{
+  if (!count)
+    return e;
+  const auto x = bytes[0];
+  const auto y = bytes[count > 1 ? 1 : 0];
+  const auto z = bytes[count > 2 ? 2 : 0];
+#ifdef DMITIGR_STR_SSE2
+  const __m128i xs = _mm_set1_epi8(x);
+  const __m128i ys = _mm_set1_epi8(y);
+  const __m128i zs = _mm_set1_epi8(z);
+  for (; e - b >= 16; b += 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+    if (const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(
+          _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, xs),
+              _mm_cmpeq_epi8(block, ys)), _mm_cmpeq_epi8(block, zs)))))
+      return b + ctz(mask);
+  }
+#endif
+  for (; b != e && *b != x && *b != y && *b != z; ++b);
+  return b;
+}
+
+/**
+ * @returns The pointer to the first byte of `[b, e)` which is less than 0x20
+ * or equal to any of `count` bytes of `bytes`, or `e` if there is no such a
+ * byte.
+ *
+ * @par Requires
+ * `count <= 3`.
+ */
+inline const char* find_control_or_any_byte(const char* b, const char* const e,
+  const char* const bytes, const unsigned count) noexcept
+{
+  const auto x = count ? bytes[0] : '\0';
+  const auto y = count > 1 ? bytes[1] : x;
+  const auto z = count > 2 ? bytes[2] : x;
+#ifdef DMITIGR_STR_SSE2
+  const __m128i controls = _mm_set1_epi8(0x1F);
+  const __m128i xs = _mm_set1_epi8(x);
+  const __m128i ys = _mm_set1_epi8(y);
+  const __m128i zs = _mm_set1_epi8(z);
+  for (; e - b >= 16; b += 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+    const __m128i ctl = _mm_cmpeq_epi8(_mm_min_epu8(block, controls), block);
+    if (const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(
+          _mm_or_si128(_mm_or_si128(ctl, _mm_cmpeq_epi8(block, xs)),
+            _mm_or_si128(_mm_cmpeq_epi8(block, ys), _mm_cmpeq_epi8(block, zs))))))
+      return b + ctz(mask);
+  }
+#endif
+  for (; b != e && static_cast<unsigned char>(*b) >= 0x20
+         && *b != x && *b != y && *b != z; ++b);
+  return b;
+}
+
+/**
+ * @returns The offset of the first occurrence of `needle` of size `m` in
+ * `haystack` of size `n`, or `static_cast<std::size_t>(-1)` if not found.
+ *
+ * @details The SSE2 implementation compares the first and the last bytes of
+ * `needle` with 16 positions at once, and only the positions where both bytes
+ * are equal are compared entirely.
+ */
+inline std::size_t search(const char* const haystack, const std::size_t n,
+  const char* const needle, const std::size_t m) noexcept
+{
+  constexpr auto npos = static_cast<std::size_t>(-1);
+  if (!m)
+    return 0;
+  else if (m > n)
+    return npos;
+  else if (m == 1) {
+    const auto p = static_cast<const char*>(std::memchr(haystack, *needle, n));
+    return p ? static_cast<std::size_t>(p - haystack) : npos;
+  }
+
+  std::size_t i{};
+  const auto last = n - m; // the last position to check
+#ifdef DMITIGR_STR_SSE2
+  const __m128i first_byte = _mm_set1_epi8(needle[0]);
+  const __m128i last_byte = _mm_set1_epi8(needle[m - 1]);
+  for (; last - i >= 16; i += 16) {
+    const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+        haystack + i));
+    const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+        haystack + i + m - 1));
+    auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_and_si128(
+          _mm_cmpeq_epi8(x, first_byte), _mm_cmpeq_epi8(y, last_byte))));
+    for (; mask; mask &= mask - 1) {
+      const auto pos = i + ctz(mask);
+      if (!std::memcmp(haystack + pos + 1, needle + 1, m - 2))
+        return pos;
+    }
+  }
+#endif
+  for (; i <= last; ++i) {
+    if (haystack[i] == needle[0] && haystack[i + m - 1] == needle[m - 1]
+      && !std::memcmp(haystack + i + 1, needle + 1, m - 2))
+      return i;
+  }
+  return npos;
+}
+
+// -----------------------------------------------------------------------------
+// 16- and 32-bit code units
+// -----------------------------------------------------------------------------
+
+#ifdef DMITIGR_STR_SSE2
+/**
+ * @returns The mask of lanes of `block` of `Size`-byte units which are greater
+ * than `max` as unsigned. Each lane is represented by `Size` bits.
+ */
+template<std::size_t Size>
+inline std::uint32_t units_greater_mask(const __m128i block,
+  const std::uint32_t max) noexcept
+{
+  static_assert(Size == 2 || Size == 4);
+  if constexpr (Size == 2) {
+    const __m128i bias = _mm_set1_epi16(static_cast<short>(0x8000));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi16(
+          _mm_xor_si128(block, bias),
+          _mm_set1_epi16(static_cast<short>(max ^ 0x8000)))));
+  } else {
+    const __m128i bias = _mm_set1_epi32(static_cast<int>(0x80000000));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi32(
+          _mm_xor_si128(block, bias),
+          _mm_set1_epi32(static_cast<int>(max ^ 0x80000000)))));
+  }
+}
+
+/// @returns The `block` of `Size`-byte units with ASCII letters converted.
+template<bool Upper, std::size_t Size>
+inline __m128i units_to_case(const __m128i block) noexcept
+{
+  static_assert(Size == 2 || Size == 4);
+  constexpr std::uint32_t first = Upper ? 'a' : 'A';
+  if constexpr (Size == 2) {
+    const __m128i biased = _mm_sub_epi16(block,
+      _mm_set1_epi16(static_cast<short>(first + 0x8000)));
+    const __m128i is_letter = _mm_cmplt_epi16(biased,
+      _mm_set1_epi16(static_cast<short>(-0x8000 + 26)));
+    const __m128i delta = _mm_and_si128(is_letter, _mm_set1_epi16(0x20));
+    return Upper ? _mm_sub_epi16(block, delta) : _mm_add_epi16(block, delta);
+  } else {
+    const __m128i biased = _mm_sub_epi32(block,
+      _mm_set1_epi32(static_cast<int>(first + 0x80000000)));
+    const __m128i is_letter = _mm_cmplt_epi32(biased,
+      _mm_set1_epi32(static_cast<int>(-0x7fffffff - 1 + 26)));
+    const __m128i delta = _mm_and_si128(is_letter, _mm_set1_epi32(0x20));
+    return Upper ? _mm_sub_epi32(block, delta) : _mm_add_epi32(block, delta);
+  }
+}
+#endif
+
+/// @returns The pointer to the first unit in `[b, e)` which is greater than `max`.
+template<typename CharT>
+const CharT* find_greater(const CharT* b, const CharT* const e,
+  const CharT max) noexcept
+{
+  static_assert(sizeof(CharT) == 2 || sizeof(CharT) == 4);
+#ifdef DMITIGR_STR_SSE2
+  constexpr std::size_t step{16 / sizeof(CharT)};
+  for (; static_cast<std::size_t>(e - b) >= step; b += step) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+    if (const auto mask = units_greater_mask<sizeof(CharT)>(block,
+        static_cast<std::uint32_t>(max)))
+      return b + ctz(mask) / sizeof(CharT);
+  }
+#endif
+  for (; b != e && static_cast<std::uint32_t>(*b) <= static_cast<std::uint32_t>(max);
+       ++b);
+  return b;
+}
+
+/**
+ * @returns The pointer past the last unit in `[b, e)` which is greater than
+ * `max`, or `b` if there is no such a unit.
+ */
+template<typename CharT>
+const CharT* rfind_greater(const CharT* const b, const CharT* e,
+  const CharT max) noexcept
+{
+  static_assert(sizeof(CharT) == 2 || sizeof(CharT) == 4);
+#ifdef DMITIGR_STR_SSE2
+  constexpr std::size_t step{16 / sizeof(CharT)};
+  for (; static_cast<std::size_t>(e - b) >= step; e -= step) {
+    const __m128i block = _mm_loadu_si128(
+      reinterpret_cast<const __m128i*>(e - step));
+    if (const auto mask = units_greater_mask<sizeof(CharT)>(block,
+        static_cast<std::uint32_t>(max)))
+      return e - step + (32 - clz(mask)) / sizeof(CharT);
+  }
+#endif
+  for (; e != b && static_cast<std::uint32_t>(*(e - 1))
+         <= static_cast<std::uint32_t>(max); --e);
+  return e;
+}
+
+/**
+ * @brief Converts the case of ASCII letters of the leading ASCII run of
+ * `[b, e)` and writes the result to `out`.
+ *
+ * @details `out` may be equal to `b`.
+ *
+ * @returns The pointer to the first non-ASCII unit of `[b, e)`.
+ */
+template<bool Upper, typename CharT>
+const CharT* units_to_case(const CharT* b, const CharT* const e,
+  CharT* out) noexcept
+{
+  static_assert(sizeof(CharT) == 2 || sizeof(CharT) == 4);
+#ifdef DMITIGR_STR_SSE2
+  constexpr std::size_t step{16 / sizeof(CharT)};
+  for (; static_cast<std::size_t>(e - b) >= step; b += step, out += step) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+    if (units_greater_mask<sizeof(CharT)>(block, 0x7F))
+      break;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+      units_to_case<Upper, sizeof(CharT)>(block));
+  }
+#endif
+  for (; b != e && static_cast<std::uint32_t>(*b) < 0x80; ++b, ++out)
+    *out = static_cast<CharT>(ascii_to_case<Upper>(static_cast<char>(*b)));
+  return b;
+}
+
+} // namespace dmitigr::str::detail
+
+#endif  // DMITIGR_STR_SIMD_HPP
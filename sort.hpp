@@ -0,0 +1,352 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_SORT_HPP
+#define DMITIGR_STR_SORT_HPP
+
+#include "parallel.hpp"
+#include "string_table.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace dmitigr::str {
+
+// -----------------------------------------------------------------------------
+// Multikey quicksort
+// -----------------------------------------------------------------------------
+
+namespace detail {
+
+/// The number of strings which are sorted by the insertion sort.
+constexpr std::size_t string_sort_insertion_threshold{16};
+
+/// The number of strings which are sorted by the single thread.
+constexpr std::size_t string_sort_parallel_threshold{1 << 14};
+
+/**
+ * @returns The character of `str` at `depth` plus one, or `0` if there is no
+ * character at `depth`.
+ */
+inline std::uint16_t char_at(const std::string_view str,
+  const std::size_t depth) noexcept
+{
+  return depth < str.size() ?
+    static_cast<std::uint16_t>(static_cast<unsigned char>(str[depth]) + 1) : 0;
+}
+
+/**
+ * @brief Sorts `[a, a + n)` with the common prefix of size `depth`.
+ *
+ * @par Requires
+ * The sizes of strings are at least `depth`.
+ */
+template<typename T, class Key>
+void string_insertion_sort(T* const a, const std::size_t n,
+  const std::size_t depth, const Key& key)
+{
+  for (std::size_t i{1}; i < n; ++i) {
+    T tmp = std::move(a[i]);
+    const auto suffix = key(tmp).substr(depth);
+    std::size_t j{i};
+    for (; j && key(a[j - 1]).substr(depth) > suffix; --j)
+      a[j] = std::move(a[j - 1]);
+    a[j] = std::move(tmp);
+  }
+}
+
+/// Fills `c` with the characters of `[a, a + n)` at `depth`.
+template<typename T, class Key>
+void fill_char_cache(const T* const a, std::uint16_t* const c,
+  const std::size_t n, const std::size_t depth, const Key& key)
+{
+  for (std::size_t i{}; i < n; ++i)
+    c[i] = char_at(key(a[i]), depth);
+}
+
+/// The result of the three-way partitioning.
+struct String_partition final {
+  std::size_t lt{};
+  std::size_t gt{};
+  std::uint16_t pivot{};
+};
+
+/**
+ * @brief Partitions `[a, a + n)` by the cached characters `c` into the ranges
+ * of characters less than, equal to and greater than the pivot.
+ *
+ * @par Requires
+ * `n >= 3`.
+ */
+template<typename T>
+String_partition string_partition(T* const a, std::uint16_t* const c,
+  const std::size_t n) noexcept
+{
+  using std::swap;
+  const auto x = c[0], y = c[n / 2], z = c[n - 1];
+  const auto pivot = std::max(std::min(x, y), std::min(std::max(x, y), z));
+  std::size_t lt{}, i{}, gt{n};
+  while (i < gt) {
+    if (c[i] < pivot) {
+      swap(a[lt], a[i]);
+      swap(c[lt], c[i]);
+      ++lt;
+      ++i;
+    } else if (c[i] > pivot) {
+      --gt;
+      swap(a[i], a[gt]);
+      swap(c[i], c[gt]);
+    } else
+      ++i;
+  }
+  return {lt, gt, pivot};
+}
+
+/**
+ * @brief Sorts `[a, a + n)` by the multikey quicksort with the cache `c` of
+ * characters at `depth`.
+ *
+ * @param is_cached The indicator that `c` is already filled.
+ */
+template<typename T, class Key>
+void string_sort(T* a, std::uint16_t* c, std::size_t n, std::size_t depth,
+  bool is_cached, const Key& key)
+{
+  while (n > string_sort_insertion_threshold) {
+    if (!is_cached)
+      fill_char_cache(a, c, n, depth, key);
+    const auto p = string_partition(a, c, n);
+    string_sort(a, c, p.lt, depth, true, key);
+    string_sort(a + p.gt, c + p.gt, n - p.gt, depth, true, key);
+    if (!p.pivot)
+      return; // all of the strings of the middle range are equal
+    a += p.lt;
+    c += p.lt;
+    n = p.gt - p.lt;
+    ++depth;
+    is_cached = false;
+  }
+  string_insertion_sort(a, n, depth, key);
+}
+
+/// Sorts `[a, a + n)` in the order of `key(a[i])`.
+template<typename T, class Key>
+void string_sort(T* const a, const std::size_t n, const Key& key)
+{
+  std::vector<std::uint16_t> cache(n);
+  string_sort(a, cache.data(), n, 0, false, key);
+}
+
+/**
+ * @brief Sorts `[a, a + n)` in the order of `key(a[i])` by using up to
+ * `thread_count` threads.
+ *
+ * @details The partitions which are too large to be sorted by the single
+ * thread are splitted into the subtasks which are processed by the pool.
+ */
+template<typename T, class Key>
+void string_sort_parallel(T* const a, const std::size_t n, const Key& key,
+  unsigned thread_count)
+{
+  thread_count = thread_count_or_default(thread_count);
+  if (thread_count == 1 || n < string_sort_parallel_threshold)
+    return string_sort(a, n, key);
+
+  struct Task final {
+    T* a{};
+    std::uint16_t* c{};
+    std::size_t n{};
+    std::size_t depth{};
+    bool is_cached{};
+  };
+
+  std::vector<std::uint16_t> cache(n);
+  const std::size_t split_threshold{std::max(n / (thread_count * 16),
+    string_sort_parallel_threshold / 4)};
+  std::vector<Task> tasks{Task{a, cache.data(), n, 0, false}};
+  std::size_t active_count{};
+  std::mutex mutex;
+  std::condition_variable cv;
+
+  const auto worker = [&]
+  {
+    std::unique_lock lock{mutex};
+    while (true) {
+      cv.wait(lock, [&]{return !tasks.empty() || !active_count;});
+      if (tasks.empty())
+        return;
+
+      auto t = tasks.back();
+      tasks.pop_back();
+      ++active_count;
+      lock.unlock();
+
+      Task subtasks[3];
+      std::size_t subtask_count{};
+      if (t.n <= split_threshold)
+        string_sort(t.a, t.c, t.n, t.depth, t.is_cached, key);
+      else {
+        if (!t.is_cached)
+          fill_char_cache(t.a, t.c, t.n, t.depth, key);
+        const auto p = string_partition(t.a, t.c, t.n);
+        if (p.lt > 1)
+          subtasks[subtask_count++] = {t.a, t.c, p.lt, t.depth, true};
+        if (t.n - p.gt > 1)
+          subtasks[subtask_count++] = {t.a + p.gt, t.c + p.gt, t.n - p.gt,
+            t.depth, true};
+        if (p.pivot && p.gt - p.lt > 1)
+          subtasks[subtask_count++] = {t.a + p.lt, t.c + p.lt, p.gt - p.lt,
+            t.depth + 1, false};
+      }
+
+      lock.lock();
+      tasks.insert(tasks.end(), subtasks, subtasks + subtask_count);
+      --active_count;
+      cv.notify_all();
+    }
+  };
+
+  // The calling thread is a worker too, so the sort is completed even if
+  // the creation of some threads fails.
+  std::vector<std::thread> threads;
+  threads.reserve(thread_count - 1);
+  try {
+    for (unsigned i{1}; i < thread_count; ++i)
+      threads.emplace_back(worker);
+  } catch (...) {}
+  worker();
+  for (auto& thread : threads)
+    thread.join();
+}
+
+/// The string with the index of its original position.
+struct Indexed_string_view final {
+  std::string_view view;
+  std::size_t index{};
+};
+
+/**
+ * @brief Sorts `strings` by sorting the indexed views of them and then
+ * moving the strings to their positions.
+ */
+template<class Sort>
+void sort_strings_by_views(std::vector<std::string>& strings, const Sort& sort)
+{
+  const auto size = strings.size();
+  std::vector<Indexed_string_view> views(size);
+  for (std::size_t i{}; i < size; ++i)
+    views[i] = {strings[i], i};
+  sort(views.data(), size,
+    [](const Indexed_string_view& v) noexcept {return v.view;});
+
+  std::vector<std::string> result(size);
+  for (std::size_t i{}; i < size; ++i)
+    result[i] = std::move(strings[views[i].index]);
+  strings.swap(result);
+}
+
+/// @returns The key function of the entries of `table`.
+inline auto string_table_key(const String_table& table) noexcept
+{
+  return [data = table.data().data()](const String_table::Entry& e) noexcept
+  {
+    return std::string_view{data + e.offset, e.size};
+  };
+}
+
+} // namespace detail
+
+/**
+ * @brief Sorts `strings` lexicographically (bytes are compared as unsigned).
+ *
+ * @details Uses the multikey quicksort with cached characters, which inspects
+ * each character of the common prefixes only once, instead of comparing the
+ * whole prefixes over and over again as `std::sort()` does.
+ */
+inline void sort_strings(std::vector<std::string_view>& strings)
+{
+  detail::string_sort(strings.data(), strings.size(),
+    [](const std::string_view s) noexcept {return s;});
+}
+
+/// @overload
+inline void sort_strings(std::vector<std::string>& strings)
+{
+  detail::sort_strings_by_views(strings, [](auto* const a, const auto n,
+      const auto& key){detail::string_sort(a, n, key);});
+}
+
+/**
+ * @overload
+ *
+ * @details Only the entries of `table` are reordered.
+ *
+ * @see String_table::compact().
+ */
+inline void sort_strings(String_table& table)
+{
+  auto& entries = table.entries();
+  detail::string_sort(entries.data(), entries.size(),
+    detail::string_table_key(table));
+}
+
+/**
+ * @brief Sorts `strings` lexicographically by using up to `thread_count`
+ * threads, or `std::thread::hardware_concurrency()` threads if
+ * `thread_count == 0`.
+ *
+ * @details The small inputs are sorted by the calling thread only.
+ *
+ * @see sort_strings().
+ */
+inline void sort_strings_parallel(std::vector<std::string_view>& strings,
+  const unsigned thread_count = 0)
+{
+  detail::string_sort_parallel(strings.data(), strings.size(),
+    [](const std::string_view s) noexcept {return s;}, thread_count);
+}
+
+/// @overload
+inline void sort_strings_parallel(std::vector<std::string>& strings,
+  const unsigned thread_count = 0)
+{
+  detail::sort_strings_by_views(strings, [thread_count](auto* const a,
+      const auto n, const auto& key)
+  {
+    detail::string_sort_parallel(a, n, key, thread_count);
+  });
+}
+
+/// @overload
+inline void sort_strings_parallel(String_table& table,
+  const unsigned thread_count = 0)
+{
+  auto& entries = table.entries();
+  detail::string_sort_parallel(entries.data(), entries.size(),
+    detail::string_table_key(table), thread_count);
+}
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_SORT_HPP
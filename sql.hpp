@@ -0,0 +1,303 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_SQL_HPP
+#define DMITIGR_STR_SQL_HPP
+
+#include "exceptions.hpp"
+#include "numeric.hpp"
+#include "simd.hpp"
+#include "utf8.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace dmitigr::str {
+
+// -----------------------------------------------------------------------------
+// SQL quoting
+// -----------------------------------------------------------------------------
+
+namespace detail {
+
+/**
+ * @brief Writes `str` with each of `quote` doubled, and each backslash
+ * doubled if `is_backslash_escaped`, to `out`.
+ *
+ * @returns The pointer past the last written byte.
+ */
+inline char* write_sql_escaped(const std::string_view str, char* out,
+  const char quote, const bool is_backslash_escaped) noexcept
+{
+  const char specials[]{quote, '\\'};
+  const char* p{str.data()};
+  const char* const e{p + str.size()};
+  while (true) {
+    const auto* const s = find_any_byte(p, e, specials,
+      is_backslash_escaped ? 2 : 1);
+    if (s != p) {
+      std::memcpy(out, p, static_cast<std::size_t>(s - p));
+      out += s - p;
+    }
+    if (s == e)
+      break;
+    *out++ = *s;
+    *out++ = *s;
+    p = s + 1;
+  }
+  return out;
+}
+
+} // namespace detail
+
+/// @returns The maximum size of the quoted SQL identifier or literal of `size` bytes.
+constexpr std::size_t sql_quoted_max_size(const std::size_t size) noexcept
+{
+  return size * 2 + 3; // E'...'
+}
+
+/**
+ * @returns `true` if `str` contains the double quotes which must be doubled
+ * in the quoted identifier.
+ *
+ * @details The search is vectorized, so this is the cheap check whether `str`
+ * can be quoted by just enclosing it in double quotes.
+ */
+inline bool is_sql_identifier_escaping_required(const std::string_view str) noexcept
+{
+  const auto* const e = str.data() + str.size();
+  return detail::find_any_byte(str.data(), e, "\"", 1) != e;
+}
+
+/**
+ * @returns `true` if `str` contains the single quotes or backslashes which
+ * must be escaped in the quoted literal.
+ *
+ * @see is_sql_identifier_escaping_required().
+ */
+inline bool is_sql_literal_escaping_required(const std::string_view str) noexcept
+{
+  const auto* const e = str.data() + str.size();
+  return detail::find_any_byte(str.data(), e, "'\\", 2) != e;
+}
+
+/**
+ * @brief Writes `str` quoted as SQL identifier (enclosed in double quotes,
+ * with the double quotes doubled) to `out`.
+ *
+ * @returns The number of bytes written.
+ *
+ * @par Requires
+ * `out` has space for `sql_quoted_max_size(str.size())` bytes.
+ */
+inline std::size_t quote_sql_identifier(const std::string_view str,
+  char* const out) noexcept
+{
+  char* o{out};
+  *o++ = '"';
+  o = detail::write_sql_escaped(str, o, '"', false);
+  *o++ = '"';
+  return static_cast<std::size_t>(o - out);
+}
+
+/**
+ * @brief Writes `str` quoted as SQL literal to `out`.
+ *
+ * @details The literal is enclosed in single quotes, with the single quotes
+ * doubled. If `str` contains backslashes, the literal is written as the
+ * escape string (`E'...'`) with the backslashes doubled, so it's interpreted
+ * equally regardless of `standard_conforming_strings` of PostgreSQL.
+ *
+ * @returns The number of bytes written.
+ *
+ * @par Requires
+ * `out` has space for `sql_quoted_max_size(str.size())` bytes.
+ */
+inline std::size_t quote_sql_literal(const std::string_view str,
+  char* const out) noexcept
+{
+  const auto* const e = str.data() + str.size();
+  const bool has_backslash{detail::find_any_byte(str.data(), e, "\\", 1) != e};
+  char* o{out};
+  if (has_backslash)
+    *o++ = 'E';
+  *o++ = '\'';
+  o = detail::write_sql_escaped(str, o, '\'', has_backslash);
+  *o++ = '\'';
+  return static_cast<std::size_t>(o - out);
+}
+
+/// @returns `str` quoted as SQL identifier.
+inline std::string to_quoted_sql_identifier(const std::string_view str)
+{
+  std::string result(sql_quoted_max_size(str.size()), '\0');
+  result.resize(quote_sql_identifier(str, result.data()));
+  return result;
+}
+
+/// @returns `str` quoted as SQL literal.
+inline std::string to_quoted_sql_literal(const std::string_view str)
+{
+  std::string result(sql_quoted_max_size(str.size()), '\0');
+  result.resize(quote_sql_literal(str, result.data()));
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+// SQL unquoting
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Writes the content of quoted SQL identifier `str` (with the doubled
+ * double quotes replaced by the single ones) to `out`.
+ *
+ * @returns The number of bytes written.
+ *
+ * @par Requires
+ * `out` has space for `str.size()` bytes.
+ *
+ * @throws Exception if `str` is not the quoted identifier.
+ */
+inline std::size_t unquote_sql_identifier(const std::string_view str,
+  char* const out)
+{
+  const auto invalid = []
+  {
+    throw Exception{"cannot unquote invalid quoted SQL identifier"};
+  };
+  if (str.size() < 2 || str.front() != '"')
+    invalid();
+
+  const char* p{str.data() + 1};
+  const char* const e{str.data() + str.size()};
+  char* o{out};
+  while (true) {
+    const auto* const q = detail::find_any_byte(p, e, "\"", 1);
+    if (q == e)
+      invalid();
+    std::memcpy(o, p, static_cast<std::size_t>(q - p));
+    o += q - p;
+    if (q + 1 == e)
+      break;
+    else if (q[1] != '"')
+      invalid();
+    *o++ = '"';
+    p = q + 2;
+  }
+  return static_cast<std::size_t>(o - out);
+}
+
+/**
+ * @brief Writes the content of quoted SQL literal `str` to `out`.
+ *
+ * @details Both the standard strings (`'...'`) and the escape strings
+ * (`E'...'` or `e'...'`) are accepted. In the escape strings the sequences
+ * `\b`, `\f`, `\n`, `\r`, `\t`, the octal `\ooo`, the hexadecimal `\xhh`, and
+ * the Unicode `\uXXXX` and `\UXXXXXXXX` (written in UTF-8) are recognized, and
+ * the backslash followed by any other character denotes that character.
+ *
+ * @returns The number of bytes written.
+ *
+ * @par Requires
+ * `out` has space for `str.size()` bytes.
+ *
+ * @throws Exception if `str` is not the valid quoted literal.
+ */
+inline std::size_t unquote_sql_literal(std::string_view str, char* const out)
+{
+  const auto invalid = []
+  {
+    throw Exception{"cannot unquote invalid quoted SQL literal"};
+  };
+  const bool is_escape{!str.empty() && (str.front() == 'E' || str.front() == 'e')};
+  if (is_escape)
+    str.remove_prefix(1);
+  if (str.size() < 2 || str.front() != '\'')
+    invalid();
+
+  const char* p{str.data() + 1};
+  const char* const e{str.data() + str.size()};
+  char* o{out};
+  while (true) {
+    const auto* const s = detail::find_any_byte(p, e, "'\\", is_escape ? 2 : 1);
+    if (s == e)
+      invalid();
+    std::memcpy(o, p, static_cast<std::size_t>(s - p));
+    o += s - p;
+    if (*s == '\'') {
+      if (s + 1 == e)
+        break;
+      else if (s[1] != '\'')
+        invalid();
+      *o++ = '\'';
+      p = s + 2;
+      continue;
+    }
+
+    // The escape sequence.
+    if (e - s < 2)
+      invalid();
+    p = s + 2;
+    switch (const auto ch = s[1]) {
+    case 'b': *o++ = '\b'; break;
+    case 'f': *o++ = '\f'; break;
+    case 'n': *o++ = '\n'; break;
+    case 'r': *o++ = '\r'; break;
+    case 't': *o++ = '\t'; break;
+    case 'u':
+    case 'U': {
+      const auto cp = utf8::detail::read_unicode_escape(p, e, ch == 'u' ? 4 : 8);
+      if (!cp || (*cp >= 0xD800 && *cp <= 0xDFFF) || *cp > 0x10FFFF)
+        invalid();
+      o += utf8::encode(*cp, o);
+      break;
+    }
+    default:
+      *o++ = detail::unescape_c_byte(ch, p, e);
+    }
+  }
+  return static_cast<std::size_t>(o - out);
+}
+
+/**
+ * @returns The content of quoted SQL identifier `str`.
+ *
+ * @see unquote_sql_identifier().
+ */
+inline std::string to_unquoted_sql_identifier(const std::string_view str)
+{
+  std::string result(str.size(), '\0');
+  result.resize(unquote_sql_identifier(str, result.data()));
+  return result;
+}
+
+/**
+ * @returns The content of quoted SQL literal `str`.
+ *
+ * @see unquote_sql_literal().
+ */
+inline std::string to_unquoted_sql_literal(const std::string_view str)
+{
+  std::string result(str.size(), '\0');
+  result.resize(unquote_sql_literal(str, result.data()));
+  return result;
+}
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_SQL_HPP
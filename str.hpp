@@ -17,17 +17,42 @@
 #ifndef DMITIGR_STR_STR_HPP
 #define DMITIGR_STR_STR_HPP
 
+#include "aho_corasick.hpp"
 #include "basics.hpp"
+#include "byte_set.hpp"
 #include "c_str.h"
 #include "c_str.hpp"
+#include "compare.hpp"
+#include "copy_format.hpp"
+#include "dedup.hpp"
+#include "diff.hpp"
 #include "exceptions.hpp"
+#include "external_sort.hpp"
+#include "fields.hpp"
+#include "fixed_width.hpp"
+#include "fm_index.hpp"
+#include "front_coding.hpp"
+#include "glob.hpp"
+#include "grep.hpp"
+#include "json.hpp"
 #include "line.hpp"
+#include "mapped_file.hpp"
 #include "numeric.hpp"
 #include "predicate.hpp"
+#include "radix_tree.hpp"
 #include "sequence.hpp"
+#include "sort.hpp"
+#include "sql.hpp"
 #include "stream.hpp"
+#include "string_table.hpp"
 #include "substr.hpp"
+#include "suffix_array.hpp"
 #include "transform.hpp"
+#include "trigram_index.hpp"
+#include "url.hpp"
+#include "utf8.hpp"
+#include "utf8_case.hpp"
+#include "utf8_normalization.hpp"
 #include "walker.hpp"
 
 #endif  // DMITIGR_STR_STR_HPP
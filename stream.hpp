@@ -19,9 +19,11 @@
 
 #include "../base/ret.hpp"
 #include "../base/fsx.hpp"
+#include "aho_corasick.hpp"
 #include "basics.hpp"
 #include "exceptions.hpp"
 #include "predicate.hpp"
+#include "utf8.hpp"
 
 #include <algorithm>
 #include <array>
@@ -32,6 +34,7 @@
 #include <optional>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace dmitigr::str {
@@ -74,6 +77,78 @@ read_to_strings_if(const std::filesystem::path& path,
   return read_to_strings_if(input, pred, delimiter);
 }
 
+/**
+ * @brief Reads the lines which contain any of the patterns of `matcher` into
+ * the vector of strings.
+ *
+ * @details The input is read by the blocks of `BufSize` bytes, and `matcher`
+ * runs over all of the complete lines of the block at once. Only the lines
+ * which contain the occurrences are extracted, and the search is resumed from
+ * the next line after each occurrence. Thus, the non-matching lines are never
+ * copied. The result is the same as of read_to_strings_if() with the
+ * predicate which returns `matcher.is_match(line)`.
+ *
+ * @par Requires
+ * The patterns of `matcher` don't contain `delimiter`.
+ */
+template<std::size_t BufSize = 65536>
+std::vector<std::string>
+read_to_strings_if(std::istream& input, const Aho_corasick& matcher,
+  const char delimiter = '\n')
+{
+  std::vector<std::string> result;
+  std::string buffer;
+  const auto extract = [&](const std::string_view lines)
+  {
+    for (std::size_t pos{}; pos < lines.size();) {
+      const auto [begin, end] = detail::find_matching_line(matcher, lines, pos,
+        delimiter);
+      if (begin == std::string_view::npos)
+        break;
+
+      result.emplace_back(lines.substr(begin, end - begin));
+      pos = end + 1;
+    }
+  };
+
+  while (true) {
+    const auto old_size = buffer.size();
+    buffer.resize(old_size + BufSize);
+    input.read(buffer.data() + old_size, BufSize);
+    buffer.resize(old_size + static_cast<std::size_t>(input.gcount()));
+    if (!input) {
+      extract(buffer);
+      break;
+    }
+
+    // Process the complete lines only.
+    const auto last = std::string_view{buffer}.substr(old_size).rfind(delimiter);
+    if (last != std::string_view::npos) {
+      const auto size = old_size + last + 1;
+      extract(std::string_view{buffer}.substr(0, size));
+      buffer.erase(0, size);
+    }
+  }
+  return result;
+}
+
+/**
+ * @overload
+ *
+ * @param path The path to the file to read the data from.
+ * @param is_binary The indicator of binary read mode.
+ */
+template<std::size_t BufSize = 65536>
+std::vector<std::string>
+read_to_strings_if(const std::filesystem::path& path,
+  const Aho_corasick& matcher, const char delimiter = '\n',
+  const bool is_binary = true)
+{
+  constexpr std::ios_base::openmode in{std::ios_base::in};
+  std::ifstream input{path, is_binary ? in | std::ios_base::binary : in};
+  return read_to_strings_if<BufSize>(input, matcher, delimiter);
+}
+
 /**
  * @brief The convenient shortcut of read_to_strings_if().
  *
@@ -118,7 +193,7 @@ std::string read_to_string(std::istream& input, const std::optional<Trim> trim =
     std::size_t space_count{};
     if (trim && !lhs_trimmed && static_cast<bool>(*trim & Trim::lhs)) {
       for (const auto ch : buffer) {
-        if (!is_space(ch)) {
+        if (!Is_space{}(ch)) {
           lhs_trimmed = true;
           break;
         } else
@@ -135,7 +210,7 @@ std::string read_to_string(std::istream& input, const std::optional<Trim> trim =
   if (trim && static_cast<bool>(*trim & Trim::rhs)) {
     const auto rb = crbegin(result);
     const auto re = crend(result);
-    const auto te = find_if(rb, re, is_not_visible).base();
+    const auto te = find_if(rb, re, Is_not_visible{}).base();
     result.resize(te - cbegin(result));
   }
 
@@ -185,6 +260,277 @@ std::string read_to_string(const std::filesystem::path& path,
     throw Exception{err};
 }
 
+// -----------------------------------------------------------------------------
+// Encoding detection
+// -----------------------------------------------------------------------------
+
+/// The result of the encoding detection.
+struct Encoding_detection final {
+  /// The detected encoding.
+  Encoding encoding{Encoding::utf8};
+
+  /// The size of the byte order mark, or `0` if there is no BOM.
+  std::size_t bom_size{};
+};
+
+/**
+ * @brief Detects the encoding of the text which starts with `head`.
+ *
+ * @details The byte order marks of UTF-8, UTF-16 and UTF-32 are recognized.
+ * Without BOM, UTF-16 is guessed by the zero bytes which are typical for a
+ * mostly ASCII text: the zeros at odd positions for UTF-16LE, or at even
+ * positions for UTF-16BE. Otherwise UTF-8 is assumed.
+ */
+inline Encoding_detection detect_encoding(const std::string_view head) noexcept
+{
+  const auto size = head.size();
+  const auto b = [head](const std::size_t i) noexcept
+  {
+    return static_cast<unsigned char>(head[i]);
+  };
+  if (size >= 4) {
+    if (b(0) == 0xFF && b(1) == 0xFE && !b(2) && !b(3))
+      return {Encoding::utf32le, 4};
+    else if (!b(0) && !b(1) && b(2) == 0xFE && b(3) == 0xFF)
+      return {Encoding::utf32be, 4};
+  }
+  if (size >= 3 && b(0) == 0xEF && b(1) == 0xBB && b(2) == 0xBF)
+    return {Encoding::utf8, 3};
+  if (size >= 2) {
+    if (b(0) == 0xFF && b(1) == 0xFE)
+      return {Encoding::utf16le, 2};
+    else if (b(0) == 0xFE && b(1) == 0xFF)
+      return {Encoding::utf16be, 2};
+  }
+
+  // At least a quarter of units must have the zero byte at the one position,
+  // and there must be rare zeros at the other position.
+  const std::size_t unit_count{size / 2};
+  std::size_t even_zeros{};
+  std::size_t odd_zeros{};
+  for (std::size_t i{}; i < unit_count; ++i) {
+    even_zeros += !head[2*i];
+    odd_zeros += !head[2*i + 1];
+  }
+  if (unit_count && odd_zeros*4 >= unit_count && even_zeros*8 <= odd_zeros)
+    return {Encoding::utf16le, 0};
+  else if (unit_count && even_zeros*4 >= unit_count && odd_zeros*8 <= even_zeros)
+    return {Encoding::utf16be, 0};
+  else
+    return {};
+}
+
+namespace detail {
+
+/**
+ * @brief The incremental transcoder of UTF-16 and UTF-32 to UTF-8.
+ *
+ * @details The input can be splitted at arbitrary positions, including the
+ * middle of the code unit or of the surrogate pair. The invalid code units
+ * are replaced with utf8::replacement_character.
+ */
+class Utf8_transcoder final {
+public:
+  /// The constructor. UTF-8 input is appended as is.
+  explicit Utf8_transcoder(const Encoding encoding) noexcept
+    : encoding_{encoding}
+  {}
+
+  /// Appends the transcoded `[p, p + size)` to `result`.
+  void append(std::string& result, const char* p, std::size_t size)
+  {
+    switch (encoding_) {
+    case Encoding::utf8: result.append(p, size); return;
+    case Encoding::utf16le: return append<Encoding::utf16le>(result, p, size);
+    case Encoding::utf16be: return append<Encoding::utf16be>(result, p, size);
+    case Encoding::utf32le: return append<Encoding::utf32le>(result, p, size);
+    case Encoding::utf32be: return append<Encoding::utf32be>(result, p, size);
+    }
+  }
+
+  /// Appends the replacement of incomplete input (if any) to `result`.
+  void finish(std::string& result)
+  {
+    if (high_surrogate_ || pending_size_)
+      utf8::append(result, utf8::replacement_character);
+    high_surrogate_ = 0;
+    pending_size_ = 0;
+  }
+
+private:
+  Encoding encoding_;
+  char32_t high_surrogate_{};
+  std::size_t pending_size_{};
+  char pending_[4];
+
+  template<Encoding E>
+  static constexpr std::size_t unit_size() noexcept
+  {
+    return E == Encoding::utf16le || E == Encoding::utf16be ? 2 : 4;
+  }
+
+  template<Encoding E>
+  static char32_t load(const char* const p) noexcept
+  {
+    const auto b = [p](const int i) noexcept
+    {
+      return static_cast<char32_t>(static_cast<unsigned char>(p[i]));
+    };
+    if constexpr (E == Encoding::utf16le)
+      return b(0) | b(1) << 8;
+    else if constexpr (E == Encoding::utf16be)
+      return b(0) << 8 | b(1);
+    else if constexpr (E == Encoding::utf32le)
+      return b(0) | b(1) << 8 | b(2) << 16 | b(3) << 24;
+    else
+      return b(0) << 24 | b(1) << 16 | b(2) << 8 | b(3);
+  }
+
+  template<Encoding E>
+  char* put(char* out, const char32_t unit) noexcept
+  {
+    if (unit < 0x80) {
+      if (high_surrogate_) {
+        out += utf8::encode(utf8::replacement_character, out);
+        high_surrogate_ = 0;
+      }
+      *out = static_cast<char>(unit);
+      return out + 1;
+    }
+
+    if constexpr (unit_size<E>() == 2) {
+      if (unit >= 0xDC00 && unit <= 0xDFFF && high_surrogate_) {
+        const auto cp = 0x10000 + ((high_surrogate_ - 0xD800) << 10)
+          + (unit - 0xDC00);
+        high_surrogate_ = 0;
+        return out + utf8::encode(cp, out);
+      }
+      if (high_surrogate_) {
+        out += utf8::encode(utf8::replacement_character, out);
+        high_surrogate_ = 0;
+      }
+      if (unit >= 0xD800 && unit <= 0xDBFF) {
+        high_surrogate_ = unit;
+        return out;
+      }
+    }
+
+    const bool is_valid{unit <= 0x10FFFF && !(unit >= 0xD800 && unit <= 0xDFFF)};
+    return out + utf8::encode(is_valid ? unit : utf8::replacement_character, out);
+  }
+
+  template<Encoding E>
+  void append(std::string& result, const char* p, std::size_t size)
+  {
+    constexpr std::size_t unit{unit_size<E>()};
+    constexpr std::size_t max_unit_size{unit == 2 ? 3 : 4};
+    const std::size_t offset{result.size()};
+    result.resize(offset + (pending_size_ + size) / unit * max_unit_size
+      + max_unit_size);
+    char* out = result.data() + offset;
+
+    // Complete the unit which was splitted by the previous call.
+    for (; pending_size_ && size; --size) {
+      pending_[pending_size_++] = *p++;
+      if (pending_size_ == unit) {
+        out = put<E>(out, load<E>(pending_));
+        pending_size_ = 0;
+      }
+    }
+
+    const char* const e = p + size - size % unit;
+    for (; p != e; p += unit)
+      out = put<E>(out, load<E>(p));
+    for (size %= unit; pending_size_ < size;)
+      pending_[pending_size_++] = *p++;
+
+    result.resize(static_cast<std::size_t>(out - result.data()));
+  }
+};
+
+} // namespace detail
+
+/**
+ * @brief Reads a whole `input` stream of text to a string.
+ *
+ * @details The encoding is detected by detect_encoding() from the first
+ * `BufSize` bytes of `input`. The byte order mark is stripped. If
+ * `is_transcode`, the text is transcoded to UTF-8 in the same pass as reading,
+ * so the untranscoded copy of the text is never held in memory. The invalid
+ * code units are replaced with utf8::replacement_character while transcoding.
+ *
+ * @param[out] encoding The detected encoding of `input`.
+ *
+ * @par Requires
+ * `!(BufSize % 8)`.
+ *
+ * @returns The string with the text read from the `input`, in UTF-8 if
+ * `is_transcode`, or in the `encoding` otherwise.
+ */
+template<std::size_t BufSize = 4096>
+std::string read_to_string(std::istream& input, Encoding& encoding,
+  const bool is_transcode = true)
+{
+  std::string result;
+  std::array<char, BufSize> buffer;
+  static_assert(!(buffer.size() % 8));
+
+  input.read(buffer.data(), buffer.size());
+  const auto size = static_cast<std::size_t>(input.gcount());
+  const auto detection = detect_encoding({buffer.data(), size});
+  encoding = detection.encoding;
+  detail::Utf8_transcoder transcoder{is_transcode ? encoding : Encoding::utf8};
+  transcoder.append(result, buffer.data() + detection.bom_size,
+    size - detection.bom_size);
+  while (input) {
+    input.read(buffer.data(), buffer.size());
+    transcoder.append(result, buffer.data(),
+      static_cast<std::size_t>(input.gcount()));
+  }
+  transcoder.finish(result);
+  return result;
+}
+
+/**
+ * @brief Reads the text file into an instance of `std::string`.
+ *
+ * @param path The path to the file to read the data from.
+ *
+ * @see read_to_string(std::istream&, Encoding&, bool).
+ */
+template<std::size_t BufSize = 4096>
+Ret<std::string> read_to_string_nothrow(const std::filesystem::path& path,
+  Encoding& encoding, const bool is_transcode = true)
+{
+  using Ret = Ret<std::string>;
+  std::ifstream input{path, std::ios_base::in | std::ios_base::binary};
+  if (input)
+    return Ret::make_result(read_to_string<BufSize>(input, encoding,
+        is_transcode));
+  else
+    return Ret::make_error(Err{Errc::generic,
+        "unable to open \"" + path.generic_string() + "\""});
+}
+
+/**
+ * @brief Reads the text file into an instance of `std::string`.
+ *
+ * @param path The path to the file to read the data from.
+ *
+ * @see read_to_string(std::istream&, Encoding&, bool).
+ */
+template<std::size_t BufSize = 4096>
+std::string read_to_string(const std::filesystem::path& path,
+  Encoding& encoding, const bool is_transcode = true)
+{
+  auto [err, res] = read_to_string_nothrow<BufSize>(path, encoding,
+    is_transcode);
+  if (!err)
+    return res;
+  else
+    throw Exception{err};
+}
+
 } // namespace dmitigr::str
 
 #endif  // DMITIGR_STR_STREAM_HPP
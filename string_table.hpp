@@ -0,0 +1,274 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_STRING_TABLE_HPP
+#define DMITIGR_STR_STRING_TABLE_HPP
+
+#include "exceptions.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dmitigr::str {
+
+/**
+ * @brief The flat table of strings.
+ *
+ * @details All of the strings are stored contiguously in the single buffer,
+ * and each string is denoted by the entry of its offset and size. Thus, the
+ * table has no per string allocations and the entries can be reordered (e.g.
+ * sorted) without moving the string data.
+ */
+class String_table final {
+public:
+  /// The size type.
+  using size_type = std::size_t;
+
+  /// The entry of the string.
+  struct Entry final {
+    /// The offset of the string in data().
+    size_type offset{};
+
+    /// The size of the string.
+    size_type size{};
+  };
+
+  /// The constant iterator over the strings.
+  class const_iterator final {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = std::string_view;
+
+    const_iterator() = default;
+
+    reference operator*() const noexcept
+    {
+      return {data_ + entry_->offset, entry_->size};
+    }
+
+    reference operator[](const difference_type n) const noexcept
+    {
+      return *(*this + n);
+    }
+
+    const_iterator& operator++() noexcept { ++entry_; return *this; }
+    const_iterator operator++(int) noexcept { auto r = *this; ++entry_; return r; }
+    const_iterator& operator--() noexcept { --entry_; return *this; }
+    const_iterator operator--(int) noexcept { auto r = *this; --entry_; return r; }
+
+    const_iterator& operator+=(const difference_type n) noexcept
+    {
+      entry_ += n;
+      return *this;
+    }
+
+    const_iterator& operator-=(const difference_type n) noexcept
+    {
+      entry_ -= n;
+      return *this;
+    }
+
+    friend const_iterator operator+(const_iterator i, const difference_type n) noexcept
+    {
+      return i += n;
+    }
+
+    friend const_iterator operator+(const difference_type n, const_iterator i) noexcept
+    {
+      return i += n;
+    }
+
+    friend const_iterator operator-(const_iterator i, const difference_type n) noexcept
+    {
+      return i -= n;
+    }
+
+    friend difference_type operator-(const const_iterator lhs,
+      const const_iterator rhs) noexcept
+    {
+      return lhs.entry_ - rhs.entry_;
+    }
+
+    friend bool operator==(const const_iterator lhs, const const_iterator rhs) noexcept
+    {
+      return lhs.entry_ == rhs.entry_;
+    }
+
+    friend bool operator!=(const const_iterator lhs, const const_iterator rhs) noexcept
+    {
+      return lhs.entry_ != rhs.entry_;
+    }
+
+    friend bool operator<(const const_iterator lhs, const const_iterator rhs) noexcept
+    {
+      return lhs.entry_ < rhs.entry_;
+    }
+
+    friend bool operator>(const const_iterator lhs, const const_iterator rhs) noexcept
+    {
+      return lhs.entry_ > rhs.entry_;
+    }
+
+    friend bool operator<=(const const_iterator lhs, const const_iterator rhs) noexcept
+    {
+      return lhs.entry_ <= rhs.entry_;
+    }
+
+    friend bool operator>=(const const_iterator lhs, const const_iterator rhs) noexcept
+    {
+      return lhs.entry_ >= rhs.entry_;
+    }
+
+  private:
+    friend String_table;
+
+    const char* data_{};
+    const Entry* entry_{};
+
+    const_iterator(const char* const data, const Entry* const entry) noexcept
+      : data_{data}
+      , entry_{entry}
+    {}
+  };
+
+  /// Constructs the empty table.
+  String_table() = default;
+
+  /// Constructs the table of `strings`.
+  template<class Container>
+  explicit String_table(const Container& strings)
+  {
+    size_type data_size{};
+    for (const auto& s : strings)
+      data_size += std::string_view{s}.size();
+    reserve(std::size(strings), data_size);
+    for (const auto& s : strings)
+      push_back(s);
+  }
+
+  /// @returns The number of strings.
+  size_type size() const noexcept
+  {
+    return entries_.size();
+  }
+
+  /// @returns `!size()`.
+  bool empty() const noexcept
+  {
+    return entries_.empty();
+  }
+
+  /// @returns The string at `index`.
+  std::string_view operator[](const size_type index) const noexcept
+  {
+    const auto& entry = entries_[index];
+    return {data_.data() + entry.offset, entry.size};
+  }
+
+  /// @returns The string at `index`.
+  std::string_view at(const size_type index) const
+  {
+    if (!(index < size()))
+      throw Exception{"cannot get string of String_table by invalid index"};
+    return operator[](index);
+  }
+
+  /// @returns The iterator to the first string.
+  const_iterator begin() const noexcept
+  {
+    return {data_.data(), entries_.data()};
+  }
+
+  /// @returns The iterator past the last string.
+  const_iterator end() const noexcept
+  {
+    return {data_.data(), entries_.data() + entries_.size()};
+  }
+
+  /// Reserves the space for `count` strings of total size `data_size`.
+  void reserve(const size_type count, const size_type data_size)
+  {
+    entries_.reserve(count);
+    data_.reserve(data_size);
+  }
+
+  /// Appends `str` to the table.
+  void push_back(const std::string_view str)
+  {
+    entries_.push_back(Entry{data_.size(), str.size()});
+    data_.append(str);
+  }
+
+  /// Removes all of the strings.
+  void clear() noexcept
+  {
+    entries_.clear();
+    data_.clear();
+  }
+
+  /**
+   * @brief Removes the data which is no longer referenced by the entries
+   * and places the strings in the order of entries.
+   */
+  void compact()
+  {
+    std::string data;
+    data.reserve(data_.size());
+    for (auto& entry : entries_) {
+      const auto offset = data.size();
+      data.append(data_, entry.offset, entry.size);
+      entry.offset = offset;
+    }
+    data_.swap(data);
+  }
+
+  /// @returns The buffer of string data.
+  const std::string& data() const noexcept
+  {
+    return data_;
+  }
+
+  /// @returns The entries of strings.
+  const std::vector<Entry>& entries() const noexcept
+  {
+    return entries_;
+  }
+
+  /**
+   * @returns The entries of strings.
+   *
+   * @remarks The entries can be reordered or removed, but every remaining
+   * entry must denote the range within data().
+   */
+  std::vector<Entry>& entries() noexcept
+  {
+    return entries_;
+  }
+
+private:
+  std::vector<Entry> entries_;
+  std::string data_;
+};
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_STRING_TABLE_HPP
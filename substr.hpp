@@ -19,10 +19,14 @@
 
 #include "predicate.hpp"
 #include "exceptions.hpp"
+#include "simd.hpp"
 
 #include <algorithm>
 #include <cctype>
+#include <cstddef>
+#include <iterator>
 #include <string_view>
+#include <type_traits>
 
 namespace dmitigr::str {
 
@@ -45,11 +49,66 @@ first_non_space_pos(const std::string_view str, const std::string_view::size_typ
 
   const auto b = cbegin(str);
   const auto e = cend(str);
-  const auto i = std::find_if(b + pos, e, is_not_space);
+  const auto i = std::find_if(b + pos, e, Is_not_space{});
   return i != e ? static_cast<std::string_view::size_type>(i - b)
     : std::string_view::npos;
 }
 
+// -----------------------------------------------------------------------------
+// Common prefixes and suffixes
+// -----------------------------------------------------------------------------
+
+/// @returns The length of the common prefix of `a` and `b`.
+inline std::size_t common_prefix_length(const std::string_view a,
+  const std::string_view b) noexcept
+{
+  return detail::mismatch(a.data(), b.data(), std::min(a.size(), b.size()));
+}
+
+/// @returns The length of the common suffix of `a` and `b`.
+inline std::size_t common_suffix_length(const std::string_view a,
+  const std::string_view b) noexcept
+{
+  const auto size = std::min(a.size(), b.size());
+  return detail::rmismatch(a.data() + a.size() - size,
+    b.data() + b.size() - size, size);
+}
+
+/**
+ * @returns The longest common prefix of the strings of `range`, or the empty
+ * view if `range` is empty. The result refers to the first string of `range`.
+ *
+ * @details The candidate prefix is narrowed with each string, so each string
+ * is inspected up to the length of the current candidate only. For the
+ * sorted range, the result is the common prefix of the first and the last
+ * strings.
+ *
+ * @par Requires
+ * The elements of `range` are either lvalues or views, and the strings they
+ * refer to outlive the result.
+ */
+template<class Range>
+std::string_view longest_common_prefix(const Range& range) noexcept
+{
+  using Reference = decltype(*std::begin(range));
+  static_assert(std::is_lvalue_reference_v<Reference>
+    || std::is_same_v<std::decay_t<Reference>, std::string_view>,
+    "the strings of range must outlive the result of longest_common_prefix()");
+
+  auto i = std::begin(range);
+  const auto e = std::end(range);
+  if (i == e)
+    return {};
+
+  const std::string_view first{*i};
+  std::size_t size{first.size()};
+  for (++i; i != e && size; ++i) {
+    const std::string_view str{*i};
+    size = detail::mismatch(first.data(), str.data(), std::min(size, str.size()));
+  }
+  return first.substr(0, size);
+}
+
 } // namespace dmitigr::str
 
 #endif  // DMITIGR_STR_SUBSTR_HPP
@@ -0,0 +1,188 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_SUFFIX_ARRAY_HPP
+#define DMITIGR_STR_SUFFIX_ARRAY_HPP
+
+#include "exceptions.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace dmitigr::str {
+
+// -----------------------------------------------------------------------------
+// Suffix array
+// -----------------------------------------------------------------------------
+
+namespace detail {
+
+/**
+ * @returns The suffix array of `s` of size `n` with the characters in range
+ * `[0, upper]`.
+ *
+ * @details Uses the SA-IS algorithm (induced sorting) of Nong, Zhang and Chan,
+ * which works in O(n) time. The LMS substrings are sorted by the induced
+ * sorting, then named, and the suffixes of the reduced string of names are
+ * sorted recursively if the names are not unique.
+ */
+template<typename Index, typename Char>
+std::vector<Index> sa_is(const Char* const s, const Index n, const Index upper)
+{
+  constexpr auto empty = std::numeric_limits<Index>::max();
+  const auto at = [s](const Index i) noexcept
+  {
+    return static_cast<std::size_t>(s[i]);
+  };
+
+  if (!n)
+    return {};
+  else if (n == 1)
+    return {0};
+  else if (n == 2)
+    return s[0] < s[1] ? std::vector<Index>{0, 1} : std::vector<Index>{1, 0};
+
+  // Classify the suffixes as S-type (`true`) or L-type (`false`).
+  std::vector<bool> ls(n);
+  for (Index i{n - 1}; i-- > 0;)
+    ls[i] = s[i] == s[i + 1] ? ls[i + 1] : s[i] < s[i + 1];
+
+  // Compute the starts of L-type and S-type areas of the buckets.
+  std::vector<Index> sum_l(static_cast<std::size_t>(upper) + 1);
+  std::vector<Index> sum_s(sum_l.size());
+  for (Index i{}; i < n; ++i) {
+    if (!ls[i])
+      ++sum_s[at(i)];
+    else
+      ++sum_l[at(i) + 1];
+  }
+  for (std::size_t c{}; c <= upper; ++c) {
+    sum_s[c] += sum_l[c];
+    if (c < upper)
+      sum_l[c + 1] += sum_s[c];
+  }
+
+  std::vector<Index> sa(n);
+  std::vector<Index> buf(sum_l.size());
+  const auto induce = [&](const std::vector<Index>& lms)
+  {
+    std::fill(sa.begin(), sa.end(), empty);
+    std::copy(sum_s.begin(), sum_s.end(), buf.begin());
+    for (const auto d : lms) {
+      if (d != n)
+        sa[buf[at(d)]++] = d;
+    }
+    std::copy(sum_l.begin(), sum_l.end(), buf.begin());
+    sa[buf[at(n - 1)]++] = n - 1;
+    for (Index i{}; i < n; ++i) {
+      const auto v = sa[i];
+      if (v != empty && v && !ls[v - 1])
+        sa[buf[at(v - 1)]++] = v - 1;
+    }
+    std::copy(sum_l.begin(), sum_l.end(), buf.begin());
+    for (Index i{n}; i-- > 0;) {
+      const auto v = sa[i];
+      if (v != empty && v && ls[v - 1])
+        sa[--buf[at(v - 1) + 1]] = v - 1;
+    }
+  };
+
+  // Find the leftmost S-type suffixes (LMS).
+  std::vector<Index> lms_map(static_cast<std::size_t>(n) + 1, empty);
+  std::vector<Index> lms;
+  for (Index i{1}; i < n; ++i) {
+    if (!ls[i - 1] && ls[i]) {
+      lms_map[i] = static_cast<Index>(lms.size());
+      lms.push_back(i);
+    }
+  }
+  const auto m = static_cast<Index>(lms.size());
+
+  induce(lms);
+  if (!m)
+    return sa;
+
+  // Name the sorted LMS substrings.
+  std::vector<Index> sorted_lms;
+  sorted_lms.reserve(m);
+  for (const auto v : sa) {
+    if (lms_map[v] != empty)
+      sorted_lms.push_back(v);
+  }
+  std::vector<Index> rec_s(m);
+  Index rec_upper{};
+  rec_s[lms_map[sorted_lms[0]]] = 0;
+  for (Index i{1}; i < m; ++i) {
+    auto l = sorted_lms[i - 1], r = sorted_lms[i];
+    const auto end_l = lms_map[l] + 1 < m ? lms[lms_map[l] + 1] : n;
+    const auto end_r = lms_map[r] + 1 < m ? lms[lms_map[r] + 1] : n;
+    bool is_same{end_l - l == end_r - r};
+    if (is_same) {
+      for (; l < end_l && s[l] == s[r]; ++l, ++r);
+      if (l == n || s[l] != s[r])
+        is_same = false;
+    }
+    if (!is_same)
+      ++rec_upper;
+    rec_s[lms_map[sorted_lms[i]]] = rec_upper;
+  }
+  std::vector<Index>{}.swap(lms_map);
+
+  // Sort the LMS suffixes and induce the rest.
+  if (rec_upper + 1 < m) {
+    const auto rec_sa = sa_is<Index>(rec_s.data(), m, rec_upper);
+    for (Index i{}; i < m; ++i)
+      sorted_lms[i] = lms[rec_sa[i]];
+  } else {
+    for (Index i{}; i < m; ++i)
+      sorted_lms[rec_s[i]] = lms[i];
+  }
+  induce(sorted_lms);
+  return sa;
+}
+
+} // namespace detail
+
+/**
+ * @returns The suffix array of `text`, i.e. the starting positions of all of
+ * the non-empty suffixes of `text` in the lexicographic order (bytes are
+ * compared as unsigned).
+ *
+ * @details Uses the SA-IS algorithm which works in O(n) time and requires
+ * about `2 * sizeof(Index)` bytes of memory per character of `text` in
+ * addition to the result.
+ *
+ * @par Requires
+ * `text.size() < std::numeric_limits<Index>::max()`.
+ */
+template<typename Index = std::size_t>
+std::vector<Index> suffix_array(const std::string_view text)
+{
+  static_assert(std::is_unsigned_v<Index> && sizeof(Index) > 1);
+  if (!(text.size() < std::numeric_limits<Index>::max()))
+    throw Exception{"cannot build suffix array of text which is too large "
+      "for index type"};
+  return detail::sa_is(reinterpret_cast<const unsigned char*>(text.data()),
+    static_cast<Index>(text.size()), Index{255});
+}
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_SUFFIX_ARRAY_HPP
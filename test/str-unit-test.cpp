@@ -90,6 +90,155 @@ int main()
       DMITIGR_ASSERT(sv == "con ten t");
     }
 
+    // Wide strings
+    {
+      auto ws = str::trimmed(std::wstring{L" \t content \n"});
+      DMITIGR_ASSERT(ws == L"content");
+
+      std::u16string u16(40, u' ');
+      u16 += u"\u3000con tent\u00a0";
+      u16 += std::u16string(40, u'\n');
+      DMITIGR_ASSERT(str::trimmed(std::u16string_view{u16}) == u"con tent");
+      str::trim(u16, str::Trim::rhs);
+      DMITIGR_ASSERT(u16.size() == 40 + 9);
+
+      std::u32string u32{U"\t\U0001F600 \u2003"};
+      str::trim(u32);
+      DMITIGR_ASSERT(u32 == U"\U0001F600");
+      DMITIGR_ASSERT(str::is_blank(std::u32string_view{U" \u3000"}));
+
+      bool (*const is_space)(int) noexcept = &str::is_space;
+      DMITIGR_ASSERT(is_space(' ') && str::Is_space{}(U'\u3000'));
+      DMITIGR_ASSERT(std::count_if(ws.begin(), ws.end(), str::is_not_space) == 7);
+    }
+
+    // -------------------------------------------------------------------------
+    // UTF-8 trim
+    // -------------------------------------------------------------------------
+
+    // String with only Unicode spaces
+    {
+      const auto s = "  　\t \u0085"sv;
+      DMITIGR_ASSERT(str::utf8::is_blank(s));
+      DMITIGR_ASSERT(str::utf8::trimmed(s).empty());
+      DMITIGR_ASSERT(!str::utf8::is_blank(" x"sv));
+    }
+
+    // String with Unicode spaces from both sides
+    {
+      std::string s{"　  con tent   　"};
+      DMITIGR_ASSERT(str::utf8::trimmed(s) == "con tent");
+      DMITIGR_ASSERT(str::utf8::trimmed(s, str::Trim::lhs)
+        == "con tent   　");
+      DMITIGR_ASSERT(str::utf8::trimmed(s, str::Trim::rhs)
+        == "　  con tent");
+      str::utf8::trim(s);
+      DMITIGR_ASSERT(s == "con tent");
+      DMITIGR_ASSERT(str::utf8::has_space(s));
+    }
+
+    // Non-space characters which share the lead bytes with spaces
+    {
+      const auto s = "©‐ x 、"sv;
+      DMITIGR_ASSERT(str::utf8::trimmed(s) == s);
+    }
+
+    // Long strings take the vectorized path
+    {
+      const std::string s = std::string(40, ' ') + " x" + std::string(40, '\n');
+      DMITIGR_ASSERT(str::utf8::trimmed(s) == "x");
+
+      const std::string t = std::string(40, 'x') + "\xc3\xa9" + std::string(40, 'y');
+      DMITIGR_ASSERT(!str::utf8::has_space(t));
+      DMITIGR_ASSERT(str::utf8::has_space(t + "\xe3\x80\x80"));
+    }
+
+    // Splitting by Unicode spaces
+    {
+      const auto v = str::utf8::to_vector<std::string_view>(
+        "　one two  three "sv);
+      DMITIGR_ASSERT(v.size() == 3);
+      DMITIGR_ASSERT(v[0] == "one");
+      DMITIGR_ASSERT(v[1] == "two");
+      DMITIGR_ASSERT(v[2] == "three");
+      DMITIGR_ASSERT(str::utf8::to_vector("   "sv).empty());
+    }
+
+    // -------------------------------------------------------------------------
+    // UTF-8 case
+    // -------------------------------------------------------------------------
+
+    {
+      namespace utf8 = str::utf8;
+      DMITIGR_ASSERT(utf8::to_lowercase("Hello, МИР! ΣΑΣ"sv) == "hello, мир! σασ");
+      DMITIGR_ASSERT(utf8::to_uppercase("Hello, мир! ß"sv) == "HELLO, МИР! ß");
+      DMITIGR_ASSERT(utf8::to_casefolded("ΣΑΣ ς µ"sv) == "σασ σ μ");
+
+      // The size of the result may differ from the size of the input.
+      DMITIGR_ASSERT(utf8::lowercased_size("K"sv) == 1); // KELVIN SIGN
+      DMITIGR_ASSERT(utf8::to_lowercase("K"sv) == "k");
+      DMITIGR_ASSERT(utf8::uppercased_size("ɐ"sv) == 3);
+
+      // Invalid sequences are copied as is.
+      DMITIGR_ASSERT(utf8::to_uppercase("a\xff\xc3"sv) == "A\xff\xc3");
+
+      // Long ASCII runs take the vectorized path.
+      std::string s(100, 'Q');
+      s += "Ё";
+      utf8::lowercase(s);
+      DMITIGR_ASSERT(s == std::string(100, 'q') + "ё");
+
+      DMITIGR_ASSERT(utf8::is_casefold_equal("Straße Σ", "STRAẞE ς"));
+      DMITIGR_ASSERT(!utf8::is_casefold_equal("Straße", "Strasse"));
+      DMITIGR_ASSERT(utf8::casefold_compare("apple", "BANANA") < 0);
+      DMITIGR_ASSERT(utf8::casefold_compare("Яблоко", "яблоки") > 0);
+      DMITIGR_ASSERT(utf8::casefold_hash(std::string(50, 'x') + "ПРИВЕТ") ==
+        utf8::casefold_hash(std::string(50, 'X') + "привет"));
+    }
+
+    // Case conversion of wide strings
+    {
+      std::u16string u16(20, u'A');
+      u16 += u"\u0416\U00010400";
+      str::lowercase(u16);
+      DMITIGR_ASSERT(u16 == std::u16string(20, u'a') + u"\u0436\U00010428");
+      DMITIGR_ASSERT(str::to_uppercase(std::u32string{U"abc\u03c3"}) == U"ABC\u03a3");
+      DMITIGR_ASSERT(str::is_lowercased(std::u32string_view{U"\u0436z"}));
+      DMITIGR_ASSERT(str::to_lowercase(std::wstring{L"ABC"}) == L"abc");
+    }
+
+    // -------------------------------------------------------------------------
+    // UTF-8 normalization
+    // -------------------------------------------------------------------------
+
+    {
+      namespace utf8 = str::utf8;
+      using utf8::Normalization_form;
+      using utf8::Quick_check;
+      const auto composed = "Caf\u00e9 \uac01"sv;
+      const auto decomposed = "Cafe\u0301 \u1100\u1161\u11a8"sv;
+      DMITIGR_ASSERT(utf8::quick_check("plain ASCII"sv) == Quick_check::yes);
+      DMITIGR_ASSERT(utf8::quick_check(decomposed) == Quick_check::maybe);
+      DMITIGR_ASSERT(utf8::quick_check(composed, Normalization_form::nfd)
+        == Quick_check::no);
+      DMITIGR_ASSERT(utf8::is_normalized(composed));
+      DMITIGR_ASSERT(!utf8::is_normalized(decomposed));
+      DMITIGR_ASSERT(utf8::to_normalized(decomposed) == composed);
+      DMITIGR_ASSERT(utf8::to_normalized(composed, Normalization_form::nfd)
+        == decomposed);
+
+      // Canonical ordering of combining marks.
+      DMITIGR_ASSERT(utf8::to_normalized("a\u0301\u0323"sv)
+        == "\u1ea1\u0301");
+      DMITIGR_ASSERT(utf8::to_normalized("a\u0301\u0323"sv,
+          Normalization_form::nfd) == "a\u0323\u0301");
+
+      // Only the non-normalized segments are rewritten.
+      std::string s = std::string(40, 'x') + "e\u0301" + std::string(40, 'y');
+      utf8::normalize(s);
+      DMITIGR_ASSERT(s == std::string(40, 'x') + "\u00e9" + std::string(40, 'y'));
+    }
+
     // -------------------------------------------------------------------------
     // split
     // -------------------------------------------------------------------------
@@ -159,6 +308,598 @@ int main()
       DMITIGR_ASSERT(v[2] == "3");
     }
 
+    // Wide string with separators
+    {
+      const auto v = str::to_vector(std::wstring_view{L"1 2,3"}, std::wstring_view{L" ,"});
+      DMITIGR_ASSERT(v.size() == 3);
+      DMITIGR_ASSERT(v[2] == L"3");
+    }
+
+    // -------------------------------------------------------------------------
+    // Numeric
+    // -------------------------------------------------------------------------
+
+    {
+      DMITIGR_ASSERT(str::to_string(255, 16) == "FF");
+      DMITIGR_ASSERT(str::to_string(-10) == "-10");
+      DMITIGR_ASSERT(str::to_string(std::numeric_limits<int>::min())
+        == std::to_string(std::numeric_limits<int>::min()));
+      DMITIGR_ASSERT(str::to_basic_string<char16_t>(5, 2) == u"101");
+      DMITIGR_ASSERT(str::to_basic_string<wchar_t>(0) == L"0");
+    }
+
+    // -------------------------------------------------------------------------
+    // Encoding detection
+    // -------------------------------------------------------------------------
+
+    {
+      using str::Encoding;
+      DMITIGR_ASSERT(str::detect_encoding("\xEF\xBB\xBF" "a"sv).bom_size == 3);
+      DMITIGR_ASSERT(str::detect_encoding("\xFF\xFE\0\0"sv).encoding == Encoding::utf32le);
+      DMITIGR_ASSERT(str::detect_encoding("\xFF\xFE" "a\0"sv).encoding == Encoding::utf16le);
+      DMITIGR_ASSERT(str::detect_encoding("\0a\0b"sv).encoding == Encoding::utf16be);
+      DMITIGR_ASSERT(str::detect_encoding("ab"sv).encoding == Encoding::utf8);
+
+      // UTF-16LE with the surrogate pair of U+1F600 splitted by the buffer.
+      std::string utf16{"\xFF\xFE"};
+      for (int i = 0; i < 7; ++i)
+        utf16.append("a\0"sv);
+      utf16.append("\x3D\xD8\x00\xDE\xE9\x00\x00\xDC"sv);
+      Encoding encoding{};
+      std::istringstream input{utf16};
+      const auto s = str::read_to_string<16>(input, encoding);
+      DMITIGR_ASSERT(encoding == Encoding::utf16le);
+      DMITIGR_ASSERT(s == "aaaaaaa\xF0\x9F\x98\x80\xC3\xA9\xEF\xBF\xBD");
+
+      std::istringstream input32{"\0\0\xFE\xFF\0\0\0a\0\x11\0\0"s};
+      DMITIGR_ASSERT(str::read_to_string(input32, encoding) == "a\xEF\xBF\xBD");
+      DMITIGR_ASSERT(encoding == Encoding::utf32be);
+
+      std::istringstream raw{"\xFE\xFF\0a"s};
+      DMITIGR_ASSERT(str::read_to_string(raw, encoding, false) == "\0a"sv);
+    }
+
+    // -------------------------------------------------------------------------
+    // Natural order
+    // -------------------------------------------------------------------------
+
+    {
+      DMITIGR_ASSERT(str::natural_compare("v9", "v10") < 0);
+      DMITIGR_ASSERT(str::natural_compare("v10", "v9") > 0);
+      DMITIGR_ASSERT(str::natural_compare("file01", "file1") == 0);
+      DMITIGR_ASSERT(str::natural_compare("a", "a0") < 0);
+      DMITIGR_ASSERT(str::natural_compare("File2", "file10") < 0);
+      DMITIGR_ASSERT(str::natural_compare("file2", "File10") > 0);
+      DMITIGR_ASSERT(str::natural_compare("file2", "File10", true) < 0);
+
+      std::vector<std::string> v{"x10", "x9", "X1", "x100", "x09a"};
+      std::sort(v.begin(), v.end(), str::Natural_less{true});
+      DMITIGR_ASSERT((v == std::vector<std::string>{"X1", "x9", "x09a", "x10", "x100"}));
+
+      const auto k9 = str::natural_sort_key("v9");
+      const auto k10 = str::natural_sort_key("v10");
+      DMITIGR_ASSERT(k9 < k10);
+      DMITIGR_ASSERT(str::natural_sort_key("A01", true) == str::natural_sort_key("a1"));
+    }
+
+    // -------------------------------------------------------------------------
+    // String table and sorting
+    // -------------------------------------------------------------------------
+
+    {
+      std::vector<std::string> v;
+      for (int i = 0; i < 1000; ++i)
+        v.push_back("key" + std::to_string(i * 7919 % 1000) + (i % 3 ? "" : "\xFF"));
+      v.push_back("");
+      v.push_back("key");
+      auto expected = v;
+      std::sort(expected.begin(), expected.end());
+
+      str::String_table table{v};
+      DMITIGR_ASSERT(table.size() == v.size());
+      DMITIGR_ASSERT(table[0] == v[0]);
+      str::sort_strings(table);
+      DMITIGR_ASSERT(std::equal(table.begin(), table.end(), expected.begin(), expected.end()));
+      table.compact();
+      DMITIGR_ASSERT(table.data().substr(0, 6) == "keykey");
+
+      std::vector<std::string_view> views{v.begin(), v.end()};
+      str::sort_strings_parallel(views, 2);
+      DMITIGR_ASSERT(std::equal(views.begin(), views.end(), expected.begin(), expected.end()));
+
+      str::sort_strings(v);
+      DMITIGR_ASSERT(v == expected);
+    }
+
+    // -------------------------------------------------------------------------
+    // Common prefixes and suffixes
+    // -------------------------------------------------------------------------
+
+    {
+      const std::string a(100, 'x');
+      const auto b = a.substr(0, 70) + "y" + a.substr(71);
+      DMITIGR_ASSERT(str::common_prefix_length(a, b) == 70);
+      DMITIGR_ASSERT(str::common_suffix_length(a, b) == 29);
+      DMITIGR_ASSERT(str::common_prefix_length(a, a.substr(0, 33)) == 33);
+      DMITIGR_ASSERT(str::common_suffix_length(a + "z", b) == 0);
+      DMITIGR_ASSERT(str::common_prefix_length("", a) == 0);
+
+      const std::vector<std::string> paths{"/usr/lib/a", "/usr/lib/b", "/usr/local"};
+      DMITIGR_ASSERT(str::longest_common_prefix(paths) == "/usr/l");
+      DMITIGR_ASSERT(str::longest_common_prefix(std::vector<std::string>{}).empty());
+      DMITIGR_ASSERT(str::longest_common_prefix(std::vector<std::string_view>{"ab"}) == "ab");
+    }
+
+    // -------------------------------------------------------------------------
+    // Front coded dictionary
+    // -------------------------------------------------------------------------
+
+    {
+      std::vector<std::string> keys;
+      for (int i = 0; i < 100; ++i)
+        keys.push_back("/usr/share/" + std::to_string(1000 + i));
+      keys.push_back("/var");
+      const str::Front_coded_dictionary dict{keys, 8};
+      DMITIGR_ASSERT(dict.size() == keys.size());
+      DMITIGR_ASSERT(dict.image().size() < 101*16);
+      DMITIGR_ASSERT(dict.at(42) == keys[42]);
+      DMITIGR_ASSERT(dict.contains("/usr/share/1099"));
+      DMITIGR_ASSERT(!dict.contains("/usr/share/1100"));
+      DMITIGR_ASSERT(*dict.lower_bound("/usr/share/1050a") == "/usr/share/1051");
+      DMITIGR_ASSERT(dict.lower_bound("/x") == dict.end());
+
+      const auto path = std::filesystem::temp_directory_path() / "dmitigr_str_fc";
+      dict.save(path);
+      const str::Front_coded_dictionary mapped{str::Mapped_file{path}};
+      const auto [b, e] = mapped.prefix_range("/usr/share/103");
+      DMITIGR_ASSERT(std::distance(b, e) == 10);
+      DMITIGR_ASSERT(*b == "/usr/share/1030");
+      DMITIGR_ASSERT(std::equal(mapped.begin(), mapped.end(), keys.begin(), keys.end()));
+      std::filesystem::remove(path);
+
+      const char varint[]{"\x81\x01"};
+      const char* p = varint;
+      DMITIGR_ASSERT(!str::read_varint(p, varint + 1) && p == varint);
+      DMITIGR_ASSERT(str::read_varint(p, varint + 2) == 129 && p == varint + 2);
+    }
+
+    // -------------------------------------------------------------------------
+    // Removing duplicates
+    // -------------------------------------------------------------------------
+
+    {
+      std::vector<std::string> v;
+      for (int i = 0; i < 20000; ++i)
+        v.push_back(std::to_string(i * 7 % 1000));
+      str::String_table table{v};
+      auto w = v;
+
+      DMITIGR_ASSERT(str::remove_duplicates(v) == 19000);
+      DMITIGR_ASSERT(v.size() == 1000 && v[0] == "0" && v[1] == "7");
+      DMITIGR_ASSERT(str::remove_duplicates_parallel(w, 4) == 19000);
+      DMITIGR_ASSERT(w == v);
+      DMITIGR_ASSERT(str::remove_duplicates_parallel(table, 2) == 19000);
+      DMITIGR_ASSERT(std::equal(table.begin(), table.end(), v.begin(), v.end()));
+      DMITIGR_ASSERT(!str::remove_duplicates(v));
+    }
+
+    // -------------------------------------------------------------------------
+    // External sort
+    // -------------------------------------------------------------------------
+
+    {
+      const auto dir = std::filesystem::temp_directory_path();
+      const auto input = dir / "dmitigr_str_es_input";
+      const auto output = dir / "dmitigr_str_es_output";
+      std::vector<std::string> lines;
+      {
+        std::ofstream file{input, std::ios_base::binary};
+        for (int i = 0; i < 5000; ++i) {
+          lines.push_back(std::to_string(i * 7919 % 3000));
+          file << lines.back() << '\n';
+        }
+      }
+
+      str::External_sort_options options;
+      options.memory_limit = 8192; // many runs
+      options.is_unique = true;
+      DMITIGR_ASSERT(str::external_sort(input, output, options) == 3000);
+      std::sort(lines.begin(), lines.end());
+      lines.erase(std::unique(lines.begin(), lines.end()), lines.end());
+      DMITIGR_ASSERT(str::read_to_strings(output) == lines);
+
+      options.is_unique = false;
+      DMITIGR_ASSERT(str::external_sort(input, output, options, str::Natural_less{}) == 5000);
+      const auto sorted = str::read_to_strings(output);
+      DMITIGR_ASSERT(sorted.front() == "0" && sorted[2] == "1" && sorted.back() == "2999");
+
+      // The first of the case-insensitively equivalent lines is kept even if
+      // the runs are merged in several passes.
+      const auto icase_less = [](const std::string_view lhs, const std::string_view rhs)
+      {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(),
+          rhs.begin(), rhs.end(), [](const char a, const char b)
+          {
+            return std::tolower(static_cast<unsigned char>(a))
+              < std::tolower(static_cast<unsigned char>(b));
+          });
+      };
+      std::vector<std::string> expected(500);
+      {
+        std::ofstream file{input, std::ios_base::binary};
+        for (int i = 0; i < 60000; ++i) {
+          const auto key = i * 7919 % 500;
+          std::string line{"key" + std::to_string(key)};
+          for (std::size_t j{}; j < line.size(); ++j) {
+            if (i >> j & 1)
+              line[j] = static_cast<char>(std::toupper(static_cast<unsigned char>(line[j])));
+          }
+          if (expected[key].empty())
+            expected[key] = line;
+          file << line << '\n';
+        }
+      }
+      options.is_unique = true;
+      DMITIGR_ASSERT(str::external_sort(input, output, options, icase_less) == 500);
+      std::sort(expected.begin(), expected.end(), icase_less);
+      DMITIGR_ASSERT(str::read_to_strings(output) == expected);
+      std::filesystem::remove(input);
+      std::filesystem::remove(output);
+    }
+
+    // -------------------------------------------------------------------------
+    // Diff
+    // -------------------------------------------------------------------------
+
+    {
+      const std::vector<std::string> a{"a", "b", "c", "d", "e", "f", "g", "h", "i"};
+      const std::vector<std::string> b{"a", "b", "x", "d", "e", "f", "g", "h", "i", "j"};
+      const auto changes = str::diff(a, b);
+      DMITIGR_ASSERT(changes.size() == 2);
+      DMITIGR_ASSERT(changes[0].old_offset == 2 && changes[0].old_count == 1);
+      DMITIGR_ASSERT(changes[0].new_offset == 2 && changes[0].new_count == 1);
+      DMITIGR_ASSERT(changes[1].old_offset == 9 && changes[1].old_count == 0);
+      DMITIGR_ASSERT(changes[1].new_offset == 9 && changes[1].new_count == 1);
+      DMITIGR_ASSERT(str::diff(a, a).empty());
+
+      std::string u;
+      str::unified_diff(u, a, b, 1);
+      DMITIGR_ASSERT(u == "@@ -2,3 +2,3 @@\n b\n-c\n+x\n d\n"
+        "@@ -9 +9,2 @@\n i\n+j\n");
+
+      std::size_t hunk_count{};
+      str::unified_diff(a, b, [&](std::string_view){++hunk_count;});
+      DMITIGR_ASSERT(hunk_count == 1);
+    }
+
+    // -------------------------------------------------------------------------
+    // Radix tree
+    // -------------------------------------------------------------------------
+
+    {
+      str::Radix_tree<int> tree;
+      DMITIGR_ASSERT(tree.insert("/api", 1));
+      DMITIGR_ASSERT(tree.insert("/api/users", 2));
+      DMITIGR_ASSERT(tree.insert("/apx", 3));
+      DMITIGR_ASSERT(tree.insert("", 0));
+      DMITIGR_ASSERT(!tree.insert("/api", 4));
+      for (int i = 0; i < 100; ++i)
+        DMITIGR_ASSERT(tree.insert("/c/" + std::to_string(i), 100 + i));
+      DMITIGR_ASSERT(tree.size() == 104);
+      DMITIGR_ASSERT(*tree.find("/api") == 1);
+      DMITIGR_ASSERT(*tree.find("/c/42") == 142);
+      DMITIGR_ASSERT(!tree.find("/ap"));
+
+      const auto m = tree.longest_prefix_match("/api/users/7");
+      DMITIGR_ASSERT(m && m.key == "/api/users" && *m.value == 2);
+      DMITIGR_ASSERT(tree.longest_prefix_match("/apxy").key == "/apx");
+      DMITIGR_ASSERT(tree.longest_prefix_match("/b").key.empty());
+
+      std::vector<std::string> keys;
+      tree.for_each_with_prefix("/c/9", [&keys](const std::string_view key, int)
+      {
+        keys.emplace_back(key);
+      });
+      DMITIGR_ASSERT((keys == std::vector<std::string>{"/c/9", "/c/90", "/c/91",
+        "/c/92", "/c/93", "/c/94", "/c/95", "/c/96", "/c/97", "/c/98", "/c/99"}));
+
+      std::vector<std::pair<std::string, int>> items;
+      tree.for_each([&items](const std::string_view key, const int value)
+      {
+        items.emplace_back(key, value);
+      });
+      DMITIGR_ASSERT(std::is_sorted(items.begin(), items.end()));
+      const str::Radix_tree<int> built{items};
+      DMITIGR_ASSERT(built.size() == tree.size());
+      DMITIGR_ASSERT(*built.find("/api/users") == 2);
+      DMITIGR_ASSERT(built.longest_prefix_match("/c/99x").key == "/c/99");
+    }
+
+    // -------------------------------------------------------------------------
+    // Trigram index
+    // -------------------------------------------------------------------------
+
+    {
+      std::vector<std::string> v;
+      for (int i = 0; i < 20000; ++i)
+        v.push_back("/home/user" + std::to_string(i) + "/file.txt");
+      v.push_back("ab");
+      const str::Trigram_index index{v};
+      const str::Trigram_index parallel_index{str::String_table{v}, 2};
+      DMITIGR_ASSERT(index.size() == v.size());
+      DMITIGR_ASSERT(index.postings_size() < 20000 * 30);
+
+      const auto found = index.find("user1234/");
+      DMITIGR_ASSERT((found == std::vector<std::size_t>{1234}));
+      DMITIGR_ASSERT(parallel_index.find("user1234/") == found);
+      DMITIGR_ASSERT(index.find("r19999/f").size() == 1);
+      DMITIGR_ASSERT(index.find("user20000").empty());
+      DMITIGR_ASSERT(index.find("file.txt").size() == 20000);
+      DMITIGR_ASSERT((index.find("b") == std::vector<std::size_t>{20000}));
+      DMITIGR_ASSERT(index.find("xyz").empty());
+    }
+
+    // -------------------------------------------------------------------------
+    // Suffix array and FM-index
+    // -------------------------------------------------------------------------
+
+    {
+      DMITIGR_ASSERT((str::suffix_array("banana") == std::vector<std::size_t>{5, 3, 1, 0, 4, 2}));
+      DMITIGR_ASSERT(str::suffix_array<std::uint32_t>("").empty());
+
+      std::string text;
+      for (int i = 0; i < 10000; ++i)
+        text.append("line ").append(std::to_string(i % 997)).append(" ok\n");
+      const str::Fm_index index{text, 16, 2};
+      DMITIGR_ASSERT(index.text_size() == text.size());
+      DMITIGR_ASSERT(index.count("line ") == 10000);
+      DMITIGR_ASSERT(index.count("line 996 ") == 10);
+      DMITIGR_ASSERT(index.count("line 997 ") == 0);
+      DMITIGR_ASSERT(index.count("") == 0);
+      const auto positions = index.locate(" 42 ok");
+      DMITIGR_ASSERT(positions.size() == 10);
+      DMITIGR_ASSERT(positions[0] == text.find(" 42 ok"));
+
+      const auto path = std::filesystem::temp_directory_path() / "dmitigr_str_fm";
+      index.save(path);
+      const str::Fm_index mapped{str::Mapped_file{path}};
+      DMITIGR_ASSERT(mapped.locate(" 42 ok") == positions);
+      DMITIGR_ASSERT(mapped.count("ok\nline 1") == index.count("ok\nline 1"));
+      std::filesystem::remove(path);
+    }
+
+    // -------------------------------------------------------------------------
+    // Glob
+    // -------------------------------------------------------------------------
+
+    {
+      const str::Glob glob{"*.[ch]pp"};
+      DMITIGR_ASSERT(glob.is_match("str.hpp"));
+      DMITIGR_ASSERT(glob.is_match(".cpp"));
+      DMITIGR_ASSERT(!glob.is_match("str.hxx"));
+      DMITIGR_ASSERT(!glob.is_match("pp"));
+      DMITIGR_ASSERT(glob.min_size() == 4);
+
+      DMITIGR_ASSERT(str::Glob{"a*b?c*[!0-9]"}.is_match("axxbycZ"));
+      DMITIGR_ASSERT(!str::Glob{"a*b?c*[!0-9]"}.is_match("axxbyc7"));
+      DMITIGR_ASSERT(str::Glob{"*error*timeout*"}.is_match("[x] error: read timeout"));
+      DMITIGR_ASSERT(!str::Glob{"*error*timeout*"}.is_match("timeout error"));
+      DMITIGR_ASSERT(str::Glob{"[]x]\\*[[:digit:]]"}.is_match("]*7"));
+      DMITIGR_ASSERT(str::Glob{"[a"}.is_match("[a"));
+      DMITIGR_ASSERT(str::Glob{}.is_match(""));
+      DMITIGR_ASSERT(str::Glob{"*"}.is_match(""));
+
+      const std::vector<std::string> names{"a.log", "b.txt", "c.log"};
+      DMITIGR_ASSERT((str::Glob{"*.log"}.match(names) == std::vector<std::size_t>{0, 2}));
+    }
+
+    // -------------------------------------------------------------------------
+    // Multi-pattern search
+    // -------------------------------------------------------------------------
+
+    {
+      const std::vector<std::string> patterns{"he", "she", "his", "hers"};
+      const str::Aho_corasick ac{patterns};
+      DMITIGR_ASSERT(ac.size() == 4);
+      const auto m = ac.find("ushers");
+      DMITIGR_ASSERT(m && m.position == 1 && m.pattern == 1);
+      DMITIGR_ASSERT(ac.find("ushers", 2).pattern == 0);
+      DMITIGR_ASSERT(!ac.find("ushers", 3));
+      DMITIGR_ASSERT(!ac.is_match("hallo"));
+      DMITIGR_ASSERT(ac.is_match("this"));
+
+      std::istringstream input{"ok\nERROR: disk\nok\n\nwarn: FATAL\nERROR"};
+      const std::vector<std::string> levels{"ERROR", "FATAL"};
+      const auto lines = str::read_to_strings_if<4>(input, str::Aho_corasick{levels});
+      DMITIGR_ASSERT((lines == std::vector<std::string>{"ERROR: disk",
+        "warn: FATAL", "ERROR"}));
+    }
+
+    // -------------------------------------------------------------------------
+    // Grep
+    // -------------------------------------------------------------------------
+
+    {
+      std::string text;
+      for (int i{}; i < 10000; ++i)
+        text.append("line ").append(std::to_string(i)).append(i % 1000 == 7 ? " ERROR\n" : "\n");
+      const std::vector<std::string> patterns{"ERROR"};
+      const str::Aho_corasick ac{patterns};
+      const auto matches = str::grep(text, ac, 4);
+      DMITIGR_ASSERT(matches.size() == 10);
+      DMITIGR_ASSERT(matches[0].number == 7 && matches[0].line == "line 7 ERROR");
+      DMITIGR_ASSERT(matches[9].number == 9007);
+      const auto same = str::grep(text, [](const std::string_view line)
+      {
+        return line.size() > 5 && line.back() == 'R';
+      }, 3);
+      DMITIGR_ASSERT(same.size() == 10 && same[9].line == "line 9007 ERROR");
+
+      const auto empty = str::grep("\nx\n\n", [](const std::string_view line)
+      {
+        return line.empty();
+      });
+      DMITIGR_ASSERT(empty.size() == 2 && empty[0].number == 0 && empty[1].number == 2);
+    }
+
+    // -------------------------------------------------------------------------
+    // Field selection
+    // -------------------------------------------------------------------------
+
+    {
+      const str::Field_selector selector{{3, 1, 3}, ",;"};
+      const auto fields = selector.select("a,b;c,d,e");
+      DMITIGR_ASSERT((fields == std::vector<std::string_view>{"d", "b", "d"}));
+      std::string_view out[3];
+      DMITIGR_ASSERT(!selector.select("a,b", out));
+      DMITIGR_ASSERT(out[0].empty() && out[1] == "b" && out[2].empty());
+
+      const auto columns = str::Field_selector{{2, 0}}.select_columns(
+        "1\tx\tfoo\n2\ty\n3\tz\tbar\tbaz\n");
+      DMITIGR_ASSERT(columns.size() == 2 && columns[0].size() == 3);
+      DMITIGR_ASSERT(columns[0][0] == "foo" && columns[0][1].empty() && columns[0][2] == "bar");
+      DMITIGR_ASSERT(columns[1][2] == "3");
+    }
+
+    // -------------------------------------------------------------------------
+    // Fixed-width records
+    // -------------------------------------------------------------------------
+
+    {
+      DMITIGR_ASSERT(str::to_integer("000000000000012345") == 12345);
+      DMITIGR_ASSERT(str::to_integer("-9223372036854775808") == INT64_MIN);
+      DMITIGR_ASSERT(!str::to_integer("9223372036854775808"));
+      DMITIGR_ASSERT(!str::to_integer("12a") && !str::to_integer("-"));
+
+      const str::Record_layout layout{{
+          {0, 6, str::Trim::rhs},
+          {6, 8},
+          {14, 3, std::nullopt}}, 18};
+      const std::string_view data{"Alice 00000042abc\nBob   -0000007 z \nEve        n/axyz"};
+      DMITIGR_ASSERT(layout.record_count(data) == 3);
+      const auto rec = layout.record(data, 1);
+      DMITIGR_ASSERT(layout.value(rec, 0) == "Bob");
+      DMITIGR_ASSERT(layout.value(rec, 2) == " z ");
+      DMITIGR_ASSERT(layout.integer(rec, 1) == -7);
+      DMITIGR_ASSERT((layout.values(data, 0, 2) == std::vector<std::string_view>{"Alice", "Bob", "Eve"}));
+      const auto numbers = layout.integers(data, 1);
+      DMITIGR_ASSERT(numbers[0] == 42 && numbers[1] == -7 && !numbers[2]);
+      DMITIGR_ASSERT(str::Record_layout({{0, 0}}, 4).record_count("abcdefgh") == 2);
+    }
+
+    // -------------------------------------------------------------------------
+    // JSON strings
+    // -------------------------------------------------------------------------
+
+    {
+      const std::string_view raw{"say \"hi\"\n\tC:\\dir \x01 \xc3\xa9"};
+      const auto escaped = str::to_json_escaped(raw);
+      DMITIGR_ASSERT(escaped == "say \\\"hi\\\"\\n\\tC:\\\\dir \\u0001 \xc3\xa9");
+      DMITIGR_ASSERT(str::to_json_unescaped(escaped) == raw);
+      DMITIGR_ASSERT(str::to_json_unescaped("\\u00e9\\ud83d\\ude00\\/") == "\xc3\xa9\xf0\x9f\x98\x80/");
+      DMITIGR_ASSERT(str::to_json_unescaped("\\udc00") == "\xef\xbf\xbd");
+
+      char buf[str::json_escaped_max_size(2)];
+      DMITIGR_ASSERT(str::json_escape("a\x1f", buf) == 7 && !std::memcmp(buf, "a\\u001f", 7));
+      DMITIGR_ASSERT(str::json_unescape("", buf) == 0);
+    }
+
+    // -------------------------------------------------------------------------
+    // JSON structural index
+    // -------------------------------------------------------------------------
+
+    {
+      const std::string_view ndjson{
+        "{\"id\": 1, \"tags\": [\"a\", {\"id\": 2}], \"msg\": \"x\\\"}\"}\n"
+        "{\"msg\":\"y\",\"level\":\"error\" , \"id\":null}\n"};
+      str::Json_index index;
+      std::vector<std::string_view> ids;
+      for (const auto& line : str::to_vector<std::string_view>(ndjson, "\n")) {
+        if (line.empty())
+          continue;
+        index.assign(line);
+        ids.push_back(index.find("id").value_or(""));
+        if (ids.size() == 1) {
+          DMITIGR_ASSERT(index.find("tags") == "[\"a\", {\"id\": 2}]");
+          DMITIGR_ASSERT(index.find("msg") == "\"x\\\"}\"");
+          DMITIGR_ASSERT(!index.find("level"));
+        } else
+          DMITIGR_ASSERT(index.find("level") == "\"error\"");
+      }
+      DMITIGR_ASSERT((ids == std::vector<std::string_view>{"1", "null"}));
+
+      const str::Json_index array{"[1, \"{\"]"};
+      DMITIGR_ASSERT((array.positions() == std::vector<std::uint32_t>{0, 1, 2, 4, 7}));
+      DMITIGR_ASSERT(!array.find("1"));
+    }
+
+    // -------------------------------------------------------------------------
+    // PostgreSQL COPY format
+    // -------------------------------------------------------------------------
+
+    {
+      const std::string_view raw{"a\tb\\c\nd"};
+      char buf[str::copy_csv_escaped_max_size(16)];
+      const auto size = str::copy_text_escape(raw, buf);
+      DMITIGR_ASSERT(std::string_view(buf, size) == "a\\tb\\\\c\\nd");
+      char out[sizeof(buf)];
+      DMITIGR_ASSERT(std::string_view(out, str::copy_text_unescape({buf, size}, out)) == raw);
+      DMITIGR_ASSERT(std::string_view(out, str::copy_text_unescape("\\101\\x42\\q", out)) == "ABq");
+
+      DMITIGR_ASSERT(std::string_view(buf, str::copy_csv_escape("plain", buf)) == "plain");
+      DMITIGR_ASSERT(std::string_view(buf, str::copy_csv_escape("", buf)) == "\"\"");
+      const auto csv_size = str::copy_csv_escape("say \"hi\", bye", buf);
+      DMITIGR_ASSERT(std::string_view(buf, csv_size) == "\"say \"\"hi\"\", bye\"");
+      DMITIGR_ASSERT(std::string_view(out, str::copy_csv_unescape({buf, csv_size}, out)) == "say \"hi\", bye");
+
+      str::Copy_row_builder rows;
+      rows.append("1").append_null().append("x\ty").end_row();
+      rows.append("2").append("").append("\\").end_row();
+      DMITIGR_ASSERT(rows.data() == "1\t\\N\tx\\ty\n2\t\t\\\\\n");
+      rows.clear();
+      DMITIGR_ASSERT(rows.data().empty());
+    }
+
+    // -------------------------------------------------------------------------
+    // SQL quoting
+    // -------------------------------------------------------------------------
+
+    {
+      DMITIGR_ASSERT(!str::is_sql_identifier_escaping_required("my table"));
+      DMITIGR_ASSERT(str::is_sql_identifier_escaping_required("my \"table\""));
+      DMITIGR_ASSERT(!str::is_sql_literal_escaping_required("O\"Reilly"));
+      DMITIGR_ASSERT(str::is_sql_literal_escaping_required("O'Reilly"));
+
+      DMITIGR_ASSERT(str::to_quoted_sql_identifier("a\"b") == "\"a\"\"b\"");
+      DMITIGR_ASSERT(str::to_quoted_sql_literal("O'Reilly") == "'O''Reilly'");
+      DMITIGR_ASSERT(str::to_quoted_sql_literal("C:\\'x") == "E'C:\\\\''x'");
+      char buf[str::sql_quoted_max_size(3)];
+      DMITIGR_ASSERT(std::string_view(buf, str::quote_sql_literal("abc", buf)) == "'abc'");
+
+      DMITIGR_ASSERT(str::to_unquoted_sql_identifier("\"a\"\"b\"") == "a\"b");
+      DMITIGR_ASSERT(str::to_unquoted_sql_literal("'it''s'") == "it's");
+      DMITIGR_ASSERT(str::to_unquoted_sql_literal("'a\\n'") == "a\\n");
+      DMITIGR_ASSERT(str::to_unquoted_sql_literal("E'a\\n\\'\\x41\\u00e9'") == "a\n'A\xc3\xa9");
+    }
+
+    // -------------------------------------------------------------------------
+    // URL percent-encoding
+    // -------------------------------------------------------------------------
+
+    {
+      DMITIGR_ASSERT(str::to_percent_encoded("a b&c/d~\xc3\xa9") == "a%20b%26c%2Fd~%C3%A9");
+      DMITIGR_ASSERT(str::to_percent_encoded("a b+c", str::url_component_encode_set, true) == "a+b%2Bc");
+      DMITIGR_ASSERT(str::to_percent_encoded("/a b/c:d", str::url_path_encode_set) == "/a%20b/c:d");
+      DMITIGR_ASSERT(str::to_percent_encoded("abc", str::Byte_set{"b"}) == "a%62c");
+
+      DMITIGR_ASSERT(str::to_percent_decoded("a%20b%2fc") == "a b/c");
+      DMITIGR_ASSERT(str::to_percent_decoded("a+b%2B", true) == "a b+");
+      DMITIGR_ASSERT(str::to_percent_decoded("a+b") == "a+b");
+      char buf[16];
+      const auto decoding = str::percent_decode("ok%41%4x", buf);
+      DMITIGR_ASSERT(!decoding && decoding.error_position == 5 && decoding.size == 3);
+    }
+
     // -------------------------------------------------------------------------
     // Sparse
     // -------------------------------------------------------------------------
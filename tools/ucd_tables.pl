@@ -0,0 +1,375 @@
+#!/usr/bin/env perl
+#
+# Copyright 2023 Dmitry Igrishin
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Generates the Unicode tables of the library from the Unicode Character
+# Database shipped with Perl.
+#
+# Usage: perl tools/ucd_tables.pl <output directory>
+
+use strict;
+use warnings;
+use Unicode::UCD qw(prop_invmap);
+
+my $outdir = shift // '.';
+my $version = Unicode::UCD::UnicodeVersion();
+
+# ------------------------------------------------------------------------------
+# Helpers
+# ------------------------------------------------------------------------------
+
+# Returns the hash of code points with the mapping of property $prop which is
+# given in "a" (adjusted) format.
+sub expand_adjusted {
+  my ($prop) = @_;
+  my ($list, $map, $format) = prop_invmap($prop);
+  die "unexpected format $format of $prop" unless $format eq 'a';
+  my %result;
+  for my $i (0..$#$list) {
+    my $b = $list->[$i];
+    my $e = $i < $#$list ? $list->[$i + 1] - 1 : 0x10FFFF;
+    my $v = $map->[$i];
+    next if !ref $v && $v eq '0';
+    die "unexpected multi-character mapping of $prop" if ref $v;
+    $result{$_} = $v + ($_ - $b) for $b..$e;
+  }
+  return \%result;
+}
+
+# Returns the reference to the array of values of property $prop which is
+# given in "s" (string) format indexed by code points.
+sub expand_string {
+  my ($prop) = @_;
+  my ($list, $map, $format) = prop_invmap($prop);
+  die "unexpected format $format of $prop" unless $format eq 's';
+  my @result;
+  for my $i (0..$#$list) {
+    my $b = $list->[$i];
+    my $e = $i < $#$list ? $list->[$i + 1] - 1 : 0x10FFFF;
+    $result[$_] = $map->[$i] for $b..$e;
+  }
+  return \@result;
+}
+
+# Returns the list of lines with the comma-separated $values.
+sub format_values {
+  my ($per_line, @values) = @_;
+  my @lines;
+  while (my @chunk = splice @values, 0, $per_line) {
+    push @lines, '  ' . join(',', @chunk) . ',';
+  }
+  return join "\n", @lines;
+}
+
+# Splits @values (indexed by code point) into the blocks of size $block_size
+# and returns the pair of references to the stage 1 and stage 2 arrays.
+sub two_stage {
+  my ($block_size, @values) = @_;
+  my (@stage1, @stage2, %blocks);
+  for (my $b = 0; $b < @values; $b += $block_size) {
+    my @block = map { $values[$_] // 0 } $b..$b + $block_size - 1;
+    my $key = join ',', @block;
+    unless (exists $blocks{$key}) {
+      $blocks{$key} = @stage2 / $block_size;
+      push @stage2, @block;
+    }
+    push @stage1, $blocks{$key};
+  }
+  return (\@stage1, \@stage2);
+}
+
+sub type_for {
+  my ($max) = @_;
+  return $max < 256 ? 'std::uint8_t' : $max < 65536 ? 'std::uint16_t'
+    : 'std::uint32_t';
+}
+
+sub max_of {
+  my $max = 0;
+  $max = $_ > $max ? $_ : $max for @_;
+  return $max;
+}
+
+my $license = <<'END';
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is generated by tools/ucd_tables.pl from the Unicode Character
+// Database version VERSION. Do not edit!
+END
+$license =~ s/VERSION/$version/;
+
+# ------------------------------------------------------------------------------
+# Case mapping
+# ------------------------------------------------------------------------------
+
+{
+  my $lower = expand_adjusted('Simple_Lowercase_Mapping');
+  my $upper = expand_adjusted('Simple_Uppercase_Mapping');
+  my $fold = expand_adjusted('Simple_Case_Folding');
+
+  # Each code point is mapped to the record of deltas (lower, upper, fold).
+  my $block_size = 64;
+  my (@records, %record_indexes, @values);
+  push @records, '0,0,0';
+  $record_indexes{'0,0,0'} = 0;
+  my $limit = 0;
+  for my $cp (0..0x10FFFF) {
+    my @deltas = map { exists $_->{$cp} ? $_->{$cp} - $cp : 0 }
+      ($lower, $upper, $fold);
+    my $key = join ',', @deltas;
+    next if $key eq '0,0,0';
+    unless (exists $record_indexes{$key}) {
+      $record_indexes{$key} = @records;
+      push @records, $key;
+    }
+    $values[$cp] = $record_indexes{$key};
+    $limit = $cp + 1;
+  }
+  $limit = ($limit + $block_size - 1) & ~($block_size - 1);
+  $#values = $limit - 1;
+  my ($stage1, $stage2) = two_stage($block_size, @values);
+  my $stage1_type = type_for(max_of(@$stage1));
+  my $stage2_type = type_for(max_of(@$stage2));
+  my $record_count = @records;
+  my $stage1_size = @$stage1;
+  my $stage2_size = @$stage2;
+  my $records = join "\n", map { "  {$_}," } @records;
+  my $stage1_values = format_values(16, @$stage1);
+  my $stage2_values = format_values(16, @$stage2);
+
+  open my $out, '>', "$outdir/ucd_case.hpp" or die $!;
+  print $out <<"END";
+$license
+#ifndef DMITIGR_STR_UCD_CASE_HPP
+#define DMITIGR_STR_UCD_CASE_HPP
+
+#include <cstdint>
+
+namespace dmitigr::str::ucd {
+
+/// The deltas of the simple case mappings of a code point.
+struct Case_record final {
+  std::int32_t lower;
+  std::int32_t upper;
+  std::int32_t fold;
+};
+
+/// The code points starting from this one have no case mappings.
+constexpr char32_t case_limit{$limit};
+
+/// The binary logarithm of the size of the blocks of stage 2.
+constexpr unsigned case_block_shift{6};
+
+constexpr Case_record case_records[$record_count] = {
+$records
+};
+
+constexpr $stage1_type case_stage1[$stage1_size] = {
+$stage1_values
+};
+
+constexpr $stage2_type case_stage2[$stage2_size] = {
+$stage2_values
+};
+
+} // namespace dmitigr::str::ucd
+
+#endif  // DMITIGR_STR_UCD_CASE_HPP
+END
+  close $out;
+}
+
+# ------------------------------------------------------------------------------
+# Normalization
+# ------------------------------------------------------------------------------
+
+{
+  my $ccc = expand_string('Canonical_Combining_Class');
+  my $nfc_qc = expand_string('NFC_Quick_Check');
+  my $nfd_qc = expand_string('NFD_Quick_Check');
+  my $dt = expand_string('Decomposition_Type');
+  my $exclusion = expand_string('Full_Composition_Exclusion');
+  my ($dm_list, $dm_map) = prop_invmap('Decomposition_Mapping');
+
+  # The direct (single level) canonical decompositions.
+  my %direct;
+  for my $i (0..$#$dm_list) {
+    my $b = $dm_list->[$i];
+    my $e = $i < $#$dm_list ? $dm_list->[$i + 1] - 1 : 0x10FFFF;
+    my $v = $dm_map->[$i];
+    for my $cp ($b..$e) {
+      next unless $dt->[$cp] eq 'Canonical';
+      next if $cp >= 0xAC00 && $cp <= 0xD7A3; # Hangul syllables
+      $direct{$cp} = ref $v ? [@$v] : [$v + ($cp - $b)];
+    }
+  }
+
+  # The full canonical decompositions.
+  my $full;
+  $full = sub {
+    my ($cp) = @_;
+    return ($cp) unless exists $direct{$cp};
+    return map { $full->($_) } @{$direct{$cp}};
+  };
+
+  # Each code point is mapped to the record (ccc, flags).
+  my $block_size = 64;
+  my (@records, %record_indexes, @values);
+  push @records, '0,0';
+  $record_indexes{'0,0'} = 0;
+  my $limit = 0;
+  for my $cp (0..0x10FFFF) {
+    my $flags = ($nfc_qc->[$cp] eq 'N' ? 1 : $nfc_qc->[$cp] eq 'M' ? 2 : 0)
+      | ($nfd_qc->[$cp] eq 'N' ? 4 : 0);
+    my $key = "$ccc->[$cp],$flags";
+    next if $key eq '0,0';
+    unless (exists $record_indexes{$key}) {
+      $record_indexes{$key} = @records;
+      push @records, $key;
+    }
+    $values[$cp] = $record_indexes{$key};
+    $limit = $cp + 1;
+  }
+  $limit = ($limit + $block_size - 1) & ~($block_size - 1);
+  $#values = $limit - 1;
+  my ($stage1, $stage2) = two_stage($block_size, @values);
+  my $stage1_type = type_for(max_of(@$stage1));
+  my $stage2_type = type_for(max_of(@$stage2));
+  my $record_count = @records;
+  my $stage1_size = @$stage1;
+  my $stage2_size = @$stage2;
+  my $records = join "\n", map { "  {$_}," } @records;
+  my $stage1_values = format_values(16, @$stage1);
+  my $stage2_values = format_values(16, @$stage2);
+
+  # Decompositions.
+  my (@decomposition_keys, @decomposition_offsets, @decomposition_data);
+  for my $cp (sort { $a <=> $b } keys %direct) {
+    push @decomposition_keys, sprintf('0x%04X', $cp);
+    push @decomposition_offsets, scalar @decomposition_data;
+    push @decomposition_data, map { sprintf('0x%04X', $_) } $full->($cp);
+  }
+  push @decomposition_offsets, scalar @decomposition_data;
+  my $decomposition_count = @decomposition_keys;
+  my $decomposition_data_size = @decomposition_data;
+  my $decomposition_keys = format_values(8, @decomposition_keys);
+  my $decomposition_offsets = format_values(16, @decomposition_offsets);
+  my $decomposition_data = format_values(8, @decomposition_data);
+
+  # Primary composites.
+  my @compositions;
+  for my $cp (keys %direct) {
+    next if $exclusion->[$cp] eq 'Y';
+    my @pair = @{$direct{$cp}};
+    die sprintf('unexpected decomposition of U+%04X', $cp) unless @pair == 2;
+    push @compositions, [$pair[0] * 0x110000 + $pair[1], $cp];
+  }
+  @compositions = sort { $a->[0] <=> $b->[0] } @compositions;
+  my $composition_count = @compositions;
+  my $composition_keys = format_values(4,
+    map { sprintf('0x%012X', $_->[0]) } @compositions);
+  my $composition_values = format_values(8,
+    map { sprintf('0x%04X', $_->[1]) } @compositions);
+
+  open my $out, '>', "$outdir/ucd_normalization.hpp" or die $!;
+  print $out <<"END";
+$license
+#ifndef DMITIGR_STR_UCD_NORMALIZATION_HPP
+#define DMITIGR_STR_UCD_NORMALIZATION_HPP
+
+#include <cstdint>
+
+namespace dmitigr::str::ucd {
+
+/// The normalization properties of a code point.
+struct Normalization_record final {
+  /// The canonical combining class.
+  std::uint8_t ccc;
+  /// The bitmask of `nfc_no`, `nfc_maybe` and `nfd_no`.
+  std::uint8_t flags;
+};
+
+constexpr std::uint8_t nfc_no{1};
+constexpr std::uint8_t nfc_maybe{2};
+constexpr std::uint8_t nfd_no{4};
+
+/// The code points starting from this one have the default properties.
+constexpr char32_t normalization_limit{$limit};
+
+/// The binary logarithm of the size of the blocks of stage 2.
+constexpr unsigned normalization_block_shift{6};
+
+constexpr Normalization_record normalization_records[$record_count] = {
+$records
+};
+
+constexpr $stage1_type normalization_stage1[$stage1_size] = {
+$stage1_values
+};
+
+constexpr $stage2_type normalization_stage2[$stage2_size] = {
+$stage2_values
+};
+
+/**
+ * The sorted code points which have canonical decompositions (except the
+ * Hangul syllables).
+ */
+constexpr char32_t decomposition_keys[$decomposition_count] = {
+$decomposition_keys
+};
+
+/// The offsets of full decompositions of `decomposition_keys` in `decompositions`.
+constexpr std::uint16_t decomposition_offsets[$decomposition_count + 1] = {
+$decomposition_offsets
+};
+
+constexpr char32_t decompositions[$decomposition_data_size] = {
+$decomposition_data
+};
+
+/**
+ * The sorted keys `(first * 0x110000 + second)` of the pairs of code points
+ * which canonically compose to primary composites (except the Hangul syllables).
+ */
+constexpr std::uint64_t composition_keys[$composition_count] = {
+$composition_keys
+};
+
+/// The primary composites of `composition_keys`.
+constexpr char32_t compositions[$composition_count] = {
+$composition_values
+};
+
+} // namespace dmitigr::str::ucd
+
+#endif  // DMITIGR_STR_UCD_NORMALIZATION_HPP
+END
+  close $out;
+}
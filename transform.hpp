@@ -20,15 +20,19 @@
 #include "../base/assert.hpp"
 #include "basics.hpp"
 #include "predicate.hpp"
+#include "simd.hpp"
+#include "utf8_case.hpp"
 
 #include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <cctype>
+#include <cwctype>
 #include <functional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 
 namespace dmitigr::str {
@@ -125,48 +129,146 @@ inline void eliminate_duplicates(std::string& str)
   str.resize(new_size);
 }
 
+namespace detail {
+
+/// The value is `true` if the vectorized kernels can be applied to `CharT`.
+template<typename CharT>
+constexpr bool is_wide_unit_v = (sizeof(CharT) == 2 || sizeof(CharT) == 4)
+  && (std::is_same_v<CharT, wchar_t> || is_unicode_unit_v<CharT>);
+
 /**
- * @brief Trims `str`.
+ * @returns The pointer to the first character of `[b, e)` for which
+ * `predicate` returns `false`.
+ */
+template<typename CharT, typename Predicate>
+const CharT* find_if_not(const CharT* b, const CharT* const e,
+  const Predicate& predicate)
+{
+  if constexpr (std::is_same_v<Predicate, Is_not_visible> && is_wide_unit_v<CharT>) {
+    // All of the characters in range [0, 0x20] are not visible.
+    while (true) {
+      b = find_greater(b, e, CharT{0x20});
+      if (b == e || !predicate(*b))
+        return b;
+      ++b;
+    }
+  } else
+    return std::find_if_not(b, e, predicate);
+}
+
+/**
+ * @returns The pointer past the last character of `[b, e)` for which
+ * `predicate` returns `false`, or `b` if there is no such a character.
+ */
+template<typename CharT, typename Predicate>
+const CharT* rfind_if_not(const CharT* const b, const CharT* e,
+  const Predicate& predicate)
+{
+  if constexpr (std::is_same_v<Predicate, Is_not_visible> && is_wide_unit_v<CharT>) {
+    while (true) {
+      e = rfind_greater(b, e, CharT{0x20});
+      if (e == b || !predicate(*(e - 1)))
+        return e;
+      --e;
+    }
+  } else {
+    for (; e != b && predicate(*(e - 1)); --e);
+    return e;
+  }
+}
+
+} // namespace detail
+
+/**
+ * @returns The view of `str` without the characters to trim.
  *
  * @param str The string to operate on.
  * @param tr Trimming mode.
- * @param predicate The callable with signature `bool(int)`, which is applied
+ * @param predicate The callable with signature `bool(CharT)`, which is applied
  * to each character of `str` and returns `true` to indicate the character to
  * trim.
  */
-template<typename Predicate>
-void trim(std::string& str, const Trim tr, const Predicate& predicate)
+template<typename CharT, class Traits, typename Predicate>
+std::basic_string_view<CharT, Traits>
+trimmed(const std::basic_string_view<CharT, Traits> str,
+  const Trim tr, const Predicate& predicate) noexcept
 {
   if (str.empty())
-    return;
+    return str;
 
-  const auto b = begin(str);
-  const auto e = end(str);
+  const auto b = str.data();
+  const auto e = b + str.size();
   const auto tb = static_cast<bool>(tr & Trim::lhs) ?
-    find_if_not(b, e, predicate) : b;
+    detail::find_if_not(b, e, predicate) : b;
   if (tb == e) {
-    // The string consists of characters to trim, so just clear it out.
-    str.clear();
-    return;
+    // The string consists of characters to trim, so just return empty view.
+    return str.substr(0, 0);
   }
   const auto te = static_cast<bool>(tr & Trim::rhs) ?
-    find_if_not(rbegin(str), rend(str), predicate).base() : e;
+    detail::rfind_if_not(tb, e, predicate) : e;
+  return str.substr(static_cast<std::size_t>(tb - b),
+    static_cast<std::size_t>(te - tb));
+}
 
-  const std::string::size_type new_size = te - tb;
-  if (new_size != str.size()) {
-    if (tb != b)
-      move(tb, te, b);
-    str.resize(new_size);
+/// @overload
+template<typename CharT, class Traits>
+std::basic_string_view<CharT, Traits>
+trimmed(const std::basic_string_view<CharT, Traits> str,
+  const Trim tr = Trim::all) noexcept
+{
+  return trimmed(str, tr, Is_not_visible{});
+}
+
+/**
+ * @brief Trims `str`.
+ *
+ * @param str The string to operate on.
+ * @param tr Trimming mode.
+ * @param predicate The callable with signature `bool(CharT)`, which is applied
+ * to each character of `str` and returns `true` to indicate the character to
+ * trim.
+ */
+template<typename CharT, class Traits, class Allocator, typename Predicate>
+void trim(std::basic_string<CharT, Traits, Allocator>& str, const Trim tr,
+  const Predicate& predicate)
+{
+  const auto view = trimmed(std::basic_string_view<CharT, Traits>{str}, tr,
+    predicate);
+  if (view.size() != str.size()) {
+    if (view.data() != str.data())
+      Traits::move(str.data(), view.data(), view.size());
+    str.resize(view.size());
   }
 }
 
 /// @overload
-inline void trim(std::string& str, const Trim tr = Trim::all)
+template<typename CharT, class Traits, class Allocator>
+void trim(std::basic_string<CharT, Traits, Allocator>& str,
+  const Trim tr = Trim::all)
 {
-  trim(str, tr, is_not_visible);
+  trim(str, tr, Is_not_visible{});
 }
 
 /// @returns The result of call `trim(str, tr, predicate)`.
+template<typename CharT, class Traits, class Allocator, typename Predicate>
+std::basic_string<CharT, Traits, Allocator>
+trimmed(std::basic_string<CharT, Traits, Allocator> str, const Trim tr,
+  const Predicate& predicate)
+{
+  trim(str, tr, predicate);
+  return str;
+}
+
+/// @overload
+template<typename CharT, class Traits, class Allocator>
+std::basic_string<CharT, Traits, Allocator>
+trimmed(std::basic_string<CharT, Traits, Allocator> str, const Trim tr = Trim::all)
+{
+  trim(str, tr, Is_not_visible{});
+  return str;
+}
+
+/// @overload
 template<typename Predicate>
 std::string trimmed(std::string str, const Trim tr, const Predicate& predicate)
 {
@@ -177,41 +279,107 @@ std::string trimmed(std::string str, const Trim tr, const Predicate& predicate)
 /// @overload
 inline std::string trimmed(std::string str, const Trim tr = Trim::all)
 {
-  return trimmed(str, tr, is_not_visible);
+  trim(str, tr, Is_not_visible{});
+  return str;
 }
 
-/// @overload
-template<typename CharT, class Traits, typename Predicate>
-std::basic_string_view<CharT, Traits>
-trimmed(const std::basic_string_view<CharT, Traits> str,
-  const Trim tr, const Predicate& predicate) noexcept
+// -----------------------------------------------------------------------------
+// Case conversion
+// -----------------------------------------------------------------------------
+
+namespace detail {
+
+/**
+ * @returns `ch` converted to lowercase if `!Upper`, or to uppercase otherwise.
+ *
+ * @details The characters of type `char` are converted according to the
+ * current C locale, `wchar_t` - according to the current C locale as wide
+ * characters, `char8_t` - as ASCII, `char16_t` and `char32_t` - according
+ * to the simple Unicode case mappings.
+ */
+template<bool Upper, typename CharT>
+CharT to_case(const CharT ch) noexcept
 {
-  if (str.empty())
-    return str;
+  if constexpr (std::is_same_v<CharT, char>)
+    return static_cast<char>(Upper ? std::toupper(static_cast<unsigned char>(ch)) :
+      std::tolower(static_cast<unsigned char>(ch)));
+  else if constexpr (std::is_same_v<CharT, wchar_t>)
+    return static_cast<wchar_t>(Upper ? std::towupper(static_cast<std::wint_t>(ch)) :
+      std::towlower(static_cast<std::wint_t>(ch)));
+  else if constexpr (is_unicode_unit_v<CharT> && sizeof(CharT) == 1)
+    return static_cast<CharT>(ascii_to_case<Upper>(static_cast<char>(ch)));
+  else if constexpr (is_unicode_unit_v<CharT>) {
+    if (sizeof(CharT) == 2 && ch >= 0xD800 && ch <= 0xDFFF)
+      return ch;
+    return static_cast<CharT>(Upper ? utf8::to_uppercase(ch) :
+      utf8::to_lowercase(ch));
+  } else
+    return static_cast<CharT>(Upper ? std::toupper(ch) : std::tolower(ch));
+}
 
-  const auto b = cbegin(str);
-  const auto e = cend(str);
-  const auto tb = static_cast<bool>(tr & Trim::lhs) ?
-    std::find_if_not(b, e, predicate) : b;
-  if (tb == e) {
-    // The string consists of characters to trim, so just return empty view.
-    return str.substr(0, 0);
-  }
-  const auto te = static_cast<bool>(tr & Trim::rhs) ?
-    std::find_if_not(rbegin(str), rend(str), predicate).base() : e;
-  const auto new_size = te - tb;
-  return str.substr(tb - b, new_size);
+/// @returns `true` if `ch` is in the case specified by `Upper`.
+template<bool Upper, typename CharT>
+bool is_case(const CharT ch) noexcept
+{
+  if constexpr (std::is_same_v<CharT, char>)
+    return Upper ? std::isupper(static_cast<unsigned char>(ch)) :
+      std::islower(static_cast<unsigned char>(ch));
+  else if constexpr (std::is_same_v<CharT, wchar_t>)
+    return Upper ? std::iswupper(static_cast<std::wint_t>(ch)) :
+      std::iswlower(static_cast<std::wint_t>(ch));
+  else if constexpr (is_unicode_unit_v<CharT>)
+    // The character is in the case if it has the opposite case mapping.
+    return to_case<!Upper>(ch) != ch;
+  else
+    return Upper ? std::isupper(ch) : std::islower(ch);
 }
 
-/// @overload
-template<typename CharT, class Traits>
-std::basic_string_view<CharT, Traits>
-trimmed(const std::basic_string_view<CharT, Traits> str,
-  const Trim tr = Trim::all) noexcept
+/// Converts the case of `str` according to `Upper`.
+template<bool Upper, typename CharT, class Traits, class Allocator>
+void to_case(std::basic_string<CharT, Traits, Allocator>& str)
 {
-  return trimmed(str, tr, is_not_visible);
+  if constexpr (is_unicode_unit_v<CharT> && sizeof(CharT) == 1) {
+    // UTF-8 (the size of result may differ from the size of input).
+    const std::string_view view{reinterpret_cast<const char*>(str.data()),
+      str.size()};
+    const auto size = Upper ? utf8::uppercased_size(view) :
+      utf8::lowercased_size(view);
+    std::basic_string<CharT, Traits, Allocator> result(size, CharT{},
+      str.get_allocator());
+    const auto out = reinterpret_cast<char*>(result.data());
+    Upper ? utf8::uppercase(out, view) : utf8::lowercase(out, view);
+    str.swap(result);
+  } else if constexpr (is_unicode_unit_v<CharT>) {
+    CharT* p = str.data();
+    CharT* const e = p + str.size();
+    while (p != e) {
+      p = const_cast<CharT*>(units_to_case<Upper>(p, e, p));
+      if (p == e)
+        break;
+
+      // The surrogate pairs are mapped as a whole.
+      if (sizeof(CharT) == 2 && *p >= 0xD800 && *p <= 0xDBFF && e - p > 1
+        && p[1] >= 0xDC00 && p[1] <= 0xDFFF) {
+        const char32_t cp = 0x10000 + ((char32_t(p[0]) - 0xD800) << 10)
+          + (char32_t(p[1]) - 0xDC00);
+        const auto mapped = Upper ? utf8::to_uppercase(cp) :
+          utf8::to_lowercase(cp);
+        p[0] = static_cast<CharT>(0xD800 + ((mapped - 0x10000) >> 10));
+        p[1] = static_cast<CharT>(0xDC00 + ((mapped - 0x10000) & 0x3FF));
+        p += 2;
+      } else {
+        *p = to_case<Upper>(*p);
+        ++p;
+      }
+    }
+  } else {
+    for (auto& ch : str)
+      ch = to_case<Upper>(ch);
+  }
 }
 
+} // namespace detail
+
 // -----------------------------------------------------------------------------
 // lowercase
 // -----------------------------------------------------------------------------
@@ -219,33 +387,50 @@ trimmed(const std::basic_string_view<CharT, Traits> str,
 /**
  * @brief Replaces all of uppercase characters in `str` by the corresponding
  * lowercase characters.
+ *
+ * @see detail::to_case().
  */
-inline void lowercase(std::string& str)
+template<typename CharT, class Traits, class Allocator>
+void lowercase(std::basic_string<CharT, Traits, Allocator>& str)
 {
-  auto b = begin(str);
-  auto e = end(str);
-  transform(b, e, b, [](const auto c){return tolower(c);});
+  detail::to_case<false>(str);
 }
 
 /**
  * @returns The modified copy of the `str` with all of uppercase characters
  * replaced by the corresponding lowercase characters.
  */
+template<typename CharT, class Traits, class Allocator>
+std::basic_string<CharT, Traits, Allocator>
+to_lowercase(std::basic_string<CharT, Traits, Allocator> result)
+{
+  lowercase(result);
+  return result;
+}
+
+/// @overload
 inline std::string to_lowercase(std::string result)
 {
   lowercase(result);
   return result;
 }
 
-/// @returns `true` if all of characters of `str` are in uppercase.
-inline bool is_lowercased(const std::string_view str) noexcept
+/// @returns `true` if all of characters of `str` are in lowercase.
+template<typename CharT, class Traits>
+bool is_lowercased(const std::basic_string_view<CharT, Traits> str) noexcept
 {
-  return std::all_of(cbegin(str), cend(str), [](const auto c)
+  return std::all_of(cbegin(str), cend(str), [](const CharT c)
   {
-    return islower(c);
+    return detail::is_case<false>(c);
   });
 }
 
+/// @overload
+inline bool is_lowercased(const std::string_view str) noexcept
+{
+  return is_lowercased<char, std::string_view::traits_type>(str);
+}
+
 // -----------------------------------------------------------------------------
 // uppercase
 // -----------------------------------------------------------------------------
@@ -253,33 +438,50 @@ inline bool is_lowercased(const std::string_view str) noexcept
 /**
  * @brief Replaces all of lowercase characters in `str` by the corresponding
  * uppercase characters.
+ *
+ * @see detail::to_case().
  */
-inline void uppercase(std::string& str)
+template<typename CharT, class Traits, class Allocator>
+void uppercase(std::basic_string<CharT, Traits, Allocator>& str)
 {
-  auto b = begin(str);
-  auto e = end(str);
-  transform(b, e, b, [](const auto c){return toupper(c);});
+  detail::to_case<true>(str);
 }
 
 /**
  * @returns The modified copy of the `str` with all of lowercase characters
  * replaced by the corresponding uppercase characters.
  */
+template<typename CharT, class Traits, class Allocator>
+std::basic_string<CharT, Traits, Allocator>
+to_uppercase(std::basic_string<CharT, Traits, Allocator> result)
+{
+  uppercase(result);
+  return result;
+}
+
+/// @overload
 inline std::string to_uppercase(std::string result)
 {
   uppercase(result);
   return result;
 }
 
-/// @returns `true` if all of character of `str` are in lowercase.
-inline bool is_uppercased(const std::string_view str) noexcept
+/// @returns `true` if all of character of `str` are in uppercase.
+template<typename CharT, class Traits>
+bool is_uppercased(const std::basic_string_view<CharT, Traits> str) noexcept
 {
-  return std::all_of(cbegin(str), cend(str), [](const auto c)
+  return std::all_of(cbegin(str), cend(str), [](const CharT c)
   {
-    return isupper(c);
+    return detail::is_case<true>(c);
   });
 }
 
+/// @overload
+inline bool is_uppercased(const std::string_view str) noexcept
+{
+  return is_uppercased<char, std::string_view::traits_type>(str);
+}
+
 } // namespace dmitigr::str
 
 #endif  // DMITIGR_STR_TRANSFORM_HPP
@@ -0,0 +1,352 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_TRIGRAM_INDEX_HPP
+#define DMITIGR_STR_TRIGRAM_INDEX_HPP
+
+#include "exceptions.hpp"
+#include "numeric.hpp"
+#include "parallel.hpp"
+#include "simd.hpp"
+#include "string_table.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace dmitigr::str {
+
+// -----------------------------------------------------------------------------
+// Trigram index
+// -----------------------------------------------------------------------------
+
+namespace detail {
+
+/// The number of strings which are indexed by the single thread.
+constexpr std::size_t trigram_index_parallel_threshold{1 << 14};
+
+/// @returns The trigram of `p[0]`, `p[1]` and `p[2]` as the 24-bit integer.
+inline std::uint32_t trigram(const char* const p) noexcept
+{
+  return static_cast<std::uint32_t>(static_cast<unsigned char>(p[0])) << 16
+    | static_cast<std::uint32_t>(static_cast<unsigned char>(p[1])) << 8
+    | static_cast<std::uint32_t>(static_cast<unsigned char>(p[2]));
+}
+
+/**
+ * @brief Sorts `pairs` of form `trigram << 32 | index` by trigrams preserving
+ * the order of pairs with equal trigrams.
+ *
+ * @details Uses the LSD radix sort of three 8-bit digits.
+ */
+inline void sort_trigram_pairs(std::vector<std::uint64_t>& pairs)
+{
+  std::vector<std::uint64_t> buffer(pairs.size());
+  for (unsigned shift{32}; shift < 56; shift += 8) {
+    std::size_t offsets[257]{};
+    for (const auto pair : pairs)
+      ++offsets[(pair >> shift & 0xFF) + 1];
+    if (offsets[(pairs.empty() ? 0 : (pairs[0] >> shift & 0xFF)) + 1]
+      == pairs.size())
+      continue; // all of the digits are equal
+    for (unsigned i{1}; i < 257; ++i)
+      offsets[i] += offsets[i - 1];
+    for (const auto pair : pairs)
+      buffer[offsets[pair >> shift & 0xFF]++] = pair;
+    pairs.swap(buffer);
+  }
+}
+
+} // namespace detail
+
+/**
+ * @brief The inverted index of trigrams (substrings of three bytes) of the
+ * strings for the fast substring search.
+ *
+ * @details The posting list of each trigram is the increasing sequence of
+ * indices of strings which contain the trigram, encoded as the deltas in the
+ * varint format. The query intersects the posting lists of trigrams of the
+ * pattern (starting from the shortest one), and then verifies the candidates
+ * by the vectorized substring search, since the presence of all of the
+ * trigrams is necessary but not sufficient.
+ */
+class Trigram_index final {
+public:
+  /// The size type.
+  using size_type = std::size_t;
+
+  /**
+   * @brief Constructs the index of `strings` by using up to `thread_count`
+   * threads, or `std::thread::hardware_concurrency()` threads if
+   * `thread_count == 0`.
+   *
+   * @par Requires
+   * The elements of `strings` are convertible to `std::string_view`.
+   */
+  template<class Range>
+  explicit Trigram_index(const Range& strings, const unsigned thread_count = 1)
+    : strings_{strings}
+  {
+    build(thread_count);
+  }
+
+  /// @overload
+  explicit Trigram_index(String_table&& strings, const unsigned thread_count = 1)
+    : strings_{std::move(strings)}
+  {
+    build(thread_count);
+  }
+
+  /// @returns The number of strings.
+  size_type size() const noexcept
+  {
+    return strings_.size();
+  }
+
+  /// @returns `!size()`.
+  bool empty() const noexcept
+  {
+    return strings_.empty();
+  }
+
+  /// @returns The string at `index`.
+  std::string_view operator[](const size_type index) const noexcept
+  {
+    return strings_[index];
+  }
+
+  /// @returns The indexed strings.
+  const String_table& strings() const noexcept
+  {
+    return strings_;
+  }
+
+  /// @returns The size of compressed posting lists in bytes.
+  size_type postings_size() const noexcept
+  {
+    return postings_.size();
+  }
+
+  /**
+   * @brief Calls `f(index)` for each string which contains `pattern` in the
+   * increasing order of indices.
+   *
+   * @details If `pattern` is shorter than three bytes, all of the strings are
+   * verified.
+   */
+  template<typename F>
+  void for_each_match(const std::string_view pattern, F&& f) const
+  {
+    const auto is_match = [this, pattern](const size_type index)
+    {
+      const auto str = strings_[index];
+      return detail::search(str.data(), str.size(), pattern.data(),
+        pattern.size()) != static_cast<std::size_t>(-1);
+    };
+
+    if (pattern.size() < 3) {
+      for (size_type i{}; i < size(); ++i) {
+        if (is_match(i))
+          f(i);
+      }
+      return;
+    }
+
+    // Find the posting lists of distinct trigrams of pattern.
+    std::vector<const Posting_list*> lists;
+    for (std::size_t i{}; i + 3 <= pattern.size(); ++i) {
+      const auto list = find_list(detail::trigram(pattern.data() + i));
+      if (!list)
+        return;
+      else if (std::find(lists.begin(), lists.end(), list) == lists.end())
+        lists.push_back(list);
+    }
+    std::sort(lists.begin(), lists.end(),
+      [](const auto* const lhs, const auto* const rhs) noexcept
+      {
+        return lhs->count < rhs->count;
+      });
+
+    // Intersect the lists starting from the shortest one.
+    std::vector<std::uint32_t> candidates;
+    candidates.reserve(lists[0]->count);
+    decode(*lists[0], [&candidates](const std::uint32_t index)
+    {
+      candidates.push_back(index);
+      return true;
+    });
+    for (std::size_t l{1}; l < lists.size() && !candidates.empty(); ++l) {
+      std::size_t i{}, j{};
+      decode(*lists[l], [&](const std::uint32_t index)
+      {
+        for (; i < candidates.size() && candidates[i] < index; ++i);
+        if (i < candidates.size() && candidates[i] == index)
+          candidates[j++] = candidates[i++];
+        return i < candidates.size();
+      });
+      candidates.resize(j);
+    }
+
+    for (const auto index : candidates) {
+      if (is_match(index))
+        f(static_cast<size_type>(index));
+    }
+  }
+
+  /// @returns The indices of strings which contain `pattern` in increasing order.
+  std::vector<size_type> find(const std::string_view pattern) const
+  {
+    std::vector<size_type> result;
+    for_each_match(pattern, [&result](const size_type index)
+    {
+      result.push_back(index);
+    });
+    return result;
+  }
+
+private:
+  struct Posting_list final {
+    std::uint32_t trigram{};
+    std::uint32_t count{};
+    std::size_t offset{};
+  };
+
+  String_table strings_;
+  std::vector<Posting_list> lists_; // sorted by trigrams
+  std::string postings_;
+
+  const Posting_list* find_list(const std::uint32_t trigram) const noexcept
+  {
+    const auto i = std::lower_bound(lists_.begin(), lists_.end(), trigram,
+      [](const Posting_list& list, const std::uint32_t t) noexcept
+      {
+        return list.trigram < t;
+      });
+    return i != lists_.end() && i->trigram == trigram ? &*i : nullptr;
+  }
+
+  /// Calls `f(index)` for each index of `list` while `f` returns `true`.
+  template<typename F>
+  void decode(const Posting_list& list, const F& f) const
+  {
+    const char* p{postings_.data() + list.offset};
+    std::uint32_t index{};
+    for (std::uint32_t i{}; i < list.count; ++i) {
+      index += static_cast<std::uint32_t>(read_varint(p));
+      if (!f(index))
+        break;
+    }
+  }
+
+  /**
+   * @brief Builds the index.
+   *
+   * @details The strings are splitted into parts, and the trigrams of each
+   * part are distributed over shards by hash. Then the shards are sorted and
+   * encoded independently, and finally concatenated.
+   */
+  void build(unsigned thread_count)
+  {
+    const auto size = strings_.size();
+    if (size > std::numeric_limits<std::uint32_t>::max())
+      throw Exception{"cannot build trigram index of more than 2^32 strings"};
+
+    thread_count = detail::thread_count_or_default(thread_count);
+    if (size < detail::trigram_index_parallel_threshold)
+      thread_count = 1;
+    const auto shard = [thread_count](const std::uint32_t trigram) noexcept
+    {
+      return (trigram * 0x9E3779B1U >> 8) % thread_count;
+    };
+
+    // Collect the pairs of trigrams and indices of each part by shards.
+    std::vector<std::vector<std::uint64_t>> parts(thread_count * thread_count);
+    detail::run_parallel(thread_count, [&](const unsigned t)
+    {
+      const auto [b, e] = detail::part_bounds(size, thread_count, t);
+      auto* const part = parts.data() + t * thread_count;
+      for (auto i = b; i < e; ++i) {
+        const auto str = strings_[i];
+        for (std::size_t j{}; j + 3 <= str.size(); ++j) {
+          const auto trigram = detail::trigram(str.data() + j);
+          part[shard(trigram)].push_back(std::uint64_t{trigram} << 32 | i);
+        }
+      }
+    });
+
+    // Sort and encode the shards.
+    std::vector<std::vector<Posting_list>> shard_lists(thread_count);
+    std::vector<std::string> shard_postings(thread_count);
+    detail::run_parallel(thread_count, [&](const unsigned s)
+    {
+      std::vector<std::uint64_t> pairs;
+      for (unsigned t{}; t < thread_count; ++t) {
+        auto& part = parts[t * thread_count + s];
+        pairs.insert(pairs.end(), part.begin(), part.end());
+        std::vector<std::uint64_t>{}.swap(part);
+      }
+      detail::sort_trigram_pairs(pairs);
+
+      auto& lists = shard_lists[s];
+      auto& postings = shard_postings[s];
+      std::uint64_t prev_pair{};
+      for (std::size_t i{}; i < pairs.size(); ++i) {
+        const auto pair = pairs[i];
+        const auto trigram = static_cast<std::uint32_t>(pair >> 32);
+        const auto index = static_cast<std::uint32_t>(pair);
+        if (!i || trigram != lists.back().trigram) {
+          lists.push_back(Posting_list{trigram, 1, postings.size()});
+          append_varint(postings, index);
+        } else if (pair != prev_pair) {
+          ++lists.back().count;
+          append_varint(postings, index - static_cast<std::uint32_t>(prev_pair));
+        }
+        prev_pair = pair;
+      }
+    });
+
+    // Concatenate the shards.
+    std::size_t postings_size{}, lists_size{};
+    for (unsigned s{}; s < thread_count; ++s) {
+      postings_size += shard_postings[s].size();
+      lists_size += shard_lists[s].size();
+    }
+    postings_.reserve(postings_size);
+    lists_.reserve(lists_size);
+    for (unsigned s{}; s < thread_count; ++s) {
+      for (auto list : shard_lists[s]) {
+        list.offset += postings_.size();
+        lists_.push_back(list);
+      }
+      postings_.append(shard_postings[s]);
+    }
+    if (thread_count > 1)
+      std::sort(lists_.begin(), lists_.end(),
+        [](const Posting_list& lhs, const Posting_list& rhs) noexcept
+        {
+          return lhs.trigram < rhs.trigram;
+        });
+  }
+};
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_TRIGRAM_INDEX_HPP
@@ -0,0 +1,2158 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// This file is generated by tools/ucd_tables.pl from the Unicode Character
+// Database version 14.0.0. Do not edit!
+
+#ifndef DMITIGR_STR_UCD_NORMALIZATION_HPP
+#define DMITIGR_STR_UCD_NORMALIZATION_HPP
+
+#include <cstdint>
+
+namespace dmitigr::str::ucd {
+
+/// The normalization properties of a code point.
+struct Normalization_record final {
+  /// The canonical combining class.
+  std::uint8_t ccc;
+  /// The bitmask of `nfc_no`, `nfc_maybe` and `nfd_no`.
+  std::uint8_t flags;
+};
+
+constexpr std::uint8_t nfc_no{1};
+constexpr std::uint8_t nfc_maybe{2};
+constexpr std::uint8_t nfd_no{4};
+
+/// The code points starting from this one have the default properties.
+constexpr char32_t normalization_limit{195136};
+
+/// The binary logarithm of the size of the blocks of stage 2.
+constexpr unsigned normalization_block_shift{6};
+
+constexpr Normalization_record normalization_records[67] = {
+  {0,0},
+  {0,4},
+  {230,2},
+  {230,0},
+  {232,0},
+  {220,0},
+  {216,2},
+  {202,0},
+  {220,2},
+  {202,2},
+  {1,0},
+  {1,2},
+  {230,5},
+  {240,2},
+  {233,0},
+  {234,0},
+  {0,5},
+  {222,0},
+  {228,0},
+  {10,0},
+  {11,0},
+  {12,0},
+  {13,0},
+  {14,0},
+  {15,0},
+  {16,0},
+  {17,0},
+  {18,0},
+  {19,0},
+  {20,0},
+  {21,0},
+  {22,0},
+  {23,0},
+  {24,0},
+  {25,0},
+  {30,0},
+  {31,0},
+  {32,0},
+  {27,0},
+  {28,0},
+  {29,0},
+  {33,0},
+  {34,0},
+  {35,0},
+  {36,0},
+  {7,2},
+  {9,0},
+  {7,0},
+  {0,2},
+  {84,0},
+  {91,2},
+  {9,2},
+  {103,0},
+  {107,0},
+  {118,0},
+  {122,0},
+  {216,0},
+  {129,0},
+  {130,0},
+  {132,0},
+  {214,0},
+  {218,0},
+  {224,0},
+  {8,2},
+  {26,0},
+  {6,0},
+  {226,0},
+};
+
+constexpr std::uint8_t normalization_stage1[3049] = {
+  0,0,0,1,2,3,4,5,6,0,0,0,7,8,9,10,
+  11,12,13,14,0,0,15,16,17,18,0,19,20,21,0,22,
+  23,24,25,26,27,28,29,30,31,32,33,34,29,35,36,37,
+  33,38,33,39,40,37,0,41,42,43,44,45,46,47,48,49,
+  50,0,51,0,0,52,53,54,0,0,0,0,0,55,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,57,
+  0,0,58,0,59,0,0,0,60,61,62,63,64,65,66,67,
+  68,0,0,69,0,0,0,70,71,71,72,73,74,75,76,77,
+  78,0,0,79,80,0,81,82,83,84,85,86,87,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,88,0,0,0,0,
+  0,0,0,89,0,90,0,91,0,0,0,0,0,0,0,0,
+  92,93,94,95,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,96,97,98,0,0,0,0,
+  99,0,0,100,101,102,103,104,0,0,105,106,0,0,0,107,
+  71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+  71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+  71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+  71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+  71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+  71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+  71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+  71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+  71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+  71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+  71,71,71,71,71,71,71,71,71,71,71,71,71,71,108,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,109,109,109,109,110,111,109,112,113,114,0,0,
+  0,0,0,0,0,0,0,0,115,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,116,0,0,0,117,0,118,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,119,0,0,120,0,0,0,0,
+  0,0,0,0,121,0,0,0,0,0,122,0,0,123,124,0,
+  0,125,126,0,127,103,0,128,129,0,0,130,131,132,0,0,
+  0,133,134,135,0,0,136,137,90,0,138,0,139,0,0,0,
+  140,0,0,0,141,142,0,143,144,145,146,0,0,0,0,0,
+  90,0,0,0,0,147,148,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,149,150,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,151,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,152,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,153,154,155,0,156,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  157,0,0,0,150,0,0,0,0,0,158,159,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,160,0,161,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  109,109,109,109,109,109,109,109,162,
+};
+
+constexpr std::uint8_t normalization_stage2[10432] = {
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,
+  0,1,1,1,1,1,1,0,0,1,1,1,1,1,0,0,
+  1,1,1,1,1,1,0,1,1,1,1,1,1,1,1,1,
+  0,1,1,1,1,1,1,0,0,1,1,1,1,1,0,1,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,
+  1,0,0,0,1,1,1,1,0,1,1,1,1,1,1,0,
+  0,0,0,1,1,1,1,1,1,0,0,0,1,1,1,1,
+  1,1,0,0,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+  1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,
+  1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,1,
+  1,0,0,0,1,1,0,0,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,1,1,1,1,1,1,0,0,1,1,
+  0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,
+  2,2,2,2,2,3,2,2,2,2,2,2,2,3,3,2,
+  3,2,3,2,2,4,5,5,5,5,4,6,5,5,5,5,
+  5,7,7,8,8,8,8,9,9,5,5,5,5,8,8,5,
+  8,8,5,5,10,10,10,10,11,5,5,5,5,3,3,3,
+  12,12,2,12,12,13,3,5,5,5,3,3,3,5,5,0,
+  3,3,3,5,5,5,5,3,4,5,5,3,14,15,15,14,
+  15,15,14,3,3,3,3,3,3,3,3,3,3,3,3,3,
+  0,0,0,0,16,0,0,0,0,0,0,0,0,0,16,0,
+  0,0,0,0,0,1,1,16,1,1,1,0,1,0,1,1,
+  1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1,
+  1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,0,
+  0,0,0,1,1,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  1,1,0,1,0,0,0,1,0,0,0,0,1,1,1,0,
+  0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  1,1,0,1,0,0,0,1,0,0,0,0,1,1,1,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,1,1,0,0,0,0,0,0,0,0,
+  0,0,0,3,3,3,3,3,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  1,1,1,1,0,0,1,1,0,0,1,1,1,1,1,1,
+  0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1,
+  1,1,1,1,1,1,0,0,1,1,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,5,3,3,3,3,5,3,3,3,17,5,3,3,3,3,
+  3,3,5,5,5,5,5,5,3,3,5,3,3,17,18,3,
+  19,20,21,22,23,24,25,26,27,28,28,29,30,31,0,32,
+  0,33,34,0,3,5,0,27,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  3,3,3,3,3,3,3,3,35,36,37,0,0,0,0,0,
+  0,0,1,1,1,1,1,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,38,39,40,35,36,
+  37,41,42,2,2,8,5,3,3,3,3,3,5,3,3,5,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,1,0,0,3,3,3,3,3,3,3,0,0,3,
+  3,3,3,5,3,0,0,3,3,0,5,3,3,5,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  3,5,3,3,5,3,3,5,5,5,3,5,5,3,5,3,
+  3,3,5,3,5,3,5,3,5,3,3,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,3,3,3,3,3,
+  3,3,5,3,0,0,0,0,0,0,0,0,0,5,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,3,3,3,3,0,3,3,3,3,3,
+  3,3,3,3,0,3,3,3,0,3,3,3,3,3,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,5,5,5,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,3,5,5,5,3,3,3,3,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,3,3,3,3,3,5,
+  5,5,5,5,3,3,3,3,3,3,3,3,3,3,3,3,
+  3,3,0,5,3,3,5,3,3,5,3,3,3,5,5,5,
+  38,39,40,3,3,3,5,3,3,5,5,3,3,3,3,3,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,
+  0,1,0,0,1,0,0,0,0,0,0,0,45,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,
+  0,3,5,3,3,0,0,0,16,16,16,16,16,16,16,16,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,47,0,48,0,
+  0,0,0,0,0,0,0,0,0,0,0,1,1,46,0,0,
+  0,0,0,0,0,0,0,48,0,0,0,0,16,16,0,16,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,16,0,0,16,0,0,0,0,0,47,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,
+  0,0,0,0,0,0,0,0,0,16,16,16,0,0,16,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,47,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,1,0,0,1,1,46,0,0,
+  0,0,0,0,0,0,48,48,0,0,0,0,16,16,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,
+  0,0,0,0,0,0,0,0,0,0,1,1,1,46,0,0,
+  0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,1,0,0,0,0,46,0,0,
+  0,0,0,0,0,49,50,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  1,0,48,0,0,0,0,1,1,0,1,1,0,46,0,0,
+  0,0,0,0,0,48,48,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,46,46,0,48,0,
+  0,0,0,0,0,0,0,0,0,0,51,0,0,0,0,48,
+  0,0,0,0,0,0,0,0,0,0,1,0,1,1,1,48,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,52,52,46,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,53,53,53,53,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,54,54,46,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,55,55,55,55,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,5,5,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,5,0,5,0,56,0,0,0,0,0,0,
+  0,0,0,16,0,0,0,0,0,0,0,0,0,16,0,0,
+  0,0,16,0,0,0,0,16,0,0,0,0,16,0,0,0,
+  0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,
+  0,57,58,16,59,16,16,0,16,0,58,58,58,58,0,0,
+  58,16,3,3,46,0,3,3,0,0,0,0,0,0,0,0,
+  0,0,0,16,0,0,0,0,0,0,0,0,0,16,0,0,
+  0,0,16,0,0,0,0,16,0,0,0,0,16,0,0,0,
+  0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,
+  0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,1,0,0,0,0,0,0,0,48,0,
+  0,0,0,0,0,0,0,47,0,46,46,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+  48,48,48,48,48,48,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,48,48,48,48,48,48,48,48,
+  48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+  48,48,48,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,3,3,3,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,46,46,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,46,0,0,0,0,0,0,0,0,0,0,3,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,18,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,17,3,5,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,3,5,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,3,3,3,3,3,3,3,3,0,0,5,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  3,3,3,3,3,5,5,5,5,5,5,3,3,5,0,5,
+  5,3,3,5,5,3,3,3,3,3,5,3,3,3,3,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,1,0,1,0,1,0,1,0,1,0,
+  0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,47,48,0,0,0,0,0,1,0,1,0,0,
+  1,1,0,1,46,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,3,5,3,3,3,
+  3,3,3,3,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,46,46,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,47,0,0,0,0,0,0,0,0,0,
+  0,0,46,46,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,47,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  3,3,3,0,10,5,5,5,5,5,3,3,5,5,5,5,
+  3,0,10,10,10,10,10,10,10,0,0,0,0,5,0,0,
+  0,0,0,0,3,0,0,0,3,3,0,0,0,0,0,0,
+  3,3,5,3,3,3,3,3,3,3,5,3,3,15,60,5,
+  7,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+  3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+  3,3,3,3,3,3,4,18,18,5,61,3,14,5,3,5,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,1,1,1,1,0,1,0,0,0,0,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,
+  1,1,1,1,1,1,1,1,0,1,0,1,0,1,0,1,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,16,1,16,1,16,1,16,1,16,1,16,1,16,0,0,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,0,1,1,1,1,1,16,1,0,16,0,
+  0,1,1,1,1,0,1,1,1,16,1,16,1,1,1,1,
+  1,1,1,16,0,0,1,1,1,1,1,16,0,1,1,1,
+  1,1,1,16,1,1,1,1,1,1,1,16,1,1,16,16,
+  0,0,1,1,1,0,1,1,1,16,1,16,1,16,0,0,
+  16,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  3,3,10,10,3,3,3,3,10,10,10,3,3,0,0,0,
+  0,3,0,0,0,10,10,3,5,3,10,10,5,5,5,5,
+  3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,16,0,0,0,16,16,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,1,0,0,0,0,1,0,0,1,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,1,0,1,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,1,0,0,1,0,0,1,0,1,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  1,0,1,0,0,0,0,0,0,0,0,0,0,1,1,1,
+  1,1,0,0,1,1,0,0,1,1,0,0,0,0,0,0,
+  1,1,0,0,1,1,0,0,1,1,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  1,1,1,1,0,0,0,0,0,0,1,1,1,1,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,16,16,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,
+  3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+  3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,61,18,4,17,62,62,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,
+  1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+  1,0,1,0,0,1,0,1,0,1,0,0,0,0,0,0,
+  1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,1,0,0,0,0,63,63,0,0,0,1,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,0,
+  1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,
+  1,0,1,0,0,1,0,1,0,1,0,0,0,0,0,0,
+  1,1,0,1,1,0,1,1,0,1,1,0,1,1,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,1,0,0,1,1,1,1,0,0,0,1,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,
+  0,0,0,0,3,3,3,3,3,3,3,3,3,3,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,3,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+  3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,5,5,5,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,47,0,0,0,0,0,0,0,0,0,0,0,0,
+  46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  3,0,3,3,5,0,0,3,3,0,0,0,0,0,3,3,
+  0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+  1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+  16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+  16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+  16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+  16,16,16,16,16,16,16,16,16,16,16,16,16,16,0,0,
+  16,0,16,0,0,16,16,16,16,16,16,16,16,16,16,0,
+  16,0,16,0,0,16,16,0,0,0,16,16,16,16,16,16,
+  16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+  16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+  16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+  16,16,16,16,16,16,16,16,16,16,16,16,16,16,0,0,
+  16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+  16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+  16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,16,64,16,
+  0,0,0,0,0,0,0,0,0,0,16,16,16,16,16,16,
+  16,16,16,16,16,16,16,0,16,16,16,16,16,0,16,0,
+  16,16,0,16,16,0,16,16,16,16,16,16,16,16,16,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  3,3,3,3,3,3,3,5,5,5,5,5,5,5,3,3,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,3,3,3,3,3,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,3,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,3,10,5,0,0,0,0,46,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,3,5,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,3,3,3,3,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,3,3,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,5,5,3,3,3,5,3,5,5,5,
+  5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,3,5,3,5,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,1,0,1,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,46,45,0,0,0,0,0,
+  3,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,48,0,0,0,0,0,0,1,1,
+  0,0,0,46,46,0,0,0,0,0,0,0,0,0,0,0,
+  46,0,0,0,0,0,0,0,0,0,47,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,46,47,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,47,46,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,47,47,0,48,0,
+  0,0,0,0,0,0,0,0,0,0,0,1,1,46,0,0,
+  0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,3,3,3,3,3,3,3,0,0,0,
+  3,3,3,3,3,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,46,0,0,0,47,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  48,0,0,0,0,0,0,0,0,0,48,1,1,48,1,0,
+  0,0,46,47,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,
+  0,0,0,0,0,0,0,0,0,0,1,1,0,0,0,46,
+  47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,46,47,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,46,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,46,47,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  48,0,0,0,0,0,0,0,1,0,0,0,0,46,46,0,
+  0,0,0,47,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,47,0,46,46,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  10,10,10,10,10,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  3,3,3,3,3,3,3,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  65,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,16,
+  16,16,16,16,16,56,56,10,10,10,0,0,0,66,56,56,
+  56,56,56,0,0,0,0,0,0,0,0,5,5,5,5,5,
+  5,5,5,0,0,3,3,3,3,3,5,5,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,3,3,3,3,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,16,16,16,16,16,
+  16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,3,3,3,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  3,3,3,3,3,3,3,0,3,3,3,3,3,3,3,3,
+  3,3,3,3,3,3,3,3,3,0,0,3,3,3,3,3,
+  3,3,0,3,3,0,3,3,3,3,3,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,3,3,3,3,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,3,3,3,3,3,3,47,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+  16,16,16,16,16,16,16,16,16,16,16,16,16,16,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+};
+
+/**
+ * The sorted code points which have canonical decompositions (except the
+ * Hangul syllables).
+ */
+constexpr char32_t decomposition_keys[2061] = {
+  0x00C0,0x00C1,0x00C2,0x00C3,0x00C4,0x00C5,0x00C7,0x00C8,
+  0x00C9,0x00CA,0x00CB,0x00CC,0x00CD,0x00CE,0x00CF,0x00D1,
+  0x00D2,0x00D3,0x00D4,0x00D5,0x00D6,0x00D9,0x00DA,0x00DB,
+  0x00DC,0x00DD,0x00E0,0x00E1,0x00E2,0x00E3,0x00E4,0x00E5,
+  0x00E7,0x00E8,0x00E9,0x00EA,0x00EB,0x00EC,0x00ED,0x00EE,
+  0x00EF,0x00F1,0x00F2,0x00F3,0x00F4,0x00F5,0x00F6,0x00F9,
+  0x00FA,0x00FB,0x00FC,0x00FD,0x00FF,0x0100,0x0101,0x0102,
+  0x0103,0x0104,0x0105,0x0106,0x0107,0x0108,0x0109,0x010A,
+  0x010B,0x010C,0x010D,0x010E,0x010F,0x0112,0x0113,0x0114,
+  0x0115,0x0116,0x0117,0x0118,0x0119,0x011A,0x011B,0x011C,
+  0x011D,0x011E,0x011F,0x0120,0x0121,0x0122,0x0123,0x0124,
+  0x0125,0x0128,0x0129,0x012A,0x012B,0x012C,0x012D,0x012E,
+  0x012F,0x0130,0x0134,0x0135,0x0136,0x0137,0x0139,0x013A,
+  0x013B,0x013C,0x013D,0x013E,0x0143,0x0144,0x0145,0x0146,
+  0x0147,0x0148,0x014C,0x014D,0x014E,0x014F,0x0150,0x0151,
+  0x0154,0x0155,0x0156,0x0157,0x0158,0x0159,0x015A,0x015B,
+  0x015C,0x015D,0x015E,0x015F,0x0160,0x0161,0x0162,0x0163,
+  0x0164,0x0165,0x0168,0x0169,0x016A,0x016B,0x016C,0x016D,
+  0x016E,0x016F,0x0170,0x0171,0x0172,0x0173,0x0174,0x0175,
+  0x0176,0x0177,0x0178,0x0179,0x017A,0x017B,0x017C,0x017D,
+  0x017E,0x01A0,0x01A1,0x01AF,0x01B0,0x01CD,0x01CE,0x01CF,
+  0x01D0,0x01D1,0x01D2,0x01D3,0x01D4,0x01D5,0x01D6,0x01D7,
+  0x01D8,0x01D9,0x01DA,0x01DB,0x01DC,0x01DE,0x01DF,0x01E0,
+  0x01E1,0x01E2,0x01E3,0x01E6,0x01E7,0x01E8,0x01E9,0x01EA,
+  0x01EB,0x01EC,0x01ED,0x01EE,0x01EF,0x01F0,0x01F4,0x01F5,
+  0x01F8,0x01F9,0x01FA,0x01FB,0x01FC,0x01FD,0x01FE,0x01FF,
+  0x0200,0x0201,0x0202,0x0203,0x0204,0x0205,0x0206,0x0207,
+  0x0208,0x0209,0x020A,0x020B,0x020C,0x020D,0x020E,0x020F,
+  0x0210,0x0211,0x0212,0x0213,0x0214,0x0215,0x0216,0x0217,
+  0x0218,0x0219,0x021A,0x021B,0x021E,0x021F,0x0226,0x0227,
+  0x0228,0x0229,0x022A,0x022B,0x022C,0x022D,0x022E,0x022F,
+  0x0230,0x0231,0x0232,0x0233,0x0340,0x0341,0x0343,0x0344,
+  0x0374,0x037E,0x0385,0x0386,0x0387,0x0388,0x0389,0x038A,
+  0x038C,0x038E,0x038F,0x0390,0x03AA,0x03AB,0x03AC,0x03AD,
+  0x03AE,0x03AF,0x03B0,0x03CA,0x03CB,0x03CC,0x03CD,0x03CE,
+  0x03D3,0x03D4,0x0400,0x0401,0x0403,0x0407,0x040C,0x040D,
+  0x040E,0x0419,0x0439,0x0450,0x0451,0x0453,0x0457,0x045C,
+  0x045D,0x045E,0x0476,0x0477,0x04C1,0x04C2,0x04D0,0x04D1,
+  0x04D2,0x04D3,0x04D6,0x04D7,0x04DA,0x04DB,0x04DC,0x04DD,
+  0x04DE,0x04DF,0x04E2,0x04E3,0x04E4,0x04E5,0x04E6,0x04E7,
+  0x04EA,0x04EB,0x04EC,0x04ED,0x04EE,0x04EF,0x04F0,0x04F1,
+  0x04F2,0x04F3,0x04F4,0x04F5,0x04F8,0x04F9,0x0622,0x0623,
+  0x0624,0x0625,0x0626,0x06C0,0x06C2,0x06D3,0x0929,0x0931,
+  0x0934,0x0958,0x0959,0x095A,0x095B,0x095C,0x095D,0x095E,
+  0x095F,0x09CB,0x09CC,0x09DC,0x09DD,0x09DF,0x0A33,0x0A36,
+  0x0A59,0x0A5A,0x0A5B,0x0A5E,0x0B48,0x0B4B,0x0B4C,0x0B5C,
+  0x0B5D,0x0B94,0x0BCA,0x0BCB,0x0BCC,0x0C48,0x0CC0,0x0CC7,
+  0x0CC8,0x0CCA,0x0CCB,0x0D4A,0x0D4B,0x0D4C,0x0DDA,0x0DDC,
+  0x0DDD,0x0DDE,0x0F43,0x0F4D,0x0F52,0x0F57,0x0F5C,0x0F69,
+  0x0F73,0x0F75,0x0F76,0x0F78,0x0F81,0x0F93,0x0F9D,0x0FA2,
+  0x0FA7,0x0FAC,0x0FB9,0x1026,0x1B06,0x1B08,0x1B0A,0x1B0C,
+  0x1B0E,0x1B12,0x1B3B,0x1B3D,0x1B40,0x1B41,0x1B43,0x1E00,
+  0x1E01,0x1E02,0x1E03,0x1E04,0x1E05,0x1E06,0x1E07,0x1E08,
+  0x1E09,0x1E0A,0x1E0B,0x1E0C,0x1E0D,0x1E0E,0x1E0F,0x1E10,
+  0x1E11,0x1E12,0x1E13,0x1E14,0x1E15,0x1E16,0x1E17,0x1E18,
+  0x1E19,0x1E1A,0x1E1B,0x1E1C,0x1E1D,0x1E1E,0x1E1F,0x1E20,
+  0x1E21,0x1E22,0x1E23,0x1E24,0x1E25,0x1E26,0x1E27,0x1E28,
+  0x1E29,0x1E2A,0x1E2B,0x1E2C,0x1E2D,0x1E2E,0x1E2F,0x1E30,
+  0x1E31,0x1E32,0x1E33,0x1E34,0x1E35,0x1E36,0x1E37,0x1E38,
+  0x1E39,0x1E3A,0x1E3B,0x1E3C,0x1E3D,0x1E3E,0x1E3F,0x1E40,
+  0x1E41,0x1E42,0x1E43,0x1E44,0x1E45,0x1E46,0x1E47,0x1E48,
+  0x1E49,0x1E4A,0x1E4B,0x1E4C,0x1E4D,0x1E4E,0x1E4F,0x1E50,
+  0x1E51,0x1E52,0x1E53,0x1E54,0x1E55,0x1E56,0x1E57,0x1E58,
+  0x1E59,0x1E5A,0x1E5B,0x1E5C,0x1E5D,0x1E5E,0x1E5F,0x1E60,
+  0x1E61,0x1E62,0x1E63,0x1E64,0x1E65,0x1E66,0x1E67,0x1E68,
+  0x1E69,0x1E6A,0x1E6B,0x1E6C,0x1E6D,0x1E6E,0x1E6F,0x1E70,
+  0x1E71,0x1E72,0x1E73,0x1E74,0x1E75,0x1E76,0x1E77,0x1E78,
+  0x1E79,0x1E7A,0x1E7B,0x1E7C,0x1E7D,0x1E7E,0x1E7F,0x1E80,
+  0x1E81,0x1E82,0x1E83,0x1E84,0x1E85,0x1E86,0x1E87,0x1E88,
+  0x1E89,0x1E8A,0x1E8B,0x1E8C,0x1E8D,0x1E8E,0x1E8F,0x1E90,
+  0x1E91,0x1E92,0x1E93,0x1E94,0x1E95,0x1E96,0x1E97,0x1E98,
+  0x1E99,0x1E9B,0x1EA0,0x1EA1,0x1EA2,0x1EA3,0x1EA4,0x1EA5,
+  0x1EA6,0x1EA7,0x1EA8,0x1EA9,0x1EAA,0x1EAB,0x1EAC,0x1EAD,
+  0x1EAE,0x1EAF,0x1EB0,0x1EB1,0x1EB2,0x1EB3,0x1EB4,0x1EB5,
+  0x1EB6,0x1EB7,0x1EB8,0x1EB9,0x1EBA,0x1EBB,0x1EBC,0x1EBD,
+  0x1EBE,0x1EBF,0x1EC0,0x1EC1,0x1EC2,0x1EC3,0x1EC4,0x1EC5,
+  0x1EC6,0x1EC7,0x1EC8,0x1EC9,0x1ECA,0x1ECB,0x1ECC,0x1ECD,
+  0x1ECE,0x1ECF,0x1ED0,0x1ED1,0x1ED2,0x1ED3,0x1ED4,0x1ED5,
+  0x1ED6,0x1ED7,0x1ED8,0x1ED9,0x1EDA,0x1EDB,0x1EDC,0x1EDD,
+  0x1EDE,0x1EDF,0x1EE0,0x1EE1,0x1EE2,0x1EE3,0x1EE4,0x1EE5,
+  0x1EE6,0x1EE7,0x1EE8,0x1EE9,0x1EEA,0x1EEB,0x1EEC,0x1EED,
+  0x1EEE,0x1EEF,0x1EF0,0x1EF1,0x1EF2,0x1EF3,0x1EF4,0x1EF5,
+  0x1EF6,0x1EF7,0x1EF8,0x1EF9,0x1F00,0x1F01,0x1F02,0x1F03,
+  0x1F04,0x1F05,0x1F06,0x1F07,0x1F08,0x1F09,0x1F0A,0x1F0B,
+  0x1F0C,0x1F0D,0x1F0E,0x1F0F,0x1F10,0x1F11,0x1F12,0x1F13,
+  0x1F14,0x1F15,0x1F18,0x1F19,0x1F1A,0x1F1B,0x1F1C,0x1F1D,
+  0x1F20,0x1F21,0x1F22,0x1F23,0x1F24,0x1F25,0x1F26,0x1F27,
+  0x1F28,0x1F29,0x1F2A,0x1F2B,0x1F2C,0x1F2D,0x1F2E,0x1F2F,
+  0x1F30,0x1F31,0x1F32,0x1F33,0x1F34,0x1F35,0x1F36,0x1F37,
+  0x1F38,0x1F39,0x1F3A,0x1F3B,0x1F3C,0x1F3D,0x1F3E,0x1F3F,
+  0x1F40,0x1F41,0x1F42,0x1F43,0x1F44,0x1F45,0x1F48,0x1F49,
+  0x1F4A,0x1F4B,0x1F4C,0x1F4D,0x1F50,0x1F51,0x1F52,0x1F53,
+  0x1F54,0x1F55,0x1F56,0x1F57,0x1F59,0x1F5B,0x1F5D,0x1F5F,
+  0x1F60,0x1F61,0x1F62,0x1F63,0x1F64,0x1F65,0x1F66,0x1F67,
+  0x1F68,0x1F69,0x1F6A,0x1F6B,0x1F6C,0x1F6D,0x1F6E,0x1F6F,
+  0x1F70,0x1F71,0x1F72,0x1F73,0x1F74,0x1F75,0x1F76,0x1F77,
+  0x1F78,0x1F79,0x1F7A,0x1F7B,0x1F7C,0x1F7D,0x1F80,0x1F81,
+  0x1F82,0x1F83,0x1F84,0x1F85,0x1F86,0x1F87,0x1F88,0x1F89,
+  0x1F8A,0x1F8B,0x1F8C,0x1F8D,0x1F8E,0x1F8F,0x1F90,0x1F91,
+  0x1F92,0x1F93,0x1F94,0x1F95,0x1F96,0x1F97,0x1F98,0x1F99,
+  0x1F9A,0x1F9B,0x1F9C,0x1F9D,0x1F9E,0x1F9F,0x1FA0,0x1FA1,
+  0x1FA2,0x1FA3,0x1FA4,0x1FA5,0x1FA6,0x1FA7,0x1FA8,0x1FA9,
+  0x1FAA,0x1FAB,0x1FAC,0x1FAD,0x1FAE,0x1FAF,0x1FB0,0x1FB1,
+  0x1FB2,0x1FB3,0x1FB4,0x1FB6,0x1FB7,0x1FB8,0x1FB9,0x1FBA,
+  0x1FBB,0x1FBC,0x1FBE,0x1FC1,0x1FC2,0x1FC3,0x1FC4,0x1FC6,
+  0x1FC7,0x1FC8,0x1FC9,0x1FCA,0x1FCB,0x1FCC,0x1FCD,0x1FCE,
+  0x1FCF,0x1FD0,0x1FD1,0x1FD2,0x1FD3,0x1FD6,0x1FD7,0x1FD8,
+  0x1FD9,0x1FDA,0x1FDB,0x1FDD,0x1FDE,0x1FDF,0x1FE0,0x1FE1,
+  0x1FE2,0x1FE3,0x1FE4,0x1FE5,0x1FE6,0x1FE7,0x1FE8,0x1FE9,
+  0x1FEA,0x1FEB,0x1FEC,0x1FED,0x1FEE,0x1FEF,0x1FF2,0x1FF3,
+  0x1FF4,0x1FF6,0x1FF7,0x1FF8,0x1FF9,0x1FFA,0x1FFB,0x1FFC,
+  0x1FFD,0x2000,0x2001,0x2126,0x212A,0x212B,0x219A,0x219B,
+  0x21AE,0x21CD,0x21CE,0x21CF,0x2204,0x2209,0x220C,0x2224,
+  0x2226,0x2241,0x2244,0x2247,0x2249,0x2260,0x2262,0x226D,
+  0x226E,0x226F,0x2270,0x2271,0x2274,0x2275,0x2278,0x2279,
+  0x2280,0x2281,0x2284,0x2285,0x2288,0x2289,0x22AC,0x22AD,
+  0x22AE,0x22AF,0x22E0,0x22E1,0x22E2,0x22E3,0x22EA,0x22EB,
+  0x22EC,0x22ED,0x2329,0x232A,0x2ADC,0x304C,0x304E,0x3050,
+  0x3052,0x3054,0x3056,0x3058,0x305A,0x305C,0x305E,0x3060,
+  0x3062,0x3065,0x3067,0x3069,0x3070,0x3071,0x3073,0x3074,
+  0x3076,0x3077,0x3079,0x307A,0x307C,0x307D,0x3094,0x309E,
+  0x30AC,0x30AE,0x30B0,0x30B2,0x30B4,0x30B6,0x30B8,0x30BA,
+  0x30BC,0x30BE,0x30C0,0x30C2,0x30C5,0x30C7,0x30C9,0x30D0,
+  0x30D1,0x30D3,0x30D4,0x30D6,0x30D7,0x30D9,0x30DA,0x30DC,
+  0x30DD,0x30F4,0x30F7,0x30F8,0x30F9,0x30FA,0x30FE,0xF900,
+  0xF901,0xF902,0xF903,0xF904,0xF905,0xF906,0xF907,0xF908,
+  0xF909,0xF90A,0xF90B,0xF90C,0xF90D,0xF90E,0xF90F,0xF910,
+  0xF911,0xF912,0xF913,0xF914,0xF915,0xF916,0xF917,0xF918,
+  0xF919,0xF91A,0xF91B,0xF91C,0xF91D,0xF91E,0xF91F,0xF920,
+  0xF921,0xF922,0xF923,0xF924,0xF925,0xF926,0xF927,0xF928,
+  0xF929,0xF92A,0xF92B,0xF92C,0xF92D,0xF92E,0xF92F,0xF930,
+  0xF931,0xF932,0xF933,0xF934,0xF935,0xF936,0xF937,0xF938,
+  0xF939,0xF93A,0xF93B,0xF93C,0xF93D,0xF93E,0xF93F,0xF940,
+  0xF941,0xF942,0xF943,0xF944,0xF945,0xF946,0xF947,0xF948,
+  0xF949,0xF94A,0xF94B,0xF94C,0xF94D,0xF94E,0xF94F,0xF950,
+  0xF951,0xF952,0xF953,0xF954,0xF955,0xF956,0xF957,0xF958,
+  0xF959,0xF95A,0xF95B,0xF95C,0xF95D,0xF95E,0xF95F,0xF960,
+  0xF961,0xF962,0xF963,0xF964,0xF965,0xF966,0xF967,0xF968,
+  0xF969,0xF96A,0xF96B,0xF96C,0xF96D,0xF96E,0xF96F,0xF970,
+  0xF971,0xF972,0xF973,0xF974,0xF975,0xF976,0xF977,0xF978,
+  0xF979,0xF97A,0xF97B,0xF97C,0xF97D,0xF97E,0xF97F,0xF980,
+  0xF981,0xF982,0xF983,0xF984,0xF985,0xF986,0xF987,0xF988,
+  0xF989,0xF98A,0xF98B,0xF98C,0xF98D,0xF98E,0xF98F,0xF990,
+  0xF991,0xF992,0xF993,0xF994,0xF995,0xF996,0xF997,0xF998,
+  0xF999,0xF99A,0xF99B,0xF99C,0xF99D,0xF99E,0xF99F,0xF9A0,
+  0xF9A1,0xF9A2,0xF9A3,0xF9A4,0xF9A5,0xF9A6,0xF9A7,0xF9A8,
+  0xF9A9,0xF9AA,0xF9AB,0xF9AC,0xF9AD,0xF9AE,0xF9AF,0xF9B0,
+  0xF9B1,0xF9B2,0xF9B3,0xF9B4,0xF9B5,0xF9B6,0xF9B7,0xF9B8,
+  0xF9B9,0xF9BA,0xF9BB,0xF9BC,0xF9BD,0xF9BE,0xF9BF,0xF9C0,
+  0xF9C1,0xF9C2,0xF9C3,0xF9C4,0xF9C5,0xF9C6,0xF9C7,0xF9C8,
+  0xF9C9,0xF9CA,0xF9CB,0xF9CC,0xF9CD,0xF9CE,0xF9CF,0xF9D0,
+  0xF9D1,0xF9D2,0xF9D3,0xF9D4,0xF9D5,0xF9D6,0xF9D7,0xF9D8,
+  0xF9D9,0xF9DA,0xF9DB,0xF9DC,0xF9DD,0xF9DE,0xF9DF,0xF9E0,
+  0xF9E1,0xF9E2,0xF9E3,0xF9E4,0xF9E5,0xF9E6,0xF9E7,0xF9E8,
+  0xF9E9,0xF9EA,0xF9EB,0xF9EC,0xF9ED,0xF9EE,0xF9EF,0xF9F0,
+  0xF9F1,0xF9F2,0xF9F3,0xF9F4,0xF9F5,0xF9F6,0xF9F7,0xF9F8,
+  0xF9F9,0xF9FA,0xF9FB,0xF9FC,0xF9FD,0xF9FE,0xF9FF,0xFA00,
+  0xFA01,0xFA02,0xFA03,0xFA04,0xFA05,0xFA06,0xFA07,0xFA08,
+  0xFA09,0xFA0A,0xFA0B,0xFA0C,0xFA0D,0xFA10,0xFA12,0xFA15,
+  0xFA16,0xFA17,0xFA18,0xFA19,0xFA1A,0xFA1B,0xFA1C,0xFA1D,
+  0xFA1E,0xFA20,0xFA22,0xFA25,0xFA26,0xFA2A,0xFA2B,0xFA2C,
+  0xFA2D,0xFA2E,0xFA2F,0xFA30,0xFA31,0xFA32,0xFA33,0xFA34,
+  0xFA35,0xFA36,0xFA37,0xFA38,0xFA39,0xFA3A,0xFA3B,0xFA3C,
+  0xFA3D,0xFA3E,0xFA3F,0xFA40,0xFA41,0xFA42,0xFA43,0xFA44,
+  0xFA45,0xFA46,0xFA47,0xFA48,0xFA49,0xFA4A,0xFA4B,0xFA4C,
+  0xFA4D,0xFA4E,0xFA4F,0xFA50,0xFA51,0xFA52,0xFA53,0xFA54,
+  0xFA55,0xFA56,0xFA57,0xFA58,0xFA59,0xFA5A,0xFA5B,0xFA5C,
+  0xFA5D,0xFA5E,0xFA5F,0xFA60,0xFA61,0xFA62,0xFA63,0xFA64,
+  0xFA65,0xFA66,0xFA67,0xFA68,0xFA69,0xFA6A,0xFA6B,0xFA6C,
+  0xFA6D,0xFA70,0xFA71,0xFA72,0xFA73,0xFA74,0xFA75,0xFA76,
+  0xFA77,0xFA78,0xFA79,0xFA7A,0xFA7B,0xFA7C,0xFA7D,0xFA7E,
+  0xFA7F,0xFA80,0xFA81,0xFA82,0xFA83,0xFA84,0xFA85,0xFA86,
+  0xFA87,0xFA88,0xFA89,0xFA8A,0xFA8B,0xFA8C,0xFA8D,0xFA8E,
+  0xFA8F,0xFA90,0xFA91,0xFA92,0xFA93,0xFA94,0xFA95,0xFA96,
+  0xFA97,0xFA98,0xFA99,0xFA9A,0xFA9B,0xFA9C,0xFA9D,0xFA9E,
+  0xFA9F,0xFAA0,0xFAA1,0xFAA2,0xFAA3,0xFAA4,0xFAA5,0xFAA6,
+  0xFAA7,0xFAA8,0xFAA9,0xFAAA,0xFAAB,0xFAAC,0xFAAD,0xFAAE,
+  0xFAAF,0xFAB0,0xFAB1,0xFAB2,0xFAB3,0xFAB4,0xFAB5,0xFAB6,
+  0xFAB7,0xFAB8,0xFAB9,0xFABA,0xFABB,0xFABC,0xFABD,0xFABE,
+  0xFABF,0xFAC0,0xFAC1,0xFAC2,0xFAC3,0xFAC4,0xFAC5,0xFAC6,
+  0xFAC7,0xFAC8,0xFAC9,0xFACA,0xFACB,0xFACC,0xFACD,0xFACE,
+  0xFACF,0xFAD0,0xFAD1,0xFAD2,0xFAD3,0xFAD4,0xFAD5,0xFAD6,
+  0xFAD7,0xFAD8,0xFAD9,0xFB1D,0xFB1F,0xFB2A,0xFB2B,0xFB2C,
+  0xFB2D,0xFB2E,0xFB2F,0xFB30,0xFB31,0xFB32,0xFB33,0xFB34,
+  0xFB35,0xFB36,0xFB38,0xFB39,0xFB3A,0xFB3B,0xFB3C,0xFB3E,
+  0xFB40,0xFB41,0xFB43,0xFB44,0xFB46,0xFB47,0xFB48,0xFB49,
+  0xFB4A,0xFB4B,0xFB4C,0xFB4D,0xFB4E,0x1109A,0x1109C,0x110AB,
+  0x1112E,0x1112F,0x1134B,0x1134C,0x114BB,0x114BC,0x114BE,0x115BA,
+  0x115BB,0x11938,0x1D15E,0x1D15F,0x1D160,0x1D161,0x1D162,0x1D163,
+  0x1D164,0x1D1BB,0x1D1BC,0x1D1BD,0x1D1BE,0x1D1BF,0x1D1C0,0x2F800,
+  0x2F801,0x2F802,0x2F803,0x2F804,0x2F805,0x2F806,0x2F807,0x2F808,
+  0x2F809,0x2F80A,0x2F80B,0x2F80C,0x2F80D,0x2F80E,0x2F80F,0x2F810,
+  0x2F811,0x2F812,0x2F813,0x2F814,0x2F815,0x2F816,0x2F817,0x2F818,
+  0x2F819,0x2F81A,0x2F81B,0x2F81C,0x2F81D,0x2F81E,0x2F81F,0x2F820,
+  0x2F821,0x2F822,0x2F823,0x2F824,0x2F825,0x2F826,0x2F827,0x2F828,
+  0x2F829,0x2F82A,0x2F82B,0x2F82C,0x2F82D,0x2F82E,0x2F82F,0x2F830,
+  0x2F831,0x2F832,0x2F833,0x2F834,0x2F835,0x2F836,0x2F837,0x2F838,
+  0x2F839,0x2F83A,0x2F83B,0x2F83C,0x2F83D,0x2F83E,0x2F83F,0x2F840,
+  0x2F841,0x2F842,0x2F843,0x2F844,0x2F845,0x2F846,0x2F847,0x2F848,
+  0x2F849,0x2F84A,0x2F84B,0x2F84C,0x2F84D,0x2F84E,0x2F84F,0x2F850,
+  0x2F851,0x2F852,0x2F853,0x2F854,0x2F855,0x2F856,0x2F857,0x2F858,
+  0x2F859,0x2F85A,0x2F85B,0x2F85C,0x2F85D,0x2F85E,0x2F85F,0x2F860,
+  0x2F861,0x2F862,0x2F863,0x2F864,0x2F865,0x2F866,0x2F867,0x2F868,
+  0x2F869,0x2F86A,0x2F86B,0x2F86C,0x2F86D,0x2F86E,0x2F86F,0x2F870,
+  0x2F871,0x2F872,0x2F873,0x2F874,0x2F875,0x2F876,0x2F877,0x2F878,
+  0x2F879,0x2F87A,0x2F87B,0x2F87C,0x2F87D,0x2F87E,0x2F87F,0x2F880,
+  0x2F881,0x2F882,0x2F883,0x2F884,0x2F885,0x2F886,0x2F887,0x2F888,
+  0x2F889,0x2F88A,0x2F88B,0x2F88C,0x2F88D,0x2F88E,0x2F88F,0x2F890,
+  0x2F891,0x2F892,0x2F893,0x2F894,0x2F895,0x2F896,0x2F897,0x2F898,
+  0x2F899,0x2F89A,0x2F89B,0x2F89C,0x2F89D,0x2F89E,0x2F89F,0x2F8A0,
+  0x2F8A1,0x2F8A2,0x2F8A3,0x2F8A4,0x2F8A5,0x2F8A6,0x2F8A7,0x2F8A8,
+  0x2F8A9,0x2F8AA,0x2F8AB,0x2F8AC,0x2F8AD,0x2F8AE,0x2F8AF,0x2F8B0,
+  0x2F8B1,0x2F8B2,0x2F8B3,0x2F8B4,0x2F8B5,0x2F8B6,0x2F8B7,0x2F8B8,
+  0x2F8B9,0x2F8BA,0x2F8BB,0x2F8BC,0x2F8BD,0x2F8BE,0x2F8BF,0x2F8C0,
+  0x2F8C1,0x2F8C2,0x2F8C3,0x2F8C4,0x2F8C5,0x2F8C6,0x2F8C7,0x2F8C8,
+  0x2F8C9,0x2F8CA,0x2F8CB,0x2F8CC,0x2F8CD,0x2F8CE,0x2F8CF,0x2F8D0,
+  0x2F8D1,0x2F8D2,0x2F8D3,0x2F8D4,0x2F8D5,0x2F8D6,0x2F8D7,0x2F8D8,
+  0x2F8D9,0x2F8DA,0x2F8DB,0x2F8DC,0x2F8DD,0x2F8DE,0x2F8DF,0x2F8E0,
+  0x2F8E1,0x2F8E2,0x2F8E3,0x2F8E4,0x2F8E5,0x2F8E6,0x2F8E7,0x2F8E8,
+  0x2F8E9,0x2F8EA,0x2F8EB,0x2F8EC,0x2F8ED,0x2F8EE,0x2F8EF,0x2F8F0,
+  0x2F8F1,0x2F8F2,0x2F8F3,0x2F8F4,0x2F8F5,0x2F8F6,0x2F8F7,0x2F8F8,
+  0x2F8F9,0x2F8FA,0x2F8FB,0x2F8FC,0x2F8FD,0x2F8FE,0x2F8FF,0x2F900,
+  0x2F901,0x2F902,0x2F903,0x2F904,0x2F905,0x2F906,0x2F907,0x2F908,
+  0x2F909,0x2F90A,0x2F90B,0x2F90C,0x2F90D,0x2F90E,0x2F90F,0x2F910,
+  0x2F911,0x2F912,0x2F913,0x2F914,0x2F915,0x2F916,0x2F917,0x2F918,
+  0x2F919,0x2F91A,0x2F91B,0x2F91C,0x2F91D,0x2F91E,0x2F91F,0x2F920,
+  0x2F921,0x2F922,0x2F923,0x2F924,0x2F925,0x2F926,0x2F927,0x2F928,
+  0x2F929,0x2F92A,0x2F92B,0x2F92C,0x2F92D,0x2F92E,0x2F92F,0x2F930,
+  0x2F931,0x2F932,0x2F933,0x2F934,0x2F935,0x2F936,0x2F937,0x2F938,
+  0x2F939,0x2F93A,0x2F93B,0x2F93C,0x2F93D,0x2F93E,0x2F93F,0x2F940,
+  0x2F941,0x2F942,0x2F943,0x2F944,0x2F945,0x2F946,0x2F947,0x2F948,
+  0x2F949,0x2F94A,0x2F94B,0x2F94C,0x2F94D,0x2F94E,0x2F94F,0x2F950,
+  0x2F951,0x2F952,0x2F953,0x2F954,0x2F955,0x2F956,0x2F957,0x2F958,
+  0x2F959,0x2F95A,0x2F95B,0x2F95C,0x2F95D,0x2F95E,0x2F95F,0x2F960,
+  0x2F961,0x2F962,0x2F963,0x2F964,0x2F965,0x2F966,0x2F967,0x2F968,
+  0x2F969,0x2F96A,0x2F96B,0x2F96C,0x2F96D,0x2F96E,0x2F96F,0x2F970,
+  0x2F971,0x2F972,0x2F973,0x2F974,0x2F975,0x2F976,0x2F977,0x2F978,
+  0x2F979,0x2F97A,0x2F97B,0x2F97C,0x2F97D,0x2F97E,0x2F97F,0x2F980,
+  0x2F981,0x2F982,0x2F983,0x2F984,0x2F985,0x2F986,0x2F987,0x2F988,
+  0x2F989,0x2F98A,0x2F98B,0x2F98C,0x2F98D,0x2F98E,0x2F98F,0x2F990,
+  0x2F991,0x2F992,0x2F993,0x2F994,0x2F995,0x2F996,0x2F997,0x2F998,
+  0x2F999,0x2F99A,0x2F99B,0x2F99C,0x2F99D,0x2F99E,0x2F99F,0x2F9A0,
+  0x2F9A1,0x2F9A2,0x2F9A3,0x2F9A4,0x2F9A5,0x2F9A6,0x2F9A7,0x2F9A8,
+  0x2F9A9,0x2F9AA,0x2F9AB,0x2F9AC,0x2F9AD,0x2F9AE,0x2F9AF,0x2F9B0,
+  0x2F9B1,0x2F9B2,0x2F9B3,0x2F9B4,0x2F9B5,0x2F9B6,0x2F9B7,0x2F9B8,
+  0x2F9B9,0x2F9BA,0x2F9BB,0x2F9BC,0x2F9BD,0x2F9BE,0x2F9BF,0x2F9C0,
+  0x2F9C1,0x2F9C2,0x2F9C3,0x2F9C4,0x2F9C5,0x2F9C6,0x2F9C7,0x2F9C8,
+  0x2F9C9,0x2F9CA,0x2F9CB,0x2F9CC,0x2F9CD,0x2F9CE,0x2F9CF,0x2F9D0,
+  0x2F9D1,0x2F9D2,0x2F9D3,0x2F9D4,0x2F9D5,0x2F9D6,0x2F9D7,0x2F9D8,
+  0x2F9D9,0x2F9DA,0x2F9DB,0x2F9DC,0x2F9DD,0x2F9DE,0x2F9DF,0x2F9E0,
+  0x2F9E1,0x2F9E2,0x2F9E3,0x2F9E4,0x2F9E5,0x2F9E6,0x2F9E7,0x2F9E8,
+  0x2F9E9,0x2F9EA,0x2F9EB,0x2F9EC,0x2F9ED,0x2F9EE,0x2F9EF,0x2F9F0,
+  0x2F9F1,0x2F9F2,0x2F9F3,0x2F9F4,0x2F9F5,0x2F9F6,0x2F9F7,0x2F9F8,
+  0x2F9F9,0x2F9FA,0x2F9FB,0x2F9FC,0x2F9FD,0x2F9FE,0x2F9FF,0x2FA00,
+  0x2FA01,0x2FA02,0x2FA03,0x2FA04,0x2FA05,0x2FA06,0x2FA07,0x2FA08,
+  0x2FA09,0x2FA0A,0x2FA0B,0x2FA0C,0x2FA0D,0x2FA0E,0x2FA0F,0x2FA10,
+  0x2FA11,0x2FA12,0x2FA13,0x2FA14,0x2FA15,0x2FA16,0x2FA17,0x2FA18,
+  0x2FA19,0x2FA1A,0x2FA1B,0x2FA1C,0x2FA1D,
+};
+
+/// The offsets of full decompositions of `decomposition_keys` in `decompositions`.
+constexpr std::uint16_t decomposition_offsets[2061 + 1] = {
+  0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,
+  32,34,36,38,40,42,44,46,48,50,52,54,56,58,60,62,
+  64,66,68,70,72,74,76,78,80,82,84,86,88,90,92,94,
+  96,98,100,102,104,106,108,110,112,114,116,118,120,122,124,126,
+  128,130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,
+  160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,
+  192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,
+  224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,
+  256,258,260,262,264,266,268,270,272,274,276,278,280,282,284,286,
+  288,290,292,294,296,298,300,302,304,306,308,310,312,314,316,318,
+  320,322,324,326,328,330,332,334,336,338,340,342,344,346,349,352,
+  355,358,361,364,367,370,373,376,379,382,384,386,388,390,392,394,
+  396,398,401,404,406,408,410,412,414,416,418,421,424,426,428,430,
+  432,434,436,438,440,442,444,446,448,450,452,454,456,458,460,462,
+  464,466,468,470,472,474,476,478,480,482,484,486,488,490,492,494,
+  496,498,500,503,506,509,512,514,516,519,522,524,526,527,528,529,
+  531,532,533,535,537,538,540,542,544,546,548,550,553,555,557,559,
+  561,563,565,568,570,572,574,576,578,580,582,584,586,588,590,592,
+  594,596,598,600,602,604,606,608,610,612,614,616,618,620,622,624,
+  626,628,630,632,634,636,638,640,642,644,646,648,650,652,654,656,
+  658,660,662,664,666,668,670,672,674,676,678,680,682,684,686,688,
+  690,692,694,696,698,700,702,704,706,708,710,712,714,716,718,720,
+  722,724,726,728,730,732,734,736,738,740,742,744,746,748,750,752,
+  754,756,758,760,762,764,766,768,770,772,774,777,779,781,783,785,
+  787,790,792,794,796,798,800,802,804,806,808,810,812,814,816,818,
+  820,822,824,826,828,830,832,834,836,838,840,842,844,846,848,850,
+  852,854,856,858,860,862,864,866,869,872,874,876,878,880,882,884,
+  886,888,890,892,895,898,901,904,906,908,910,912,915,918,920,922,
+  924,926,928,930,932,934,936,938,940,942,944,946,948,950,953,956,
+  958,960,962,964,966,968,970,972,975,978,980,982,984,986,988,990,
+  992,994,996,998,1000,1002,1004,1006,1008,1010,1012,1014,1017,1020,1023,1026,
+  1029,1032,1035,1038,1040,1042,1044,1046,1048,1050,1052,1054,1057,1060,1062,1064,
+  1066,1068,1070,1072,1075,1078,1081,1084,1087,1090,1092,1094,1096,1098,1100,1102,
+  1104,1106,1108,1110,1112,1114,1116,1118,1121,1124,1127,1130,1132,1134,1136,1138,
+  1140,1142,1144,1146,1148,1150,1152,1154,1156,1158,1160,1162,1164,1166,1168,1170,
+  1172,1174,1176,1178,1180,1182,1184,1186,1188,1190,1192,1194,1196,1198,1200,1203,
+  1206,1209,1212,1215,1218,1221,1224,1227,1230,1233,1236,1239,1242,1245,1248,1251,
+  1254,1257,1260,1262,1264,1266,1268,1270,1272,1275,1278,1281,1284,1287,1290,1293,
+  1296,1299,1302,1304,1306,1308,1310,1312,1314,1316,1318,1321,1324,1327,1330,1333,
+  1336,1339,1342,1345,1348,1351,1354,1357,1360,1363,1366,1369,1372,1375,1378,1380,
+  1382,1384,1386,1389,1392,1395,1398,1401,1404,1407,1410,1413,1416,1418,1420,1422,
+  1424,1426,1428,1430,1432,1434,1436,1439,1442,1445,1448,1451,1454,1456,1458,1461,
+  1464,1467,1470,1473,1476,1478,1480,1483,1486,1489,1492,1494,1496,1499,1502,1505,
+  1508,1510,1512,1515,1518,1521,1524,1527,1530,1532,1534,1537,1540,1543,1546,1549,
+  1552,1554,1556,1559,1562,1565,1568,1571,1574,1576,1578,1581,1584,1587,1590,1593,
+  1596,1598,1600,1603,1606,1609,1612,1614,1616,1619,1622,1625,1628,1630,1632,1635,
+  1638,1641,1644,1647,1650,1652,1655,1658,1661,1663,1665,1668,1671,1674,1677,1680,
+  1683,1685,1687,1690,1693,1696,1699,1702,1705,1707,1709,1711,1713,1715,1717,1719,
+  1721,1723,1725,1727,1729,1731,1733,1736,1739,1743,1747,1751,1755,1759,1763,1766,
+  1769,1773,1777,1781,1785,1789,1793,1796,1799,1803,1807,1811,1815,1819,1823,1826,
+  1829,1833,1837,1841,1845,1849,1853,1856,1859,1863,1867,1871,1875,1879,1883,1886,
+  1889,1893,1897,1901,1905,1909,1913,1915,1917,1920,1922,1925,1927,1930,1932,1934,
+  1936,1938,1940,1941,1943,1946,1948,1951,1953,1956,1958,1960,1962,1964,1966,1968,
+  1970,1972,1974,1976,1979,1982,1984,1987,1989,1991,1993,1995,1997,1999,2001,2003,
+  2005,2008,2011,2013,2015,2017,2020,2022,2024,2026,2028,2030,2032,2034,2035,2038,
+  2040,2043,2045,2048,2050,2052,2054,2056,2058,2059,2060,2061,2062,2063,2065,2067,
+  2069,2071,2073,2075,2077,2079,2081,2083,2085,2087,2089,2091,2093,2095,2097,2099,
+  2101,2103,2105,2107,2109,2111,2113,2115,2117,2119,2121,2123,2125,2127,2129,2131,
+  2133,2135,2137,2139,2141,2143,2145,2147,2149,2151,2153,2154,2155,2157,2159,2161,
+  2163,2165,2167,2169,2171,2173,2175,2177,2179,2181,2183,2185,2187,2189,2191,2193,
+  2195,2197,2199,2201,2203,2205,2207,2209,2211,2213,2215,2217,2219,2221,2223,2225,
+  2227,2229,2231,2233,2235,2237,2239,2241,2243,2245,2247,2249,2251,2253,2255,2257,
+  2259,2261,2263,2265,2267,2269,2271,2273,2274,2275,2276,2277,2278,2279,2280,2281,
+  2282,2283,2284,2285,2286,2287,2288,2289,2290,2291,2292,2293,2294,2295,2296,2297,
+  2298,2299,2300,2301,2302,2303,2304,2305,2306,2307,2308,2309,2310,2311,2312,2313,
+  2314,2315,2316,2317,2318,2319,2320,2321,2322,2323,2324,2325,2326,2327,2328,2329,
+  2330,2331,2332,2333,2334,2335,2336,2337,2338,2339,2340,2341,2342,2343,2344,2345,
+  2346,2347,2348,2349,2350,2351,2352,2353,2354,2355,2356,2357,2358,2359,2360,2361,
+  2362,2363,2364,2365,2366,2367,2368,2369,2370,2371,2372,2373,2374,2375,2376,2377,
+  2378,2379,2380,2381,2382,2383,2384,2385,2386,2387,2388,2389,2390,2391,2392,2393,
+  2394,2395,2396,2397,2398,2399,2400,2401,2402,2403,2404,2405,2406,2407,2408,2409,
+  2410,2411,2412,2413,2414,2415,2416,2417,2418,2419,2420,2421,2422,2423,2424,2425,
+  2426,2427,2428,2429,2430,2431,2432,2433,2434,2435,2436,2437,2438,2439,2440,2441,
+  2442,2443,2444,2445,2446,2447,2448,2449,2450,2451,2452,2453,2454,2455,2456,2457,
+  2458,2459,2460,2461,2462,2463,2464,2465,2466,2467,2468,2469,2470,2471,2472,2473,
+  2474,2475,2476,2477,2478,2479,2480,2481,2482,2483,2484,2485,2486,2487,2488,2489,
+  2490,2491,2492,2493,2494,2495,2496,2497,2498,2499,2500,2501,2502,2503,2504,2505,
+  2506,2507,2508,2509,2510,2511,2512,2513,2514,2515,2516,2517,2518,2519,2520,2521,
+  2522,2523,2524,2525,2526,2527,2528,2529,2530,2531,2532,2533,2534,2535,2536,2537,
+  2538,2539,2540,2541,2542,2543,2544,2545,2546,2547,2548,2549,2550,2551,2552,2553,
+  2554,2555,2556,2557,2558,2559,2560,2561,2562,2563,2564,2565,2566,2567,2568,2569,
+  2570,2571,2572,2573,2574,2575,2576,2577,2578,2579,2580,2581,2582,2583,2584,2585,
+  2586,2587,2588,2589,2590,2591,2592,2593,2594,2595,2596,2597,2598,2599,2600,2601,
+  2602,2603,2604,2605,2606,2607,2608,2609,2610,2611,2612,2613,2614,2615,2616,2617,
+  2618,2619,2620,2621,2622,2623,2624,2625,2626,2627,2628,2629,2630,2631,2632,2633,
+  2634,2635,2636,2637,2638,2639,2640,2641,2642,2643,2644,2645,2646,2647,2648,2649,
+  2650,2651,2652,2653,2654,2655,2656,2657,2658,2659,2660,2661,2662,2663,2664,2665,
+  2666,2667,2668,2669,2670,2671,2672,2673,2674,2675,2676,2677,2678,2679,2680,2681,
+  2682,2683,2684,2685,2686,2687,2688,2689,2690,2691,2692,2693,2694,2695,2696,2697,
+  2698,2699,2700,2701,2702,2703,2704,2705,2706,2707,2708,2709,2710,2711,2712,2713,
+  2714,2715,2716,2717,2718,2719,2720,2721,2722,2723,2724,2725,2726,2727,2728,2729,
+  2730,2731,2732,2733,2735,2737,2739,2741,2744,2747,2749,2751,2753,2755,2757,2759,
+  2761,2763,2765,2767,2769,2771,2773,2775,2777,2779,2781,2783,2785,2787,2789,2791,
+  2793,2795,2797,2799,2801,2803,2805,2807,2809,2811,2813,2815,2817,2819,2821,2823,
+  2825,2827,2829,2831,2833,2836,2839,2842,2845,2848,2850,2852,2855,2858,2861,2864,
+  2865,2866,2867,2868,2869,2870,2871,2872,2873,2874,2875,2876,2877,2878,2879,2880,
+  2881,2882,2883,2884,2885,2886,2887,2888,2889,2890,2891,2892,2893,2894,2895,2896,
+  2897,2898,2899,2900,2901,2902,2903,2904,2905,2906,2907,2908,2909,2910,2911,2912,
+  2913,2914,2915,2916,2917,2918,2919,2920,2921,2922,2923,2924,2925,2926,2927,2928,
+  2929,2930,2931,2932,2933,2934,2935,2936,2937,2938,2939,2940,2941,2942,2943,2944,
+  2945,2946,2947,2948,2949,2950,2951,2952,2953,2954,2955,2956,2957,2958,2959,2960,
+  2961,2962,2963,2964,2965,2966,2967,2968,2969,2970,2971,2972,2973,2974,2975,2976,
+  2977,2978,2979,2980,2981,2982,2983,2984,2985,2986,2987,2988,2989,2990,2991,2992,
+  2993,2994,2995,2996,2997,2998,2999,3000,3001,3002,3003,3004,3005,3006,3007,3008,
+  3009,3010,3011,3012,3013,3014,3015,3016,3017,3018,3019,3020,3021,3022,3023,3024,
+  3025,3026,3027,3028,3029,3030,3031,3032,3033,3034,3035,3036,3037,3038,3039,3040,
+  3041,3042,3043,3044,3045,3046,3047,3048,3049,3050,3051,3052,3053,3054,3055,3056,
+  3057,3058,3059,3060,3061,3062,3063,3064,3065,3066,3067,3068,3069,3070,3071,3072,
+  3073,3074,3075,3076,3077,3078,3079,3080,3081,3082,3083,3084,3085,3086,3087,3088,
+  3089,3090,3091,3092,3093,3094,3095,3096,3097,3098,3099,3100,3101,3102,3103,3104,
+  3105,3106,3107,3108,3109,3110,3111,3112,3113,3114,3115,3116,3117,3118,3119,3120,
+  3121,3122,3123,3124,3125,3126,3127,3128,3129,3130,3131,3132,3133,3134,3135,3136,
+  3137,3138,3139,3140,3141,3142,3143,3144,3145,3146,3147,3148,3149,3150,3151,3152,
+  3153,3154,3155,3156,3157,3158,3159,3160,3161,3162,3163,3164,3165,3166,3167,3168,
+  3169,3170,3171,3172,3173,3174,3175,3176,3177,3178,3179,3180,3181,3182,3183,3184,
+  3185,3186,3187,3188,3189,3190,3191,3192,3193,3194,3195,3196,3197,3198,3199,3200,
+  3201,3202,3203,3204,3205,3206,3207,3208,3209,3210,3211,3212,3213,3214,3215,3216,
+  3217,3218,3219,3220,3221,3222,3223,3224,3225,3226,3227,3228,3229,3230,3231,3232,
+  3233,3234,3235,3236,3237,3238,3239,3240,3241,3242,3243,3244,3245,3246,3247,3248,
+  3249,3250,3251,3252,3253,3254,3255,3256,3257,3258,3259,3260,3261,3262,3263,3264,
+  3265,3266,3267,3268,3269,3270,3271,3272,3273,3274,3275,3276,3277,3278,3279,3280,
+  3281,3282,3283,3284,3285,3286,3287,3288,3289,3290,3291,3292,3293,3294,3295,3296,
+  3297,3298,3299,3300,3301,3302,3303,3304,3305,3306,3307,3308,3309,3310,3311,3312,
+  3313,3314,3315,3316,3317,3318,3319,3320,3321,3322,3323,3324,3325,3326,3327,3328,
+  3329,3330,3331,3332,3333,3334,3335,3336,3337,3338,3339,3340,3341,3342,3343,3344,
+  3345,3346,3347,3348,3349,3350,3351,3352,3353,3354,3355,3356,3357,3358,3359,3360,
+  3361,3362,3363,3364,3365,3366,3367,3368,3369,3370,3371,3372,3373,3374,3375,3376,
+  3377,3378,3379,3380,3381,3382,3383,3384,3385,3386,3387,3388,3389,3390,3391,3392,
+  3393,3394,3395,3396,3397,3398,3399,3400,3401,3402,3403,3404,3405,3406,
+};
+
+constexpr char32_t decompositions[3406] = {
+  0x0041,0x0300,0x0041,0x0301,0x0041,0x0302,0x0041,0x0303,
+  0x0041,0x0308,0x0041,0x030A,0x0043,0x0327,0x0045,0x0300,
+  0x0045,0x0301,0x0045,0x0302,0x0045,0x0308,0x0049,0x0300,
+  0x0049,0x0301,0x0049,0x0302,0x0049,0x0308,0x004E,0x0303,
+  0x004F,0x0300,0x004F,0x0301,0x004F,0x0302,0x004F,0x0303,
+  0x004F,0x0308,0x0055,0x0300,0x0055,0x0301,0x0055,0x0302,
+  0x0055,0x0308,0x0059,0x0301,0x0061,0x0300,0x0061,0x0301,
+  0x0061,0x0302,0x0061,0x0303,0x0061,0x0308,0x0061,0x030A,
+  0x0063,0x0327,0x0065,0x0300,0x0065,0x0301,0x0065,0x0302,
+  0x0065,0x0308,0x0069,0x0300,0x0069,0x0301,0x0069,0x0302,
+  0x0069,0x0308,0x006E,0x0303,0x006F,0x0300,0x006F,0x0301,
+  0x006F,0x0302,0x006F,0x0303,0x006F,0x0308,0x0075,0x0300,
+  0x0075,0x0301,0x0075,0x0302,0x0075,0x0308,0x0079,0x0301,
+  0x0079,0x0308,0x0041,0x0304,0x0061,0x0304,0x0041,0x0306,
+  0x0061,0x0306,0x0041,0x0328,0x0061,0x0328,0x0043,0x0301,
+  0x0063,0x0301,0x0043,0x0302,0x0063,0x0302,0x0043,0x0307,
+  0x0063,0x0307,0x0043,0x030C,0x0063,0x030C,0x0044,0x030C,
+  0x0064,0x030C,0x0045,0x0304,0x0065,0x0304,0x0045,0x0306,
+  0x0065,0x0306,0x0045,0x0307,0x0065,0x0307,0x0045,0x0328,
+  0x0065,0x0328,0x0045,0x030C,0x0065,0x030C,0x0047,0x0302,
+  0x0067,0x0302,0x0047,0x0306,0x0067,0x0306,0x0047,0x0307,
+  0x0067,0x0307,0x0047,0x0327,0x0067,0x0327,0x0048,0x0302,
+  0x0068,0x0302,0x0049,0x0303,0x0069,0x0303,0x0049,0x0304,
+  0x0069,0x0304,0x0049,0x0306,0x0069,0x0306,0x0049,0x0328,
+  0x0069,0x0328,0x0049,0x0307,0x004A,0x0302,0x006A,0x0302,
+  0x004B,0x0327,0x006B,0x0327,0x004C,0x0301,0x006C,0x0301,
+  0x004C,0x0327,0x006C,0x0327,0x004C,0x030C,0x006C,0x030C,
+  0x004E,0x0301,0x006E,0x0301,0x004E,0x0327,0x006E,0x0327,
+  0x004E,0x030C,0x006E,0x030C,0x004F,0x0304,0x006F,0x0304,
+  0x004F,0x0306,0x006F,0x0306,0x004F,0x030B,0x006F,0x030B,
+  0x0052,0x0301,0x0072,0x0301,0x0052,0x0327,0x0072,0x0327,
+  0x0052,0x030C,0x0072,0x030C,0x0053,0x0301,0x0073,0x0301,
+  0x0053,0x0302,0x0073,0x0302,0x0053,0x0327,0x0073,0x0327,
+  0x0053,0x030C,0x0073,0x030C,0x0054,0x0327,0x0074,0x0327,
+  0x0054,0x030C,0x0074,0x030C,0x0055,0x0303,0x0075,0x0303,
+  0x0055,0x0304,0x0075,0x0304,0x0055,0x0306,0x0075,0x0306,
+  0x0055,0x030A,0x0075,0x030A,0x0055,0x030B,0x0075,0x030B,
+  0x0055,0x0328,0x0075,0x0328,0x0057,0x0302,0x0077,0x0302,
+  0x0059,0x0302,0x0079,0x0302,0x0059,0x0308,0x005A,0x0301,
+  0x007A,0x0301,0x005A,0x0307,0x007A,0x0307,0x005A,0x030C,
+  0x007A,0x030C,0x004F,0x031B,0x006F,0x031B,0x0055,0x031B,
+  0x0075,0x031B,0x0041,0x030C,0x0061,0x030C,0x0049,0x030C,
+  0x0069,0x030C,0x004F,0x030C,0x006F,0x030C,0x0055,0x030C,
+  0x0075,0x030C,0x0055,0x0308,0x0304,0x0075,0x0308,0x0304,
+  0x0055,0x0308,0x0301,0x0075,0x0308,0x0301,0x0055,0x0308,
+  0x030C,0x0075,0x0308,0x030C,0x0055,0x0308,0x0300,0x0075,
+  0x0308,0x0300,0x0041,0x0308,0x0304,0x0061,0x0308,0x0304,
+  0x0041,0x0307,0x0304,0x0061,0x0307,0x0304,0x00C6,0x0304,
+  0x00E6,0x0304,0x0047,0x030C,0x0067,0x030C,0x004B,0x030C,
+  0x006B,0x030C,0x004F,0x0328,0x006F,0x0328,0x004F,0x0328,
+  0x0304,0x006F,0x0328,0x0304,0x01B7,0x030C,0x0292,0x030C,
+  0x006A,0x030C,0x0047,0x0301,0x0067,0x0301,0x004E,0x0300,
+  0x006E,0x0300,0x0041,0x030A,0x0301,0x0061,0x030A,0x0301,
+  0x00C6,0x0301,0x00E6,0x0301,0x00D8,0x0301,0x00F8,0x0301,
+  0x0041,0x030F,0x0061,0x030F,0x0041,0x0311,0x0061,0x0311,
+  0x0045,0x030F,0x0065,0x030F,0x0045,0x0311,0x0065,0x0311,
+  0x0049,0x030F,0x0069,0x030F,0x0049,0x0311,0x0069,0x0311,
+  0x004F,0x030F,0x006F,0x030F,0x004F,0x0311,0x006F,0x0311,
+  0x0052,0x030F,0x0072,0x030F,0x0052,0x0311,0x0072,0x0311,
+  0x0055,0x030F,0x0075,0x030F,0x0055,0x0311,0x0075,0x0311,
+  0x0053,0x0326,0x0073,0x0326,0x0054,0x0326,0x0074,0x0326,
+  0x0048,0x030C,0x0068,0x030C,0x0041,0x0307,0x0061,0x0307,
+  0x0045,0x0327,0x0065,0x0327,0x004F,0x0308,0x0304,0x006F,
+  0x0308,0x0304,0x004F,0x0303,0x0304,0x006F,0x0303,0x0304,
+  0x004F,0x0307,0x006F,0x0307,0x004F,0x0307,0x0304,0x006F,
+  0x0307,0x0304,0x0059,0x0304,0x0079,0x0304,0x0300,0x0301,
+  0x0313,0x0308,0x0301,0x02B9,0x003B,0x00A8,0x0301,0x0391,
+  0x0301,0x00B7,0x0395,0x0301,0x0397,0x0301,0x0399,0x0301,
+  0x039F,0x0301,0x03A5,0x0301,0x03A9,0x0301,0x03B9,0x0308,
+  0x0301,0x0399,0x0308,0x03A5,0x0308,0x03B1,0x0301,0x03B5,
+  0x0301,0x03B7,0x0301,0x03B9,0x0301,0x03C5,0x0308,0x0301,
+  0x03B9,0x0308,0x03C5,0x0308,0x03BF,0x0301,0x03C5,0x0301,
+  0x03C9,0x0301,0x03D2,0x0301,0x03D2,0x0308,0x0415,0x0300,
+  0x0415,0x0308,0x0413,0x0301,0x0406,0x0308,0x041A,0x0301,
+  0x0418,0x0300,0x0423,0x0306,0x0418,0x0306,0x0438,0x0306,
+  0x0435,0x0300,0x0435,0x0308,0x0433,0x0301,0x0456,0x0308,
+  0x043A,0x0301,0x0438,0x0300,0x0443,0x0306,0x0474,0x030F,
+  0x0475,0x030F,0x0416,0x0306,0x0436,0x0306,0x0410,0x0306,
+  0x0430,0x0306,0x0410,0x0308,0x0430,0x0308,0x0415,0x0306,
+  0x0435,0x0306,0x04D8,0x0308,0x04D9,0x0308,0x0416,0x0308,
+  0x0436,0x0308,0x0417,0x0308,0x0437,0x0308,0x0418,0x0304,
+  0x0438,0x0304,0x0418,0x0308,0x0438,0x0308,0x041E,0x0308,
+  0x043E,0x0308,0x04E8,0x0308,0x04E9,0x0308,0x042D,0x0308,
+  0x044D,0x0308,0x0423,0x0304,0x0443,0x0304,0x0423,0x0308,
+  0x0443,0x0308,0x0423,0x030B,0x0443,0x030B,0x0427,0x0308,
+  0x0447,0x0308,0x042B,0x0308,0x044B,0x0308,0x0627,0x0653,
+  0x0627,0x0654,0x0648,0x0654,0x0627,0x0655,0x064A,0x0654,
+  0x06D5,0x0654,0x06C1,0x0654,0x06D2,0x0654,0x0928,0x093C,
+  0x0930,0x093C,0x0933,0x093C,0x0915,0x093C,0x0916,0x093C,
+  0x0917,0x093C,0x091C,0x093C,0x0921,0x093C,0x0922,0x093C,
+  0x092B,0x093C,0x092F,0x093C,0x09C7,0x09BE,0x09C7,0x09D7,
+  0x09A1,0x09BC,0x09A2,0x09BC,0x09AF,0x09BC,0x0A32,0x0A3C,
+  0x0A38,0x0A3C,0x0A16,0x0A3C,0x0A17,0x0A3C,0x0A1C,0x0A3C,
+  0x0A2B,0x0A3C,0x0B47,0x0B56,0x0B47,0x0B3E,0x0B47,0x0B57,
+  0x0B21,0x0B3C,0x0B22,0x0B3C,0x0B92,0x0BD7,0x0BC6,0x0BBE,
+  0x0BC7,0x0BBE,0x0BC6,0x0BD7,0x0C46,0x0C56,0x0CBF,0x0CD5,
+  0x0CC6,0x0CD5,0x0CC6,0x0CD6,0x0CC6,0x0CC2,0x0CC6,0x0CC2,
+  0x0CD5,0x0D46,0x0D3E,0x0D47,0x0D3E,0x0D46,0x0D57,0x0DD9,
+  0x0DCA,0x0DD9,0x0DCF,0x0DD9,0x0DCF,0x0DCA,0x0DD9,0x0DDF,
+  0x0F42,0x0FB7,0x0F4C,0x0FB7,0x0F51,0x0FB7,0x0F56,0x0FB7,
+  0x0F5B,0x0FB7,0x0F40,0x0FB5,0x0F71,0x0F72,0x0F71,0x0F74,
+  0x0FB2,0x0F80,0x0FB3,0x0F80,0x0F71,0x0F80,0x0F92,0x0FB7,
+  0x0F9C,0x0FB7,0x0FA1,0x0FB7,0x0FA6,0x0FB7,0x0FAB,0x0FB7,
+  0x0F90,0x0FB5,0x1025,0x102E,0x1B05,0x1B35,0x1B07,0x1B35,
+  0x1B09,0x1B35,0x1B0B,0x1B35,0x1B0D,0x1B35,0x1B11,0x1B35,
+  0x1B3A,0x1B35,0x1B3C,0x1B35,0x1B3E,0x1B35,0x1B3F,0x1B35,
+  0x1B42,0x1B35,0x0041,0x0325,0x0061,0x0325,0x0042,0x0307,
+  0x0062,0x0307,0x0042,0x0323,0x0062,0x0323,0x0042,0x0331,
+  0x0062,0x0331,0x0043,0x0327,0x0301,0x0063,0x0327,0x0301,
+  0x0044,0x0307,0x0064,0x0307,0x0044,0x0323,0x0064,0x0323,
+  0x0044,0x0331,0x0064,0x0331,0x0044,0x0327,0x0064,0x0327,
+  0x0044,0x032D,0x0064,0x032D,0x0045,0x0304,0x0300,0x0065,
+  0x0304,0x0300,0x0045,0x0304,0x0301,0x0065,0x0304,0x0301,
+  0x0045,0x032D,0x0065,0x032D,0x0045,0x0330,0x0065,0x0330,
+  0x0045,0x0327,0x0306,0x0065,0x0327,0x0306,0x0046,0x0307,
+  0x0066,0x0307,0x0047,0x0304,0x0067,0x0304,0x0048,0x0307,
+  0x0068,0x0307,0x0048,0x0323,0x0068,0x0323,0x0048,0x0308,
+  0x0068,0x0308,0x0048,0x0327,0x0068,0x0327,0x0048,0x032E,
+  0x0068,0x032E,0x0049,0x0330,0x0069,0x0330,0x0049,0x0308,
+  0x0301,0x0069,0x0308,0x0301,0x004B,0x0301,0x006B,0x0301,
+  0x004B,0x0323,0x006B,0x0323,0x004B,0x0331,0x006B,0x0331,
+  0x004C,0x0323,0x006C,0x0323,0x004C,0x0323,0x0304,0x006C,
+  0x0323,0x0304,0x004C,0x0331,0x006C,0x0331,0x004C,0x032D,
+  0x006C,0x032D,0x004D,0x0301,0x006D,0x0301,0x004D,0x0307,
+  0x006D,0x0307,0x004D,0x0323,0x006D,0x0323,0x004E,0x0307,
+  0x006E,0x0307,0x004E,0x0323,0x006E,0x0323,0x004E,0x0331,
+  0x006E,0x0331,0x004E,0x032D,0x006E,0x032D,0x004F,0x0303,
+  0x0301,0x006F,0x0303,0x0301,0x004F,0x0303,0x0308,0x006F,
+  0x0303,0x0308,0x004F,0x0304,0x0300,0x006F,0x0304,0x0300,
+  0x004F,0x0304,0x0301,0x006F,0x0304,0x0301,0x0050,0x0301,
+  0x0070,0x0301,0x0050,0x0307,0x0070,0x0307,0x0052,0x0307,
+  0x0072,0x0307,0x0052,0x0323,0x0072,0x0323,0x0052,0x0323,
+  0x0304,0x0072,0x0323,0x0304,0x0052,0x0331,0x0072,0x0331,
+  0x0053,0x0307,0x0073,0x0307,0x0053,0x0323,0x0073,0x0323,
+  0x0053,0x0301,0x0307,0x0073,0x0301,0x0307,0x0053,0x030C,
+  0x0307,0x0073,0x030C,0x0307,0x0053,0x0323,0x0307,0x0073,
+  0x0323,0x0307,0x0054,0x0307,0x0074,0x0307,0x0054,0x0323,
+  0x0074,0x0323,0x0054,0x0331,0x0074,0x0331,0x0054,0x032D,
+  0x0074,0x032D,0x0055,0x0324,0x0075,0x0324,0x0055,0x0330,
+  0x0075,0x0330,0x0055,0x032D,0x0075,0x032D,0x0055,0x0303,
+  0x0301,0x0075,0x0303,0x0301,0x0055,0x0304,0x0308,0x0075,
+  0x0304,0x0308,0x0056,0x0303,0x0076,0x0303,0x0056,0x0323,
+  0x0076,0x0323,0x0057,0x0300,0x0077,0x0300,0x0057,0x0301,
+  0x0077,0x0301,0x0057,0x0308,0x0077,0x0308,0x0057,0x0307,
+  0x0077,0x0307,0x0057,0x0323,0x0077,0x0323,0x0058,0x0307,
+  0x0078,0x0307,0x0058,0x0308,0x0078,0x0308,0x0059,0x0307,
+  0x0079,0x0307,0x005A,0x0302,0x007A,0x0302,0x005A,0x0323,
+  0x007A,0x0323,0x005A,0x0331,0x007A,0x0331,0x0068,0x0331,
+  0x0074,0x0308,0x0077,0x030A,0x0079,0x030A,0x017F,0x0307,
+  0x0041,0x0323,0x0061,0x0323,0x0041,0x0309,0x0061,0x0309,
+  0x0041,0x0302,0x0301,0x0061,0x0302,0x0301,0x0041,0x0302,
+  0x0300,0x0061,0x0302,0x0300,0x0041,0x0302,0x0309,0x0061,
+  0x0302,0x0309,0x0041,0x0302,0x0303,0x0061,0x0302,0x0303,
+  0x0041,0x0323,0x0302,0x0061,0x0323,0x0302,0x0041,0x0306,
+  0x0301,0x0061,0x0306,0x0301,0x0041,0x0306,0x0300,0x0061,
+  0x0306,0x0300,0x0041,0x0306,0x0309,0x0061,0x0306,0x0309,
+  0x0041,0x0306,0x0303,0x0061,0x0306,0x0303,0x0041,0x0323,
+  0x0306,0x0061,0x0323,0x0306,0x0045,0x0323,0x0065,0x0323,
+  0x0045,0x0309,0x0065,0x0309,0x0045,0x0303,0x0065,0x0303,
+  0x0045,0x0302,0x0301,0x0065,0x0302,0x0301,0x0045,0x0302,
+  0x0300,0x0065,0x0302,0x0300,0x0045,0x0302,0x0309,0x0065,
+  0x0302,0x0309,0x0045,0x0302,0x0303,0x0065,0x0302,0x0303,
+  0x0045,0x0323,0x0302,0x0065,0x0323,0x0302,0x0049,0x0309,
+  0x0069,0x0309,0x0049,0x0323,0x0069,0x0323,0x004F,0x0323,
+  0x006F,0x0323,0x004F,0x0309,0x006F,0x0309,0x004F,0x0302,
+  0x0301,0x006F,0x0302,0x0301,0x004F,0x0302,0x0300,0x006F,
+  0x0302,0x0300,0x004F,0x0302,0x0309,0x006F,0x0302,0x0309,
+  0x004F,0x0302,0x0303,0x006F,0x0302,0x0303,0x004F,0x0323,
+  0x0302,0x006F,0x0323,0x0302,0x004F,0x031B,0x0301,0x006F,
+  0x031B,0x0301,0x004F,0x031B,0x0300,0x006F,0x031B,0x0300,
+  0x004F,0x031B,0x0309,0x006F,0x031B,0x0309,0x004F,0x031B,
+  0x0303,0x006F,0x031B,0x0303,0x004F,0x031B,0x0323,0x006F,
+  0x031B,0x0323,0x0055,0x0323,0x0075,0x0323,0x0055,0x0309,
+  0x0075,0x0309,0x0055,0x031B,0x0301,0x0075,0x031B,0x0301,
+  0x0055,0x031B,0x0300,0x0075,0x031B,0x0300,0x0055,0x031B,
+  0x0309,0x0075,0x031B,0x0309,0x0055,0x031B,0x0303,0x0075,
+  0x031B,0x0303,0x0055,0x031B,0x0323,0x0075,0x031B,0x0323,
+  0x0059,0x0300,0x0079,0x0300,0x0059,0x0323,0x0079,0x0323,
+  0x0059,0x0309,0x0079,0x0309,0x0059,0x0303,0x0079,0x0303,
+  0x03B1,0x0313,0x03B1,0x0314,0x03B1,0x0313,0x0300,0x03B1,
+  0x0314,0x0300,0x03B1,0x0313,0x0301,0x03B1,0x0314,0x0301,
+  0x03B1,0x0313,0x0342,0x03B1,0x0314,0x0342,0x0391,0x0313,
+  0x0391,0x0314,0x0391,0x0313,0x0300,0x0391,0x0314,0x0300,
+  0x0391,0x0313,0x0301,0x0391,0x0314,0x0301,0x0391,0x0313,
+  0x0342,0x0391,0x0314,0x0342,0x03B5,0x0313,0x03B5,0x0314,
+  0x03B5,0x0313,0x0300,0x03B5,0x0314,0x0300,0x03B5,0x0313,
+  0x0301,0x03B5,0x0314,0x0301,0x0395,0x0313,0x0395,0x0314,
+  0x0395,0x0313,0x0300,0x0395,0x0314,0x0300,0x0395,0x0313,
+  0x0301,0x0395,0x0314,0x0301,0x03B7,0x0313,0x03B7,0x0314,
+  0x03B7,0x0313,0x0300,0x03B7,0x0314,0x0300,0x03B7,0x0313,
+  0x0301,0x03B7,0x0314,0x0301,0x03B7,0x0313,0x0342,0x03B7,
+  0x0314,0x0342,0x0397,0x0313,0x0397,0x0314,0x0397,0x0313,
+  0x0300,0x0397,0x0314,0x0300,0x0397,0x0313,0x0301,0x0397,
+  0x0314,0x0301,0x0397,0x0313,0x0342,0x0397,0x0314,0x0342,
+  0x03B9,0x0313,0x03B9,0x0314,0x03B9,0x0313,0x0300,0x03B9,
+  0x0314,0x0300,0x03B9,0x0313,0x0301,0x03B9,0x0314,0x0301,
+  0x03B9,0x0313,0x0342,0x03B9,0x0314,0x0342,0x0399,0x0313,
+  0x0399,0x0314,0x0399,0x0313,0x0300,0x0399,0x0314,0x0300,
+  0x0399,0x0313,0x0301,0x0399,0x0314,0x0301,0x0399,0x0313,
+  0x0342,0x0399,0x0314,0x0342,0x03BF,0x0313,0x03BF,0x0314,
+  0x03BF,0x0313,0x0300,0x03BF,0x0314,0x0300,0x03BF,0x0313,
+  0x0301,0x03BF,0x0314,0x0301,0x039F,0x0313,0x039F,0x0314,
+  0x039F,0x0313,0x0300,0x039F,0x0314,0x0300,0x039F,0x0313,
+  0x0301,0x039F,0x0314,0x0301,0x03C5,0x0313,0x03C5,0x0314,
+  0x03C5,0x0313,0x0300,0x03C5,0x0314,0x0300,0x03C5,0x0313,
+  0x0301,0x03C5,0x0314,0x0301,0x03C5,0x0313,0x0342,0x03C5,
+  0x0314,0x0342,0x03A5,0x0314,0x03A5,0x0314,0x0300,0x03A5,
+  0x0314,0x0301,0x03A5,0x0314,0x0342,0x03C9,0x0313,0x03C9,
+  0x0314,0x03C9,0x0313,0x0300,0x03C9,0x0314,0x0300,0x03C9,
+  0x0313,0x0301,0x03C9,0x0314,0x0301,0x03C9,0x0313,0x0342,
+  0x03C9,0x0314,0x0342,0x03A9,0x0313,0x03A9,0x0314,0x03A9,
+  0x0313,0x0300,0x03A9,0x0314,0x0300,0x03A9,0x0313,0x0301,
+  0x03A9,0x0314,0x0301,0x03A9,0x0313,0x0342,0x03A9,0x0314,
+  0x0342,0x03B1,0x0300,0x03B1,0x0301,0x03B5,0x0300,0x03B5,
+  0x0301,0x03B7,0x0300,0x03B7,0x0301,0x03B9,0x0300,0x03B9,
+  0x0301,0x03BF,0x0300,0x03BF,0x0301,0x03C5,0x0300,0x03C5,
+  0x0301,0x03C9,0x0300,0x03C9,0x0301,0x03B1,0x0313,0x0345,
+  0x03B1,0x0314,0x0345,0x03B1,0x0313,0x0300,0x0345,0x03B1,
+  0x0314,0x0300,0x0345,0x03B1,0x0313,0x0301,0x0345,0x03B1,
+  0x0314,0x0301,0x0345,0x03B1,0x0313,0x0342,0x0345,0x03B1,
+  0x0314,0x0342,0x0345,0x0391,0x0313,0x0345,0x0391,0x0314,
+  0x0345,0x0391,0x0313,0x0300,0x0345,0x0391,0x0314,0x0300,
+  0x0345,0x0391,0x0313,0x0301,0x0345,0x0391,0x0314,0x0301,
+  0x0345,0x0391,0x0313,0x0342,0x0345,0x0391,0x0314,0x0342,
+  0x0345,0x03B7,0x0313,0x0345,0x03B7,0x0314,0x0345,0x03B7,
+  0x0313,0x0300,0x0345,0x03B7,0x0314,0x0300,0x0345,0x03B7,
+  0x0313,0x0301,0x0345,0x03B7,0x0314,0x0301,0x0345,0x03B7,
+  0x0313,0x0342,0x0345,0x03B7,0x0314,0x0342,0x0345,0x0397,
+  0x0313,0x0345,0x0397,0x0314,0x0345,0x0397,0x0313,0x0300,
+  0x0345,0x0397,0x0314,0x0300,0x0345,0x0397,0x0313,0x0301,
+  0x0345,0x0397,0x0314,0x0301,0x0345,0x0397,0x0313,0x0342,
+  0x0345,0x0397,0x0314,0x0342,0x0345,0x03C9,0x0313,0x0345,
+  0x03C9,0x0314,0x0345,0x03C9,0x0313,0x0300,0x0345,0x03C9,
+  0x0314,0x0300,0x0345,0x03C9,0x0313,0x0301,0x0345,0x03C9,
+  0x0314,0x0301,0x0345,0x03C9,0x0313,0x0342,0x0345,0x03C9,
+  0x0314,0x0342,0x0345,0x03A9,0x0313,0x0345,0x03A9,0x0314,
+  0x0345,0x03A9,0x0313,0x0300,0x0345,0x03A9,0x0314,0x0300,
+  0x0345,0x03A9,0x0313,0x0301,0x0345,0x03A9,0x0314,0x0301,
+  0x0345,0x03A9,0x0313,0x0342,0x0345,0x03A9,0x0314,0x0342,
+  0x0345,0x03B1,0x0306,0x03B1,0x0304,0x03B1,0x0300,0x0345,
+  0x03B1,0x0345,0x03B1,0x0301,0x0345,0x03B1,0x0342,0x03B1,
+  0x0342,0x0345,0x0391,0x0306,0x0391,0x0304,0x0391,0x0300,
+  0x0391,0x0301,0x0391,0x0345,0x03B9,0x00A8,0x0342,0x03B7,
+  0x0300,0x0345,0x03B7,0x0345,0x03B7,0x0301,0x0345,0x03B7,
+  0x0342,0x03B7,0x0342,0x0345,0x0395,0x0300,0x0395,0x0301,
+  0x0397,0x0300,0x0397,0x0301,0x0397,0x0345,0x1FBF,0x0300,
+  0x1FBF,0x0301,0x1FBF,0x0342,0x03B9,0x0306,0x03B9,0x0304,
+  0x03B9,0x0308,0x0300,0x03B9,0x0308,0x0301,0x03B9,0x0342,
+  0x03B9,0x0308,0x0342,0x0399,0x0306,0x0399,0x0304,0x0399,
+  0x0300,0x0399,0x0301,0x1FFE,0x0300,0x1FFE,0x0301,0x1FFE,
+  0x0342,0x03C5,0x0306,0x03C5,0x0304,0x03C5,0x0308,0x0300,
+  0x03C5,0x0308,0x0301,0x03C1,0x0313,0x03C1,0x0314,0x03C5,
+  0x0342,0x03C5,0x0308,0x0342,0x03A5,0x0306,0x03A5,0x0304,
+  0x03A5,0x0300,0x03A5,0x0301,0x03A1,0x0314,0x00A8,0x0300,
+  0x00A8,0x0301,0x0060,0x03C9,0x0300,0x0345,0x03C9,0x0345,
+  0x03C9,0x0301,0x0345,0x03C9,0x0342,0x03C9,0x0342,0x0345,
+  0x039F,0x0300,0x039F,0x0301,0x03A9,0x0300,0x03A9,0x0301,
+  0x03A9,0x0345,0x00B4,0x2002,0x2003,0x03A9,0x004B,0x0041,
+  0x030A,0x2190,0x0338,0x2192,0x0338,0x2194,0x0338,0x21D0,
+  0x0338,0x21D4,0x0338,0x21D2,0x0338,0x2203,0x0338,0x2208,
+  0x0338,0x220B,0x0338,0x2223,0x0338,0x2225,0x0338,0x223C,
+  0x0338,0x2243,0x0338,0x2245,0x0338,0x2248,0x0338,0x003D,
+  0x0338,0x2261,0x0338,0x224D,0x0338,0x003C,0x0338,0x003E,
+  0x0338,0x2264,0x0338,0x2265,0x0338,0x2272,0x0338,0x2273,
+  0x0338,0x2276,0x0338,0x2277,0x0338,0x227A,0x0338,0x227B,
+  0x0338,0x2282,0x0338,0x2283,0x0338,0x2286,0x0338,0x2287,
+  0x0338,0x22A2,0x0338,0x22A8,0x0338,0x22A9,0x0338,0x22AB,
+  0x0338,0x227C,0x0338,0x227D,0x0338,0x2291,0x0338,0x2292,
+  0x0338,0x22B2,0x0338,0x22B3,0x0338,0x22B4,0x0338,0x22B5,
+  0x0338,0x3008,0x3009,0x2ADD,0x0338,0x304B,0x3099,0x304D,
+  0x3099,0x304F,0x3099,0x3051,0x3099,0x3053,0x3099,0x3055,
+  0x3099,0x3057,0x3099,0x3059,0x3099,0x305B,0x3099,0x305D,
+  0x3099,0x305F,0x3099,0x3061,0x3099,0x3064,0x3099,0x3066,
+  0x3099,0x3068,0x3099,0x306F,0x3099,0x306F,0x309A,0x3072,
+  0x3099,0x3072,0x309A,0x3075,0x3099,0x3075,0x309A,0x3078,
+  0x3099,0x3078,0x309A,0x307B,0x3099,0x307B,0x309A,0x3046,
+  0x3099,0x309D,0x3099,0x30AB,0x3099,0x30AD,0x3099,0x30AF,
+  0x3099,0x30B1,0x3099,0x30B3,0x3099,0x30B5,0x3099,0x30B7,
+  0x3099,0x30B9,0x3099,0x30BB,0x3099,0x30BD,0x3099,0x30BF,
+  0x3099,0x30C1,0x3099,0x30C4,0x3099,0x30C6,0x3099,0x30C8,
+  0x3099,0x30CF,0x3099,0x30CF,0x309A,0x30D2,0x3099,0x30D2,
+  0x309A,0x30D5,0x3099,0x30D5,0x309A,0x30D8,0x3099,0x30D8,
+  0x309A,0x30DB,0x3099,0x30DB,0x309A,0x30A6,0x3099,0x30EF,
+  0x3099,0x30F0,0x3099,0x30F1,0x3099,0x30F2,0x3099,0x30FD,
+  0x3099,0x8C48,0x66F4,0x8ECA,0x8CC8,0x6ED1,0x4E32,0x53E5,
+  0x9F9C,0x9F9C,0x5951,0x91D1,0x5587,0x5948,0x61F6,0x7669,
+  0x7F85,0x863F,0x87BA,0x88F8,0x908F,0x6A02,0x6D1B,0x70D9,
+  0x73DE,0x843D,0x916A,0x99F1,0x4E82,0x5375,0x6B04,0x721B,
+  0x862D,0x9E1E,0x5D50,0x6FEB,0x85CD,0x8964,0x62C9,0x81D8,
+  0x881F,0x5ECA,0x6717,0x6D6A,0x72FC,0x90CE,0x4F86,0x51B7,
+  0x52DE,0x64C4,0x6AD3,0x7210,0x76E7,0x8001,0x8606,0x865C,
+  0x8DEF,0x9732,0x9B6F,0x9DFA,0x788C,0x797F,0x7DA0,0x83C9,
+  0x9304,0x9E7F,0x8AD6,0x58DF,0x5F04,0x7C60,0x807E,0x7262,
+  0x78CA,0x8CC2,0x96F7,0x58D8,0x5C62,0x6A13,0x6DDA,0x6F0F,
+  0x7D2F,0x7E37,0x964B,0x52D2,0x808B,0x51DC,0x51CC,0x7A1C,
+  0x7DBE,0x83F1,0x9675,0x8B80,0x62CF,0x6A02,0x8AFE,0x4E39,
+  0x5BE7,0x6012,0x7387,0x7570,0x5317,0x78FB,0x4FBF,0x5FA9,
+  0x4E0D,0x6CCC,0x6578,0x7D22,0x53C3,0x585E,0x7701,0x8449,
+  0x8AAA,0x6BBA,0x8FB0,0x6C88,0x62FE,0x82E5,0x63A0,0x7565,
+  0x4EAE,0x5169,0x51C9,0x6881,0x7CE7,0x826F,0x8AD2,0x91CF,
+  0x52F5,0x5442,0x5973,0x5EEC,0x65C5,0x6FFE,0x792A,0x95AD,
+  0x9A6A,0x9E97,0x9ECE,0x529B,0x66C6,0x6B77,0x8F62,0x5E74,
+  0x6190,0x6200,0x649A,0x6F23,0x7149,0x7489,0x79CA,0x7DF4,
+  0x806F,0x8F26,0x84EE,0x9023,0x934A,0x5217,0x52A3,0x54BD,
+  0x70C8,0x88C2,0x8AAA,0x5EC9,0x5FF5,0x637B,0x6BAE,0x7C3E,
+  0x7375,0x4EE4,0x56F9,0x5BE7,0x5DBA,0x601C,0x73B2,0x7469,
+  0x7F9A,0x8046,0x9234,0x96F6,0x9748,0x9818,0x4F8B,0x79AE,
+  0x91B4,0x96B8,0x60E1,0x4E86,0x50DA,0x5BEE,0x5C3F,0x6599,
+  0x6A02,0x71CE,0x7642,0x84FC,0x907C,0x9F8D,0x6688,0x962E,
+  0x5289,0x677B,0x67F3,0x6D41,0x6E9C,0x7409,0x7559,0x786B,
+  0x7D10,0x985E,0x516D,0x622E,0x9678,0x502B,0x5D19,0x6DEA,
+  0x8F2A,0x5F8B,0x6144,0x6817,0x7387,0x9686,0x5229,0x540F,
+  0x5C65,0x6613,0x674E,0x68A8,0x6CE5,0x7406,0x75E2,0x7F79,
+  0x88CF,0x88E1,0x91CC,0x96E2,0x533F,0x6EBA,0x541D,0x71D0,
+  0x7498,0x85FA,0x96A3,0x9C57,0x9E9F,0x6797,0x6DCB,0x81E8,
+  0x7ACB,0x7B20,0x7C92,0x72C0,0x7099,0x8B58,0x4EC0,0x8336,
+  0x523A,0x5207,0x5EA6,0x62D3,0x7CD6,0x5B85,0x6D1E,0x66B4,
+  0x8F3B,0x884C,0x964D,0x898B,0x5ED3,0x5140,0x55C0,0x585A,
+  0x6674,0x51DE,0x732A,0x76CA,0x793C,0x795E,0x7965,0x798F,
+  0x9756,0x7CBE,0x7FBD,0x8612,0x8AF8,0x9038,0x90FD,0x98EF,
+  0x98FC,0x9928,0x9DB4,0x90DE,0x96B7,0x4FAE,0x50E7,0x514D,
+  0x52C9,0x52E4,0x5351,0x559D,0x5606,0x5668,0x5840,0x58A8,
+  0x5C64,0x5C6E,0x6094,0x6168,0x618E,0x61F2,0x654F,0x65E2,
+  0x6691,0x6885,0x6D77,0x6E1A,0x6F22,0x716E,0x722B,0x7422,
+  0x7891,0x793E,0x7949,0x7948,0x7950,0x7956,0x795D,0x798D,
+  0x798E,0x7A40,0x7A81,0x7BC0,0x7DF4,0x7E09,0x7E41,0x7F72,
+  0x8005,0x81ED,0x8279,0x8279,0x8457,0x8910,0x8996,0x8B01,
+  0x8B39,0x8CD3,0x8D08,0x8FB6,0x9038,0x96E3,0x97FF,0x983B,
+  0x6075,0x242EE,0x8218,0x4E26,0x51B5,0x5168,0x4F80,0x5145,
+  0x5180,0x52C7,0x52FA,0x559D,0x5555,0x5599,0x55E2,0x585A,
+  0x58B3,0x5944,0x5954,0x5A62,0x5B28,0x5ED2,0x5ED9,0x5F69,
+  0x5FAD,0x60D8,0x614E,0x6108,0x618E,0x6160,0x61F2,0x6234,
+  0x63C4,0x641C,0x6452,0x6556,0x6674,0x6717,0x671B,0x6756,
+  0x6B79,0x6BBA,0x6D41,0x6EDB,0x6ECB,0x6F22,0x701E,0x716E,
+  0x77A7,0x7235,0x72AF,0x732A,0x7471,0x7506,0x753B,0x761D,
+  0x761F,0x76CA,0x76DB,0x76F4,0x774A,0x7740,0x78CC,0x7AB1,
+  0x7BC0,0x7C7B,0x7D5B,0x7DF4,0x7F3E,0x8005,0x8352,0x83EF,
+  0x8779,0x8941,0x8986,0x8996,0x8ABF,0x8AF8,0x8ACB,0x8B01,
+  0x8AFE,0x8AED,0x8B39,0x8B8A,0x8D08,0x8F38,0x9072,0x9199,
+  0x9276,0x967C,0x96E3,0x9756,0x97DB,0x97FF,0x980B,0x983B,
+  0x9B12,0x9F9C,0x2284A,0x22844,0x233D5,0x3B9D,0x4018,0x4039,
+  0x25249,0x25CD0,0x27ED3,0x9F43,0x9F8E,0x05D9,0x05B4,0x05F2,
+  0x05B7,0x05E9,0x05C1,0x05E9,0x05C2,0x05E9,0x05BC,0x05C1,
+  0x05E9,0x05BC,0x05C2,0x05D0,0x05B7,0x05D0,0x05B8,0x05D0,
+  0x05BC,0x05D1,0x05BC,0x05D2,0x05BC,0x05D3,0x05BC,0x05D4,
+  0x05BC,0x05D5,0x05BC,0x05D6,0x05BC,0x05D8,0x05BC,0x05D9,
+  0x05BC,0x05DA,0x05BC,0x05DB,0x05BC,0x05DC,0x05BC,0x05DE,
+  0x05BC,0x05E0,0x05BC,0x05E1,0x05BC,0x05E3,0x05BC,0x05E4,
+  0x05BC,0x05E6,0x05BC,0x05E7,0x05BC,0x05E8,0x05BC,0x05E9,
+  0x05BC,0x05EA,0x05BC,0x05D5,0x05B9,0x05D1,0x05BF,0x05DB,
+  0x05BF,0x05E4,0x05BF,0x11099,0x110BA,0x1109B,0x110BA,0x110A5,
+  0x110BA,0x11131,0x11127,0x11132,0x11127,0x11347,0x1133E,0x11347,
+  0x11357,0x114B9,0x114BA,0x114B9,0x114B0,0x114B9,0x114BD,0x115B8,
+  0x115AF,0x115B9,0x115AF,0x11935,0x11930,0x1D157,0x1D165,0x1D158,
+  0x1D165,0x1D158,0x1D165,0x1D16E,0x1D158,0x1D165,0x1D16F,0x1D158,
+  0x1D165,0x1D170,0x1D158,0x1D165,0x1D171,0x1D158,0x1D165,0x1D172,
+  0x1D1B9,0x1D165,0x1D1BA,0x1D165,0x1D1B9,0x1D165,0x1D16E,0x1D1BA,
+  0x1D165,0x1D16E,0x1D1B9,0x1D165,0x1D16F,0x1D1BA,0x1D165,0x1D16F,
+  0x4E3D,0x4E38,0x4E41,0x20122,0x4F60,0x4FAE,0x4FBB,0x5002,
+  0x507A,0x5099,0x50E7,0x50CF,0x349E,0x2063A,0x514D,0x5154,
+  0x5164,0x5177,0x2051C,0x34B9,0x5167,0x518D,0x2054B,0x5197,
+  0x51A4,0x4ECC,0x51AC,0x51B5,0x291DF,0x51F5,0x5203,0x34DF,
+  0x523B,0x5246,0x5272,0x5277,0x3515,0x52C7,0x52C9,0x52E4,
+  0x52FA,0x5305,0x5306,0x5317,0x5349,0x5351,0x535A,0x5373,
+  0x537D,0x537F,0x537F,0x537F,0x20A2C,0x7070,0x53CA,0x53DF,
+  0x20B63,0x53EB,0x53F1,0x5406,0x549E,0x5438,0x5448,0x5468,
+  0x54A2,0x54F6,0x5510,0x5553,0x5563,0x5584,0x5584,0x5599,
+  0x55AB,0x55B3,0x55C2,0x5716,0x5606,0x5717,0x5651,0x5674,
+  0x5207,0x58EE,0x57CE,0x57F4,0x580D,0x578B,0x5832,0x5831,
+  0x58AC,0x214E4,0x58F2,0x58F7,0x5906,0x591A,0x5922,0x5962,
+  0x216A8,0x216EA,0x59EC,0x5A1B,0x5A27,0x59D8,0x5A66,0x36EE,
+  0x36FC,0x5B08,0x5B3E,0x5B3E,0x219C8,0x5BC3,0x5BD8,0x5BE7,
+  0x5BF3,0x21B18,0x5BFF,0x5C06,0x5F53,0x5C22,0x3781,0x5C60,
+  0x5C6E,0x5CC0,0x5C8D,0x21DE4,0x5D43,0x21DE6,0x5D6E,0x5D6B,
+  0x5D7C,0x5DE1,0x5DE2,0x382F,0x5DFD,0x5E28,0x5E3D,0x5E69,
+  0x3862,0x22183,0x387C,0x5EB0,0x5EB3,0x5EB6,0x5ECA,0x2A392,
+  0x5EFE,0x22331,0x22331,0x8201,0x5F22,0x5F22,0x38C7,0x232B8,
+  0x261DA,0x5F62,0x5F6B,0x38E3,0x5F9A,0x5FCD,0x5FD7,0x5FF9,
+  0x6081,0x393A,0x391C,0x6094,0x226D4,0x60C7,0x6148,0x614C,
+  0x614E,0x614C,0x617A,0x618E,0x61B2,0x61A4,0x61AF,0x61DE,
+  0x61F2,0x61F6,0x6210,0x621B,0x625D,0x62B1,0x62D4,0x6350,
+  0x22B0C,0x633D,0x62FC,0x6368,0x6383,0x63E4,0x22BF1,0x6422,
+  0x63C5,0x63A9,0x3A2E,0x6469,0x647E,0x649D,0x6477,0x3A6C,
+  0x654F,0x656C,0x2300A,0x65E3,0x66F8,0x6649,0x3B19,0x6691,
+  0x3B08,0x3AE4,0x5192,0x5195,0x6700,0x669C,0x80AD,0x43D9,
+  0x6717,0x671B,0x6721,0x675E,0x6753,0x233C3,0x3B49,0x67FA,
+  0x6785,0x6852,0x6885,0x2346D,0x688E,0x681F,0x6914,0x3B9D,
+  0x6942,0x69A3,0x69EA,0x6AA8,0x236A3,0x6ADB,0x3C18,0x6B21,
+  0x238A7,0x6B54,0x3C4E,0x6B72,0x6B9F,0x6BBA,0x6BBB,0x23A8D,
+  0x21D0B,0x23AFA,0x6C4E,0x23CBC,0x6CBF,0x6CCD,0x6C67,0x6D16,
+  0x6D3E,0x6D77,0x6D41,0x6D69,0x6D78,0x6D85,0x23D1E,0x6D34,
+  0x6E2F,0x6E6E,0x3D33,0x6ECB,0x6EC7,0x23ED1,0x6DF9,0x6F6E,
+  0x23F5E,0x23F8E,0x6FC6,0x7039,0x701E,0x701B,0x3D96,0x704A,
+  0x707D,0x7077,0x70AD,0x20525,0x7145,0x24263,0x719C,0x243AB,
+  0x7228,0x7235,0x7250,0x24608,0x7280,0x7295,0x24735,0x24814,
+  0x737A,0x738B,0x3EAC,0x73A5,0x3EB8,0x3EB8,0x7447,0x745C,
+  0x7471,0x7485,0x74CA,0x3F1B,0x7524,0x24C36,0x753E,0x24C92,
+  0x7570,0x2219F,0x7610,0x24FA1,0x24FB8,0x25044,0x3FFC,0x4008,
+  0x76F4,0x250F3,0x250F2,0x25119,0x25133,0x771E,0x771F,0x771F,
+  0x774A,0x4039,0x778B,0x4046,0x4096,0x2541D,0x784E,0x788C,
+  0x78CC,0x40E3,0x25626,0x7956,0x2569A,0x256C5,0x798F,0x79EB,
+  0x412F,0x7A40,0x7A4A,0x7A4F,0x2597C,0x25AA7,0x25AA7,0x7AEE,
+  0x4202,0x25BAB,0x7BC6,0x7BC9,0x4227,0x25C80,0x7CD2,0x42A0,
+  0x7CE8,0x7CE3,0x7D00,0x25F86,0x7D63,0x4301,0x7DC7,0x7E02,
+  0x7E45,0x4334,0x26228,0x26247,0x4359,0x262D9,0x7F7A,0x2633E,
+  0x7F95,0x7FFA,0x8005,0x264DA,0x26523,0x8060,0x265A8,0x8070,
+  0x2335F,0x43D5,0x80B2,0x8103,0x440B,0x813E,0x5AB5,0x267A7,
+  0x267B5,0x23393,0x2339C,0x8201,0x8204,0x8F9E,0x446B,0x8291,
+  0x828B,0x829D,0x52B3,0x82B1,0x82B3,0x82BD,0x82E6,0x26B3C,
+  0x82E5,0x831D,0x8363,0x83AD,0x8323,0x83BD,0x83E7,0x8457,
+  0x8353,0x83CA,0x83CC,0x83DC,0x26C36,0x26D6B,0x26CD5,0x452B,
+  0x84F1,0x84F3,0x8516,0x273CA,0x8564,0x26F2C,0x455D,0x4561,
+  0x26FB1,0x270D2,0x456B,0x8650,0x865C,0x8667,0x8669,0x86A9,
+  0x8688,0x870E,0x86E2,0x8779,0x8728,0x876B,0x8786,0x45D7,
+  0x87E1,0x8801,0x45F9,0x8860,0x8863,0x27667,0x88D7,0x88DE,
+  0x4635,0x88FA,0x34BB,0x278AE,0x27966,0x46BE,0x46C7,0x8AA0,
+  0x8AED,0x8B8A,0x8C55,0x27CA8,0x8CAB,0x8CC1,0x8D1B,0x8D77,
+  0x27F2F,0x20804,0x8DCB,0x8DBC,0x8DF0,0x208DE,0x8ED4,0x8F38,
+  0x285D2,0x285ED,0x9094,0x90F1,0x9111,0x2872E,0x911B,0x9238,
+  0x92D7,0x92D8,0x927C,0x93F9,0x9415,0x28BFA,0x958B,0x4995,
+  0x95B7,0x28D77,0x49E6,0x96C3,0x5DB2,0x9723,0x29145,0x2921A,
+  0x4A6E,0x4A76,0x97E0,0x2940A,0x4AB2,0x29496,0x980B,0x980B,
+  0x9829,0x295B6,0x98E2,0x4B33,0x9929,0x99A7,0x99C2,0x99FE,
+  0x4BCE,0x29B30,0x9B12,0x9C40,0x9CFD,0x4CCE,0x4CED,0x9D67,
+  0x2A0CE,0x4CF8,0x2A105,0x2A20E,0x2A291,0x9EBB,0x4D56,0x9EF9,
+  0x9EFE,0x9F05,0x9F0F,0x9F16,0x9F3B,0x2A600,
+};
+
+/**
+ * The sorted keys `(first * 0x110000 + second)` of the pairs of code points
+ * which canonically compose to primary composites (except the Hangul syllables).
+ */
+constexpr std::uint64_t composition_keys[941] = {
+  0x000003FC0338,0x0000040D0338,0x0000041E0338,0x000004510300,
+  0x000004510301,0x000004510302,0x000004510303,0x000004510304,
+  0x000004510306,0x000004510307,0x000004510308,0x000004510309,
+  0x00000451030A,0x00000451030C,0x00000451030F,0x000004510311,
+  0x000004510323,0x000004510325,0x000004510328,0x000004620307,
+  0x000004620323,0x000004620331,0x000004730301,0x000004730302,
+  0x000004730307,0x00000473030C,0x000004730327,0x000004840307,
+  0x00000484030C,0x000004840323,0x000004840327,0x00000484032D,
+  0x000004840331,0x000004950300,0x000004950301,0x000004950302,
+  0x000004950303,0x000004950304,0x000004950306,0x000004950307,
+  0x000004950308,0x000004950309,0x00000495030C,0x00000495030F,
+  0x000004950311,0x000004950323,0x000004950327,0x000004950328,
+  0x00000495032D,0x000004950330,0x000004A60307,0x000004B70301,
+  0x000004B70302,0x000004B70304,0x000004B70306,0x000004B70307,
+  0x000004B7030C,0x000004B70327,0x000004C80302,0x000004C80307,
+  0x000004C80308,0x000004C8030C,0x000004C80323,0x000004C80327,
+  0x000004C8032E,0x000004D90300,0x000004D90301,0x000004D90302,
+  0x000004D90303,0x000004D90304,0x000004D90306,0x000004D90307,
+  0x000004D90308,0x000004D90309,0x000004D9030C,0x000004D9030F,
+  0x000004D90311,0x000004D90323,0x000004D90328,0x000004D90330,
+  0x000004EA0302,0x000004FB0301,0x000004FB030C,0x000004FB0323,
+  0x000004FB0327,0x000004FB0331,0x0000050C0301,0x0000050C030C,
+  0x0000050C0323,0x0000050C0327,0x0000050C032D,0x0000050C0331,
+  0x0000051D0301,0x0000051D0307,0x0000051D0323,0x0000052E0300,
+  0x0000052E0301,0x0000052E0303,0x0000052E0307,0x0000052E030C,
+  0x0000052E0323,0x0000052E0327,0x0000052E032D,0x0000052E0331,
+  0x0000053F0300,0x0000053F0301,0x0000053F0302,0x0000053F0303,
+  0x0000053F0304,0x0000053F0306,0x0000053F0307,0x0000053F0308,
+  0x0000053F0309,0x0000053F030B,0x0000053F030C,0x0000053F030F,
+  0x0000053F0311,0x0000053F031B,0x0000053F0323,0x0000053F0328,
+  0x000005500301,0x000005500307,0x000005720301,0x000005720307,
+  0x00000572030C,0x00000572030F,0x000005720311,0x000005720323,
+  0x000005720327,0x000005720331,0x000005830301,0x000005830302,
+  0x000005830307,0x00000583030C,0x000005830323,0x000005830326,
+  0x000005830327,0x000005940307,0x00000594030C,0x000005940323,
+  0x000005940326,0x000005940327,0x00000594032D,0x000005940331,
+  0x000005A50300,0x000005A50301,0x000005A50302,0x000005A50303,
+  0x000005A50304,0x000005A50306,0x000005A50308,0x000005A50309,
+  0x000005A5030A,0x000005A5030B,0x000005A5030C,0x000005A5030F,
+  0x000005A50311,0x000005A5031B,0x000005A50323,0x000005A50324,
+  0x000005A50328,0x000005A5032D,0x000005A50330,0x000005B60303,
+  0x000005B60323,0x000005C70300,0x000005C70301,0x000005C70302,
+  0x000005C70307,0x000005C70308,0x000005C70323,0x000005D80307,
+  0x000005D80308,0x000005E90300,0x000005E90301,0x000005E90302,
+  0x000005E90303,0x000005E90304,0x000005E90307,0x000005E90308,
+  0x000005E90309,0x000005E90323,0x000005FA0301,0x000005FA0302,
+  0x000005FA0307,0x000005FA030C,0x000005FA0323,0x000005FA0331,
+  0x000006710300,0x000006710301,0x000006710302,0x000006710303,
+  0x000006710304,0x000006710306,0x000006710307,0x000006710308,
+  0x000006710309,0x00000671030A,0x00000671030C,0x00000671030F,
+  0x000006710311,0x000006710323,0x000006710325,0x000006710328,
+  0x000006820307,0x000006820323,0x000006820331,0x000006930301,
+  0x000006930302,0x000006930307,0x00000693030C,0x000006930327,
+  0x000006A40307,0x000006A4030C,0x000006A40323,0x000006A40327,
+  0x000006A4032D,0x000006A40331,0x000006B50300,0x000006B50301,
+  0x000006B50302,0x000006B50303,0x000006B50304,0x000006B50306,
+  0x000006B50307,0x000006B50308,0x000006B50309,0x000006B5030C,
+  0x000006B5030F,0x000006B50311,0x000006B50323,0x000006B50327,
+  0x000006B50328,0x000006B5032D,0x000006B50330,0x000006C60307,
+  0x000006D70301,0x000006D70302,0x000006D70304,0x000006D70306,
+  0x000006D70307,0x000006D7030C,0x000006D70327,0x000006E80302,
+  0x000006E80307,0x000006E80308,0x000006E8030C,0x000006E80323,
+  0x000006E80327,0x000006E8032E,0x000006E80331,0x000006F90300,
+  0x000006F90301,0x000006F90302,0x000006F90303,0x000006F90304,
+  0x000006F90306,0x000006F90308,0x000006F90309,0x000006F9030C,
+  0x000006F9030F,0x000006F90311,0x000006F90323,0x000006F90328,
+  0x000006F90330,0x0000070A0302,0x0000070A030C,0x0000071B0301,
+  0x0000071B030C,0x0000071B0323,0x0000071B0327,0x0000071B0331,
+  0x0000072C0301,0x0000072C030C,0x0000072C0323,0x0000072C0327,
+  0x0000072C032D,0x0000072C0331,0x0000073D0301,0x0000073D0307,
+  0x0000073D0323,0x0000074E0300,0x0000074E0301,0x0000074E0303,
+  0x0000074E0307,0x0000074E030C,0x0000074E0323,0x0000074E0327,
+  0x0000074E032D,0x0000074E0331,0x0000075F0300,0x0000075F0301,
+  0x0000075F0302,0x0000075F0303,0x0000075F0304,0x0000075F0306,
+  0x0000075F0307,0x0000075F0308,0x0000075F0309,0x0000075F030B,
+  0x0000075F030C,0x0000075F030F,0x0000075F0311,0x0000075F031B,
+  0x0000075F0323,0x0000075F0328,0x000007700301,0x000007700307,
+  0x000007920301,0x000007920307,0x00000792030C,0x00000792030F,
+  0x000007920311,0x000007920323,0x000007920327,0x000007920331,
+  0x000007A30301,0x000007A30302,0x000007A30307,0x000007A3030C,
+  0x000007A30323,0x000007A30326,0x000007A30327,0x000007B40307,
+  0x000007B40308,0x000007B4030C,0x000007B40323,0x000007B40326,
+  0x000007B40327,0x000007B4032D,0x000007B40331,0x000007C50300,
+  0x000007C50301,0x000007C50302,0x000007C50303,0x000007C50304,
+  0x000007C50306,0x000007C50308,0x000007C50309,0x000007C5030A,
+  0x000007C5030B,0x000007C5030C,0x000007C5030F,0x000007C50311,
+  0x000007C5031B,0x000007C50323,0x000007C50324,0x000007C50328,
+  0x000007C5032D,0x000007C50330,0x000007D60303,0x000007D60323,
+  0x000007E70300,0x000007E70301,0x000007E70302,0x000007E70307,
+  0x000007E70308,0x000007E7030A,0x000007E70323,0x000007F80307,
+  0x000007F80308,0x000008090300,0x000008090301,0x000008090302,
+  0x000008090303,0x000008090304,0x000008090307,0x000008090308,
+  0x000008090309,0x00000809030A,0x000008090323,0x0000081A0301,
+  0x0000081A0302,0x0000081A0307,0x0000081A030C,0x0000081A0323,
+  0x0000081A0331,0x00000B280300,0x00000B280301,0x00000B280342,
+  0x00000CE20300,0x00000CE20301,0x00000CE20303,0x00000CE20309,
+  0x00000D040304,0x00000D150301,0x00000D260301,0x00000D260304,
+  0x00000D370301,0x00000D6A0300,0x00000D6A0301,0x00000D6A0303,
+  0x00000D6A0309,0x00000DBF0301,0x00000E140300,0x00000E140301,
+  0x00000E140303,0x00000E140309,0x00000E250301,0x00000E250304,
+  0x00000E250308,0x00000E360304,0x00000E580301,0x00000E9C0300,
+  0x00000E9C0301,0x00000E9C0304,0x00000E9C030C,0x00000F020300,
+  0x00000F020301,0x00000F020303,0x00000F020309,0x00000F240304,
+  0x00000F350301,0x00000F460301,0x00000F460304,0x00000F570301,
+  0x00000F8A0300,0x00000F8A0301,0x00000F8A0303,0x00000F8A0309,
+  0x00000FDF0301,0x000010340300,0x000010340301,0x000010340303,
+  0x000010340309,0x000010450301,0x000010450304,0x000010450308,
+  0x000010560304,0x000010780301,0x000010BC0300,0x000010BC0301,
+  0x000010BC0304,0x000010BC030C,0x000011220300,0x000011220301,
+  0x000011220303,0x000011220309,0x000011330300,0x000011330301,
+  0x000011330303,0x000011330309,0x000012320300,0x000012320301,
+  0x000012430300,0x000012430301,0x0000160C0300,0x0000160C0301,
+  0x0000161D0300,0x0000161D0301,0x000016FA0307,0x0000170B0307,
+  0x000017600307,0x000017710307,0x000017E80301,0x000017F90301,
+  0x0000180A0308,0x0000181B0308,0x0000196F0307,0x00001BA00300,
+  0x00001BA00301,0x00001BA00303,0x00001BA00309,0x00001BA00323,
+  0x00001BB10300,0x00001BB10301,0x00001BB10303,0x00001BB10309,
+  0x00001BB10323,0x00001C9F0300,0x00001C9F0301,0x00001C9F0303,
+  0x00001C9F0309,0x00001C9F0323,0x00001CB00300,0x00001CB00301,
+  0x00001CB00303,0x00001CB00309,0x00001CB00323,0x00001D27030C,
+  0x0000208A0304,0x0000209B0304,0x000024860304,0x000024970304,
+  0x000024A80306,0x000024B90306,0x0000250E0304,0x0000251F0304,
+  0x00002BB2030C,0x00003CA10300,0x00003CA10301,0x00003CA10304,
+  0x00003CA10306,0x00003CA10313,0x00003CA10314,0x00003CA10345,
+  0x00003CE50300,0x00003CE50301,0x00003CE50313,0x00003CE50314,
+  0x00003D070300,0x00003D070301,0x00003D070313,0x00003D070314,
+  0x00003D070345,0x00003D290300,0x00003D290301,0x00003D290304,
+  0x00003D290306,0x00003D290308,0x00003D290313,0x00003D290314,
+  0x00003D8F0300,0x00003D8F0301,0x00003D8F0313,0x00003D8F0314,
+  0x00003DB10314,0x00003DF50300,0x00003DF50301,0x00003DF50304,
+  0x00003DF50306,0x00003DF50308,0x00003DF50314,0x00003E390300,
+  0x00003E390301,0x00003E390313,0x00003E390314,0x00003E390345,
+  0x00003E6C0345,0x00003E8E0345,0x00003EC10300,0x00003EC10301,
+  0x00003EC10304,0x00003EC10306,0x00003EC10313,0x00003EC10314,
+  0x00003EC10342,0x00003EC10345,0x00003F050300,0x00003F050301,
+  0x00003F050313,0x00003F050314,0x00003F270300,0x00003F270301,
+  0x00003F270313,0x00003F270314,0x00003F270342,0x00003F270345,
+  0x00003F490300,0x00003F490301,0x00003F490304,0x00003F490306,
+  0x00003F490308,0x00003F490313,0x00003F490314,0x00003F490342,
+  0x00003FAF0300,0x00003FAF0301,0x00003FAF0313,0x00003FAF0314,
+  0x00003FD10313,0x00003FD10314,0x000040150300,0x000040150301,
+  0x000040150304,0x000040150306,0x000040150308,0x000040150313,
+  0x000040150314,0x000040150342,0x000040590300,0x000040590301,
+  0x000040590313,0x000040590314,0x000040590342,0x000040590345,
+  0x0000406A0300,0x0000406A0301,0x0000406A0342,0x0000407B0300,
+  0x0000407B0301,0x0000407B0342,0x000040AE0345,0x000040F20301,
+  0x000040F20308,0x000044660308,0x000045100306,0x000045100308,
+  0x000045430301,0x000045650300,0x000045650306,0x000045650308,
+  0x000045760306,0x000045760308,0x000045870308,0x000045980300,
+  0x000045980304,0x000045980306,0x000045980308,0x000045BA0301,
+  0x000045FE0308,0x000046530304,0x000046530306,0x000046530308,
+  0x00004653030B,0x000046970308,0x000046DB0308,0x000046FD0308,
+  0x000047300306,0x000047300308,0x000047630301,0x000047850300,
+  0x000047850306,0x000047850308,0x000047960306,0x000047960308,
+  0x000047A70308,0x000047B80300,0x000047B80304,0x000047B80306,
+  0x000047B80308,0x000047DA0301,0x0000481E0308,0x000048730304,
+  0x000048730306,0x000048730308,0x00004873030B,0x000048B70308,
+  0x000048FB0308,0x0000491D0308,0x000049B60308,0x00004BB4030F,
+  0x00004BC5030F,0x000052580308,0x000052690308,0x000053680308,
+  0x000053790308,0x000068970653,0x000068970654,0x000068970655,
+  0x00006AC80654,0x00006AEA0654,0x000072D10654,0x000073F20654,
+  0x000074250654,0x00009BA8093C,0x00009C30093C,0x00009C63093C,
+  0x0000A63709BE,0x0000A63709D7,0x0000BFB70B3E,0x0000BFB70B56,
+  0x0000BFB70B57,0x0000C4B20BD7,0x0000C8260BBE,0x0000C8260BD7,
+  0x0000C8370BBE,0x0000D0A60C56,0x0000D8AF0CD5,0x0000D9260CC2,
+  0x0000D9260CD5,0x0000D9260CD6,0x0000D96A0CD5,0x0000E1A60D3E,
+  0x0000E1A60D57,0x0000E1B70D3E,0x0000EB690DCA,0x0000EB690DCF,
+  0x0000EB690DDF,0x0000EB9C0DCA,0x00011275102E,0x0001CB551B35,
+  0x0001CB771B35,0x0001CB991B35,0x0001CBBB1B35,0x0001CBDD1B35,
+  0x0001CC211B35,0x0001CEDA1B35,0x0001CEFC1B35,0x0001CF1E1B35,
+  0x0001CF2F1B35,0x0001CF621B35,0x000201960304,0x000201A70304,
+  0x000203FA0304,0x0002040B0304,0x000204820307,0x000204930307,
+  0x000208A00302,0x000208A00306,0x000208B10302,0x000208B10306,
+  0x00020A380302,0x00020A490302,0x00020B8C0302,0x00020B9D0302,
+  0x00020F000300,0x00020F000301,0x00020F000342,0x00020F000345,
+  0x00020F110300,0x00020F110301,0x00020F110342,0x00020F110345,
+  0x00020F220345,0x00020F330345,0x00020F440345,0x00020F550345,
+  0x00020F660345,0x00020F770345,0x00020F880300,0x00020F880301,
+  0x00020F880342,0x00020F880345,0x00020F990300,0x00020F990301,
+  0x00020F990342,0x00020F990345,0x00020FAA0345,0x00020FBB0345,
+  0x00020FCC0345,0x00020FDD0345,0x00020FEE0345,0x00020FFF0345,
+  0x000210100300,0x000210100301,0x000210210300,0x000210210301,
+  0x000210980300,0x000210980301,0x000210A90300,0x000210A90301,
+  0x000211200300,0x000211200301,0x000211200342,0x000211200345,
+  0x000211310300,0x000211310301,0x000211310342,0x000211310345,
+  0x000211420345,0x000211530345,0x000211640345,0x000211750345,
+  0x000211860345,0x000211970345,0x000211A80300,0x000211A80301,
+  0x000211A80342,0x000211A80345,0x000211B90300,0x000211B90301,
+  0x000211B90342,0x000211B90345,0x000211CA0345,0x000211DB0345,
+  0x000211EC0345,0x000211FD0345,0x0002120E0345,0x0002121F0345,
+  0x000212300300,0x000212300301,0x000212300342,0x000212410300,
+  0x000212410301,0x000212410342,0x000212B80300,0x000212B80301,
+  0x000212B80342,0x000212C90300,0x000212C90301,0x000212C90342,
+  0x000213400300,0x000213400301,0x000213510300,0x000213510301,
+  0x000213C80300,0x000213C80301,0x000213D90300,0x000213D90301,
+  0x000214500300,0x000214500301,0x000214500342,0x000214610300,
+  0x000214610301,0x000214610342,0x000214E90300,0x000214E90301,
+  0x000214E90342,0x000215600300,0x000215600301,0x000215600342,
+  0x000215600345,0x000215710300,0x000215710301,0x000215710342,
+  0x000215710345,0x000215820345,0x000215930345,0x000215A40345,
+  0x000215B50345,0x000215C60345,0x000215D70345,0x000215E80300,
+  0x000215E80301,0x000215E80342,0x000215E80345,0x000215F90300,
+  0x000215F90301,0x000215F90342,0x000215F90345,0x0002160A0345,
+  0x0002161B0345,0x0002162C0345,0x0002163D0345,0x0002164E0345,
+  0x0002165F0345,0x000216700345,0x000216B40345,0x0002173C0345,
+  0x00021B160345,0x00021BAF0300,0x00021BAF0301,0x00021BAF0342,
+  0x00021C260345,0x00021F560345,0x00021FDE0300,0x00021FDE0301,
+  0x00021FDE0342,0x00023A900338,0x00023AB20338,0x00023AD40338,
+  0x00023ED00338,0x00023EF20338,0x00023F140338,0x000242330338,
+  0x000242880338,0x000242BB0338,0x000244530338,0x000244750338,
+  0x000245FC0338,0x000246730338,0x000246950338,0x000246C80338,
+  0x0002471D0338,0x000248710338,0x000248A40338,0x000248B50338,
+  0x000249920338,0x000249A30338,0x000249D60338,0x000249E70338,
+  0x00024A1A0338,0x00024A2B0338,0x00024A3C0338,0x00024A4D0338,
+  0x00024AA20338,0x00024AB30338,0x00024AE60338,0x00024AF70338,
+  0x00024BA10338,0x00024BB20338,0x00024CC20338,0x00024D280338,
+  0x00024D390338,0x00024D5B0338,0x00024DD20338,0x00024DE30338,
+  0x00024DF40338,0x00024E050338,0x000334A63099,0x000334FB3099,
+  0x0003351D3099,0x0003353F3099,0x000335613099,0x000335833099,
+  0x000335A53099,0x000335C73099,0x000335E93099,0x0003360B3099,
+  0x0003362D3099,0x0003364F3099,0x000336713099,0x000336A43099,
+  0x000336C63099,0x000336E83099,0x0003375F3099,0x0003375F309A,
+  0x000337923099,0x00033792309A,0x000337C53099,0x000337C5309A,
+  0x000337F83099,0x000337F8309A,0x0003382B3099,0x0003382B309A,
+  0x00033A6D3099,0x00033B063099,0x00033B5B3099,0x00033B7D3099,
+  0x00033B9F3099,0x00033BC13099,0x00033BE33099,0x00033C053099,
+  0x00033C273099,0x00033C493099,0x00033C6B3099,0x00033C8D3099,
+  0x00033CAF3099,0x00033CD13099,0x00033D043099,0x00033D263099,
+  0x00033D483099,0x00033DBF3099,0x00033DBF309A,0x00033DF23099,
+  0x00033DF2309A,0x00033E253099,0x00033E25309A,0x00033E583099,
+  0x00033E58309A,0x00033E8B3099,0x00033E8B309A,0x00033FDF3099,
+  0x00033FF03099,0x000340013099,0x000340123099,0x000340CD3099,
+  0x00121A2A10BA,0x00121A4C10BA,0x00121AF610BA,0x001224421127,
+  0x001224531127,0x001247B8133E,0x001247B81357,0x0012604A14B0,
+  0x0012604A14BA,0x0012604A14BD,0x0012713915AF,0x0012714A15AF,
+  0x0012AC861930,
+};
+
+/// The primary composites of `composition_keys`.
+constexpr char32_t compositions[941] = {
+  0x226E,0x2260,0x226F,0x00C0,0x00C1,0x00C2,0x00C3,0x0100,
+  0x0102,0x0226,0x00C4,0x1EA2,0x00C5,0x01CD,0x0200,0x0202,
+  0x1EA0,0x1E00,0x0104,0x1E02,0x1E04,0x1E06,0x0106,0x0108,
+  0x010A,0x010C,0x00C7,0x1E0A,0x010E,0x1E0C,0x1E10,0x1E12,
+  0x1E0E,0x00C8,0x00C9,0x00CA,0x1EBC,0x0112,0x0114,0x0116,
+  0x00CB,0x1EBA,0x011A,0x0204,0x0206,0x1EB8,0x0228,0x0118,
+  0x1E18,0x1E1A,0x1E1E,0x01F4,0x011C,0x1E20,0x011E,0x0120,
+  0x01E6,0x0122,0x0124,0x1E22,0x1E26,0x021E,0x1E24,0x1E28,
+  0x1E2A,0x00CC,0x00CD,0x00CE,0x0128,0x012A,0x012C,0x0130,
+  0x00CF,0x1EC8,0x01CF,0x0208,0x020A,0x1ECA,0x012E,0x1E2C,
+  0x0134,0x1E30,0x01E8,0x1E32,0x0136,0x1E34,0x0139,0x013D,
+  0x1E36,0x013B,0x1E3C,0x1E3A,0x1E3E,0x1E40,0x1E42,0x01F8,
+  0x0143,0x00D1,0x1E44,0x0147,0x1E46,0x0145,0x1E4A,0x1E48,
+  0x00D2,0x00D3,0x00D4,0x00D5,0x014C,0x014E,0x022E,0x00D6,
+  0x1ECE,0x0150,0x01D1,0x020C,0x020E,0x01A0,0x1ECC,0x01EA,
+  0x1E54,0x1E56,0x0154,0x1E58,0x0158,0x0210,0x0212,0x1E5A,
+  0x0156,0x1E5E,0x015A,0x015C,0x1E60,0x0160,0x1E62,0x0218,
+  0x015E,0x1E6A,0x0164,0x1E6C,0x021A,0x0162,0x1E70,0x1E6E,
+  0x00D9,0x00DA,0x00DB,0x0168,0x016A,0x016C,0x00DC,0x1EE6,
+  0x016E,0x0170,0x01D3,0x0214,0x0216,0x01AF,0x1EE4,0x1E72,
+  0x0172,0x1E76,0x1E74,0x1E7C,0x1E7E,0x1E80,0x1E82,0x0174,
+  0x1E86,0x1E84,0x1E88,0x1E8A,0x1E8C,0x1EF2,0x00DD,0x0176,
+  0x1EF8,0x0232,0x1E8E,0x0178,0x1EF6,0x1EF4,0x0179,0x1E90,
+  0x017B,0x017D,0x1E92,0x1E94,0x00E0,0x00E1,0x00E2,0x00E3,
+  0x0101,0x0103,0x0227,0x00E4,0x1EA3,0x00E5,0x01CE,0x0201,
+  0x0203,0x1EA1,0x1E01,0x0105,0x1E03,0x1E05,0x1E07,0x0107,
+  0x0109,0x010B,0x010D,0x00E7,0x1E0B,0x010F,0x1E0D,0x1E11,
+  0x1E13,0x1E0F,0x00E8,0x00E9,0x00EA,0x1EBD,0x0113,0x0115,
+  0x0117,0x00EB,0x1EBB,0x011B,0x0205,0x0207,0x1EB9,0x0229,
+  0x0119,0x1E19,0x1E1B,0x1E1F,0x01F5,0x011D,0x1E21,0x011F,
+  0x0121,0x01E7,0x0123,0x0125,0x1E23,0x1E27,0x021F,0x1E25,
+  0x1E29,0x1E2B,0x1E96,0x00EC,0x00ED,0x00EE,0x0129,0x012B,
+  0x012D,0x00EF,0x1EC9,0x01D0,0x0209,0x020B,0x1ECB,0x012F,
+  0x1E2D,0x0135,0x01F0,0x1E31,0x01E9,0x1E33,0x0137,0x1E35,
+  0x013A,0x013E,0x1E37,0x013C,0x1E3D,0x1E3B,0x1E3F,0x1E41,
+  0x1E43,0x01F9,0x0144,0x00F1,0x1E45,0x0148,0x1E47,0x0146,
+  0x1E4B,0x1E49,0x00F2,0x00F3,0x00F4,0x00F5,0x014D,0x014F,
+  0x022F,0x00F6,0x1ECF,0x0151,0x01D2,0x020D,0x020F,0x01A1,
+  0x1ECD,0x01EB,0x1E55,0x1E57,0x0155,0x1E59,0x0159,0x0211,
+  0x0213,0x1E5B,0x0157,0x1E5F,0x015B,0x015D,0x1E61,0x0161,
+  0x1E63,0x0219,0x015F,0x1E6B,0x1E97,0x0165,0x1E6D,0x021B,
+  0x0163,0x1E71,0x1E6F,0x00F9,0x00FA,0x00FB,0x0169,0x016B,
+  0x016D,0x00FC,0x1EE7,0x016F,0x0171,0x01D4,0x0215,0x0217,
+  0x01B0,0x1EE5,0x1E73,0x0173,0x1E77,0x1E75,0x1E7D,0x1E7F,
+  0x1E81,0x1E83,0x0175,0x1E87,0x1E85,0x1E98,0x1E89,0x1E8B,
+  0x1E8D,0x1EF3,0x00FD,0x0177,0x1EF9,0x0233,0x1E8F,0x00FF,
+  0x1EF7,0x1E99,0x1EF5,0x017A,0x1E91,0x017C,0x017E,0x1E93,
+  0x1E95,0x1FED,0x0385,0x1FC1,0x1EA6,0x1EA4,0x1EAA,0x1EA8,
+  0x01DE,0x01FA,0x01FC,0x01E2,0x1E08,0x1EC0,0x1EBE,0x1EC4,
+  0x1EC2,0x1E2E,0x1ED2,0x1ED0,0x1ED6,0x1ED4,0x1E4C,0x022C,
+  0x1E4E,0x022A,0x01FE,0x01DB,0x01D7,0x01D5,0x01D9,0x1EA7,
+  0x1EA5,0x1EAB,0x1EA9,0x01DF,0x01FB,0x01FD,0x01E3,0x1E09,
+  0x1EC1,0x1EBF,0x1EC5,0x1EC3,0x1E2F,0x1ED3,0x1ED1,0x1ED7,
+  0x1ED5,0x1E4D,0x022D,0x1E4F,0x022B,0x01FF,0x01DC,0x01D8,
+  0x01D6,0x01DA,0x1EB0,0x1EAE,0x1EB4,0x1EB2,0x1EB1,0x1EAF,
+  0x1EB5,0x1EB3,0x1E14,0x1E16,0x1E15,0x1E17,0x1E50,0x1E52,
+  0x1E51,0x1E53,0x1E64,0x1E65,0x1E66,0x1E67,0x1E78,0x1E79,
+  0x1E7A,0x1E7B,0x1E9B,0x1EDC,0x1EDA,0x1EE0,0x1EDE,0x1EE2,
+  0x1EDD,0x1EDB,0x1EE1,0x1EDF,0x1EE3,0x1EEA,0x1EE8,0x1EEE,
+  0x1EEC,0x1EF0,0x1EEB,0x1EE9,0x1EEF,0x1EED,0x1EF1,0x01EE,
+  0x01EC,0x01ED,0x01E0,0x01E1,0x1E1C,0x1E1D,0x0230,0x0231,
+  0x01EF,0x1FBA,0x0386,0x1FB9,0x1FB8,0x1F08,0x1F09,0x1FBC,
+  0x1FC8,0x0388,0x1F18,0x1F19,0x1FCA,0x0389,0x1F28,0x1F29,
+  0x1FCC,0x1FDA,0x038A,0x1FD9,0x1FD8,0x03AA,0x1F38,0x1F39,
+  0x1FF8,0x038C,0x1F48,0x1F49,0x1FEC,0x1FEA,0x038E,0x1FE9,
+  0x1FE8,0x03AB,0x1F59,0x1FFA,0x038F,0x1F68,0x1F69,0x1FFC,
+  0x1FB4,0x1FC4,0x1F70,0x03AC,0x1FB1,0x1FB0,0x1F00,0x1F01,
+  0x1FB6,0x1FB3,0x1F72,0x03AD,0x1F10,0x1F11,0x1F74,0x03AE,
+  0x1F20,0x1F21,0x1FC6,0x1FC3,0x1F76,0x03AF,0x1FD1,0x1FD0,
+  0x03CA,0x1F30,0x1F31,0x1FD6,0x1F78,0x03CC,0x1F40,0x1F41,
+  0x1FE4,0x1FE5,0x1F7A,0x03CD,0x1FE1,0x1FE0,0x03CB,0x1F50,
+  0x1F51,0x1FE6,0x1F7C,0x03CE,0x1F60,0x1F61,0x1FF6,0x1FF3,
+  0x1FD2,0x0390,0x1FD7,0x1FE2,0x03B0,0x1FE7,0x1FF4,0x03D3,
+  0x03D4,0x0407,0x04D0,0x04D2,0x0403,0x0400,0x04D6,0x0401,
+  0x04C1,0x04DC,0x04DE,0x040D,0x04E2,0x0419,0x04E4,0x040C,
+  0x04E6,0x04EE,0x040E,0x04F0,0x04F2,0x04F4,0x04F8,0x04EC,
+  0x04D1,0x04D3,0x0453,0x0450,0x04D7,0x0451,0x04C2,0x04DD,
+  0x04DF,0x045D,0x04E3,0x0439,0x04E5,0x045C,0x04E7,0x04EF,
+  0x045E,0x04F1,0x04F3,0x04F5,0x04F9,0x04ED,0x0457,0x0476,
+  0x0477,0x04DA,0x04DB,0x04EA,0x04EB,0x0622,0x0623,0x0625,
+  0x0624,0x0626,0x06C2,0x06D3,0x06C0,0x0929,0x0931,0x0934,
+  0x09CB,0x09CC,0x0B4B,0x0B48,0x0B4C,0x0B94,0x0BCA,0x0BCC,
+  0x0BCB,0x0C48,0x0CC0,0x0CCA,0x0CC7,0x0CC8,0x0CCB,0x0D4A,
+  0x0D4C,0x0D4B,0x0DDA,0x0DDC,0x0DDE,0x0DDD,0x1026,0x1B06,
+  0x1B08,0x1B0A,0x1B0C,0x1B0E,0x1B12,0x1B3B,0x1B3D,0x1B40,
+  0x1B41,0x1B43,0x1E38,0x1E39,0x1E5C,0x1E5D,0x1E68,0x1E69,
+  0x1EAC,0x1EB6,0x1EAD,0x1EB7,0x1EC6,0x1EC7,0x1ED8,0x1ED9,
+  0x1F02,0x1F04,0x1F06,0x1F80,0x1F03,0x1F05,0x1F07,0x1F81,
+  0x1F82,0x1F83,0x1F84,0x1F85,0x1F86,0x1F87,0x1F0A,0x1F0C,
+  0x1F0E,0x1F88,0x1F0B,0x1F0D,0x1F0F,0x1F89,0x1F8A,0x1F8B,
+  0x1F8C,0x1F8D,0x1F8E,0x1F8F,0x1F12,0x1F14,0x1F13,0x1F15,
+  0x1F1A,0x1F1C,0x1F1B,0x1F1D,0x1F22,0x1F24,0x1F26,0x1F90,
+  0x1F23,0x1F25,0x1F27,0x1F91,0x1F92,0x1F93,0x1F94,0x1F95,
+  0x1F96,0x1F97,0x1F2A,0x1F2C,0x1F2E,0x1F98,0x1F2B,0x1F2D,
+  0x1F2F,0x1F99,0x1F9A,0x1F9B,0x1F9C,0x1F9D,0x1F9E,0x1F9F,
+  0x1F32,0x1F34,0x1F36,0x1F33,0x1F35,0x1F37,0x1F3A,0x1F3C,
+  0x1F3E,0x1F3B,0x1F3D,0x1F3F,0x1F42,0x1F44,0x1F43,0x1F45,
+  0x1F4A,0x1F4C,0x1F4B,0x1F4D,0x1F52,0x1F54,0x1F56,0x1F53,
+  0x1F55,0x1F57,0x1F5B,0x1F5D,0x1F5F,0x1F62,0x1F64,0x1F66,
+  0x1FA0,0x1F63,0x1F65,0x1F67,0x1FA1,0x1FA2,0x1FA3,0x1FA4,
+  0x1FA5,0x1FA6,0x1FA7,0x1F6A,0x1F6C,0x1F6E,0x1FA8,0x1F6B,
+  0x1F6D,0x1F6F,0x1FA9,0x1FAA,0x1FAB,0x1FAC,0x1FAD,0x1FAE,
+  0x1FAF,0x1FB2,0x1FC2,0x1FF2,0x1FB7,0x1FCD,0x1FCE,0x1FCF,
+  0x1FC7,0x1FF7,0x1FDD,0x1FDE,0x1FDF,0x219A,0x219B,0x21AE,
+  0x21CD,0x21CF,0x21CE,0x2204,0x2209,0x220C,0x2224,0x2226,
+  0x2241,0x2244,0x2247,0x2249,0x226D,0x2262,0x2270,0x2271,
+  0x2274,0x2275,0x2278,0x2279,0x2280,0x2281,0x22E0,0x22E1,
+  0x2284,0x2285,0x2288,0x2289,0x22E2,0x22E3,0x22AC,0x22AD,
+  0x22AE,0x22AF,0x22EA,0x22EB,0x22EC,0x22ED,0x3094,0x304C,
+  0x304E,0x3050,0x3052,0x3054,0x3056,0x3058,0x305A,0x305C,
+  0x305E,0x3060,0x3062,0x3065,0x3067,0x3069,0x3070,0x3071,
+  0x3073,0x3074,0x3076,0x3077,0x3079,0x307A,0x307C,0x307D,
+  0x309E,0x30F4,0x30AC,0x30AE,0x30B0,0x30B2,0x30B4,0x30B6,
+  0x30B8,0x30BA,0x30BC,0x30BE,0x30C0,0x30C2,0x30C5,0x30C7,
+  0x30C9,0x30D0,0x30D1,0x30D3,0x30D4,0x30D6,0x30D7,0x30D9,
+  0x30DA,0x30DC,0x30DD,0x30F7,0x30F8,0x30F9,0x30FA,0x30FE,
+  0x1109A,0x1109C,0x110AB,0x1112E,0x1112F,0x1134B,0x1134C,0x114BC,
+  0x114BB,0x114BE,0x115BA,0x115BB,0x11938,
+};
+
+} // namespace dmitigr::str::ucd
+
+#endif  // DMITIGR_STR_UCD_NORMALIZATION_HPP
@@ -0,0 +1,249 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_URL_HPP
+#define DMITIGR_STR_URL_HPP
+
+#include "byte_set.hpp"
+#include "exceptions.hpp"
+#include "numeric.hpp"
+#include "simd.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace dmitigr::str {
+
+// -----------------------------------------------------------------------------
+// Percent-encoding
+// -----------------------------------------------------------------------------
+
+/// The unreserved characters of URL (RFC 3986), which are never encoded.
+inline constexpr Byte_set url_unreserved_set{
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-._~"};
+
+/// The set of bytes to encode in URL component (all but unreserved ones).
+inline constexpr Byte_set url_component_encode_set{url_unreserved_set.complement()};
+
+/**
+ * @brief The set of bytes to encode in URL path (all but unreserved ones,
+ * sub-delimiters, `/`, `:` and `@`).
+ */
+inline constexpr Byte_set url_path_encode_set{[]
+{
+  auto result = url_component_encode_set;
+  for (const auto ch : std::string_view{"!$&'()*+,;=/:@"})
+    result.erase(static_cast<unsigned char>(ch));
+  return result;
+}()};
+
+namespace detail {
+
+/**
+ * @returns The pointer to the first byte of `[b, e)` which is not contained
+ * in `url_unreserved_set`, or `e` if there is no such a byte.
+ *
+ * @details The SSE2 implementation tests 16 bytes at once against the ranges
+ * of ASCII letters and digits and the marks "-._~".
+ */
+inline const char* find_non_url_unreserved(const char* b, const char* const e) noexcept
+{
+#ifdef DMITIGR_STR_SSE2
+  // (ch - first) as unsigned < count is emulated by signed compare of the
+  // biased value.
+  const auto in_range = [](const __m128i block, const char first,
+    const char count) noexcept
+  {
+    return _mm_cmplt_epi8(_mm_sub_epi8(block, _mm_set1_epi8(
+          static_cast<char>(first + 0x80))), _mm_set1_epi8(
+          static_cast<char>(-0x80 + count)));
+  };
+  for (; e - b >= 16; b += 16) {
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+    const __m128i alnum = _mm_or_si128(in_range(block, '0', 10),
+      in_range(_mm_or_si128(block, _mm_set1_epi8(0x20)), 'a', 26));
+    const __m128i marks = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('-')),
+        _mm_cmpeq_epi8(block, _mm_set1_epi8('.'))),
+      _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('_')),
+        _mm_cmpeq_epi8(block, _mm_set1_epi8('~'))));
+    if (const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(
+          _mm_or_si128(alnum, marks))) ^ 0xffff)
+      return b + ctz(mask);
+  }
+#endif
+  while (b != e && url_unreserved_set.contains(static_cast<unsigned char>(*b)))
+    ++b;
+  return b;
+}
+
+} // namespace detail
+
+/// @returns The maximum size of the result of percent_encode() of `size` bytes.
+constexpr std::size_t percent_encoded_max_size(const std::size_t size) noexcept
+{
+  return size * 3;
+}
+
+/**
+ * @brief Writes `str` with the bytes of `set` percent-encoded (as `%XX`) to
+ * `out`.
+ *
+ * @details If `is_form`, the space is encoded as `+` (as in the
+ * `application/x-www-form-urlencoded` format), so `set` should contain both
+ * the space and `+`. If `set` doesn't contain the unreserved characters, the
+ * runs of them are found by the vectorized class test and copied at once,
+ * and only the remaining bytes are checked against `set`.
+ *
+ * @returns The number of bytes written.
+ *
+ * @par Requires
+ * `out` has space for `percent_encoded_max_size(str.size())` bytes.
+ */
+inline std::size_t percent_encode(const std::string_view str, char* const out,
+  const Byte_set& set = url_component_encode_set,
+  const bool is_form = false) noexcept
+{
+  const bool is_unreserved_skipped{!set.intersects(url_unreserved_set)};
+  const char* p{str.data()};
+  const char* const e{p + str.size()};
+  char* o{out};
+  while (p != e) {
+    const auto* const s = is_unreserved_skipped ?
+      detail::find_non_url_unreserved(p, e) : p;
+    if (s != p) {
+      std::memcpy(o, p, static_cast<std::size_t>(s - p));
+      o += s - p;
+      p = s;
+      if (p == e)
+        break;
+    }
+
+    const auto ch = static_cast<unsigned char>(*p++);
+    if (is_form && ch == ' ')
+      *o++ = '+';
+    else if (set.contains(ch)) {
+      o[0] = '%';
+      o[1] = detail::upper_hex_digits[ch >> 4];
+      o[2] = detail::upper_hex_digits[ch & 0xF];
+      o += 3;
+    } else
+      *o++ = static_cast<char>(ch);
+  }
+  return static_cast<std::size_t>(o - out);
+}
+
+/// @returns `str` with the bytes of `set` percent-encoded.
+inline std::string to_percent_encoded(const std::string_view str,
+  const Byte_set& set = url_component_encode_set, const bool is_form = false)
+{
+  std::string result(percent_encoded_max_size(str.size()), '\0');
+  result.resize(percent_encode(str, result.data(), set, is_form));
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+// Percent-decoding
+// -----------------------------------------------------------------------------
+
+/// The result of percent_decode().
+struct Percent_decoding final {
+  /// The value of `error_position` if there is no error.
+  static constexpr auto npos = static_cast<std::size_t>(-1);
+
+  /// The number of bytes written.
+  std::size_t size{};
+
+  /// The position of the invalid `%` sequence in the input, if any.
+  std::size_t error_position{npos};
+
+  /// @returns `true` if the input is valid.
+  explicit operator bool() const noexcept
+  {
+    return error_position == npos;
+  }
+};
+
+/**
+ * @brief Writes `str` with the percent-encoded bytes (`%XX`) decoded, and with
+ * `+` replaced by the space if `is_form`, to `out`.
+ *
+ * @details The runs of bytes without `%` (and `+`) are found by the vectorized
+ * search and copied at once. The decoding stops at the `%` which is not
+ * followed by two hexadecimal digits.
+ *
+ * @returns The number of bytes written and the position of the invalid `%`
+ * sequence, if any.
+ *
+ * @par Requires
+ * `out` has space for `str.size()` bytes.
+ */
+inline Percent_decoding percent_decode(const std::string_view str,
+  char* const out, const bool is_form = false) noexcept
+{
+  const char* const b{str.data()};
+  const char* p{b};
+  const char* const e{p + str.size()};
+  char* o{out};
+  while (true) {
+    const auto* const s = detail::find_any_byte(p, e, "%+", is_form ? 2 : 1);
+    if (s != p) {
+      std::memcpy(o, p, static_cast<std::size_t>(s - p));
+      o += s - p;
+    }
+    if (s == e)
+      break;
+    else if (*s == '+') {
+      *o++ = ' ';
+      p = s + 1;
+      continue;
+    }
+
+    const auto hi = e - s > 2 ? detail::hex_digit_value(s[1]) : 16;
+    const auto lo = e - s > 2 ? detail::hex_digit_value(s[2]) : 16;
+    if (hi > 15 || lo > 15)
+      return {static_cast<std::size_t>(o - out), static_cast<std::size_t>(s - b)};
+    *o++ = static_cast<char>(hi << 4 | lo);
+    p = s + 3;
+  }
+  return {static_cast<std::size_t>(o - out)};
+}
+
+/**
+ * @returns `str` with the percent-encoded bytes decoded.
+ *
+ * @throws Exception if `str` contains the invalid `%` sequence.
+ *
+ * @see percent_decode().
+ */
+inline std::string to_percent_decoded(const std::string_view str,
+  const bool is_form = false)
+{
+  std::string result(str.size(), '\0');
+  const auto decoding = percent_decode(str, result.data(), is_form);
+  if (!decoding)
+    throw Exception{"cannot decode invalid percent-encoded sequence at position "
+      + std::to_string(decoding.error_position)};
+  result.resize(decoding.size);
+  return result;
+}
+
+} // namespace dmitigr::str
+
+#endif  // DMITIGR_STR_URL_HPP
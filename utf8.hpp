@@ -0,0 +1,388 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_UTF8_HPP
+#define DMITIGR_STR_UTF8_HPP
+
+#include "basics.hpp"
+#include "numeric.hpp"
+#include "simd.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dmitigr::str::utf8 {
+
+// -----------------------------------------------------------------------------
+// Code points
+// -----------------------------------------------------------------------------
+
+/// The code point which is used in place of invalid sequences.
+constexpr char32_t replacement_character{0xFFFD};
+
+/**
+ * @brief Decodes the code point at `p` and advances `p` past it.
+ *
+ * @par Requires
+ * `p < e`.
+ *
+ * @returns The decoded code point, or `replacement_character` if the sequence
+ * at `p` is invalid, in which case `p` is advanced by one byte.
+ */
+inline char32_t decode(const char*& p, const char* const e) noexcept
+{
+  const auto b0 = static_cast<unsigned char>(*p);
+  if (b0 < 0x80) {
+    ++p;
+    return b0;
+  }
+
+  std::size_t size;
+  char32_t result;
+  char32_t min;
+  if ((b0 & 0xE0) == 0xC0) {
+    size = 2;
+    result = b0 & 0x1F;
+    min = 0x80;
+  } else if ((b0 & 0xF0) == 0xE0) {
+    size = 3;
+    result = b0 & 0x0F;
+    min = 0x800;
+  } else if ((b0 & 0xF8) == 0xF0) {
+    size = 4;
+    result = b0 & 0x07;
+    min = 0x10000;
+  } else {
+    ++p;
+    return replacement_character;
+  }
+
+  if (static_cast<std::size_t>(e - p) < size) {
+    ++p;
+    return replacement_character;
+  }
+  for (std::size_t i = 1; i < size; ++i) {
+    const auto b = static_cast<unsigned char>(p[i]);
+    if ((b & 0xC0) != 0x80) {
+      ++p;
+      return replacement_character;
+    }
+    result = (result << 6) | (b & 0x3F);
+  }
+  if (result < min || result > 0x10FFFF || (result >= 0xD800 && result <= 0xDFFF)) {
+    ++p;
+    return replacement_character;
+  }
+  p += size;
+  return result;
+}
+
+/// @returns The number of bytes required to encode `cp`.
+constexpr std::size_t encoded_size(const char32_t cp) noexcept
+{
+  return cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+}
+
+/**
+ * @brief Encodes `cp` into `out`.
+ *
+ * @par Requires
+ * `cp <= 0x10FFFF` and `out` has space for `encoded_size(cp)` bytes.
+ *
+ * @returns The number of bytes written.
+ */
+inline std::size_t encode(const char32_t cp, char* const out) noexcept
+{
+  if (cp < 0x80) {
+    out[0] = static_cast<char>(cp);
+    return 1;
+  } else if (cp < 0x800) {
+    out[0] = static_cast<char>(0xC0 | (cp >> 6));
+    out[1] = static_cast<char>(0x80 | (cp & 0x3F));
+    return 2;
+  } else if (cp < 0x10000) {
+    out[0] = static_cast<char>(0xE0 | (cp >> 12));
+    out[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+    out[2] = static_cast<char>(0x80 | (cp & 0x3F));
+    return 3;
+  } else {
+    out[0] = static_cast<char>(0xF0 | (cp >> 18));
+    out[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+    out[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+    out[3] = static_cast<char>(0x80 | (cp & 0x3F));
+    return 4;
+  }
+}
+
+/// Appends the encoded `cp` to `str`.
+inline void append(std::string& str, const char32_t cp)
+{
+  char buf[4];
+  str.append(buf, encode(cp, buf));
+}
+
+namespace detail {
+
+/**
+ * @returns The code point of the escape sequence `\uXXXX`, or of
+ * `\UXXXXXXXX` if `digit_count == 8`, whose digits are at `p`, or
+ * `std::nullopt` if the digits are invalid. Advances `p` past the sequence.
+ *
+ * @details The high surrogate which is followed by the escape sequence
+ * `\uXXXX` of the low surrogate is combined with it into the code point of
+ * the pair. The unpaired surrogates are returned as is.
+ */
+inline std::optional<char32_t> read_unicode_escape(const char*& p,
+  const char* const e, const int digit_count = 4) noexcept
+{
+  const auto high = str::detail::read_hex_digits(p, e, digit_count);
+  if (!high || !(*high >= 0xD800 && *high <= 0xDBFF)
+    || !(e - p >= 2 && p[0] == '\\' && p[1] == 'u'))
+    return high;
+
+  const char* s{p + 2};
+  const auto low = str::detail::read_hex_digits(s, e, 4);
+  if (!low)
+    return std::nullopt;
+  else if (!(*low >= 0xDC00 && *low <= 0xDFFF))
+    return high;
+  p = s;
+  return 0x10000 + ((*high - 0xD800) << 10) + (*low - 0xDC00);
+}
+
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+// White space
+// -----------------------------------------------------------------------------
+
+/// @returns `true` if `cp` has the Unicode property White_Space.
+constexpr bool is_space(const char32_t cp) noexcept
+{
+  if (cp < 0x80)
+    return str::detail::is_ascii_space(static_cast<unsigned char>(cp));
+  switch (cp) {
+  case 0x0085: case 0x00A0: case 0x1680:
+  case 0x2028: case 0x2029: case 0x202F: case 0x205F: case 0x3000:
+    return true;
+  default:
+    return cp >= 0x2000 && cp <= 0x200A;
+  }
+}
+
+namespace detail {
+
+/*
+ * Non-ASCII white space characters are encoded in UTF-8 by the sequences
+ * which start with the bytes 0xC2, 0xE1, 0xE2 and 0xE3 only. This table maps
+ * each byte to the length of the sequence which may encode a white space
+ * character, or to zero otherwise.
+ */
+constexpr unsigned char space_lead_size[256] = {
+  // 0x00 - 0x7F are handled without this table.
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,3,3,3,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+} // namespace detail
+
+/**
+ * @returns The size in bytes of the white space character which starts at
+ * `p`, or `0` if there is no white space character at `p`.
+ *
+ * @par Requires
+ * `p < e`.
+ */
+inline std::size_t space_size(const char* const p, const char* const e) noexcept
+{
+  const auto b0 = static_cast<unsigned char>(*p);
+  if (b0 < 0x80)
+    return str::detail::is_ascii_space(b0);
+
+  const std::size_t size = detail::space_lead_size[b0];
+  if (!size || static_cast<std::size_t>(e - p) < size)
+    return 0;
+  const char* i = p;
+  const auto cp = decode(i, e);
+  return static_cast<std::size_t>(i - p) == size && is_space(cp) ? size : 0;
+}
+
+/**
+ * @returns The size in bytes of the white space character which ends at `e`,
+ * or `0` if there is no white space character ending at `e`.
+ *
+ * @par Requires
+ * `b < e`.
+ */
+inline std::size_t rspace_size(const char* const b, const char* const e) noexcept
+{
+  const auto last = static_cast<unsigned char>(*(e - 1));
+  if (last < 0x80)
+    return str::detail::is_ascii_space(last);
+
+  // Non-ASCII white spaces are 2 or 3 bytes long.
+  for (std::size_t size = 2; size <= 3 && size <= static_cast<std::size_t>(e - b);
+       ++size) {
+    if (detail::space_lead_size[static_cast<unsigned char>(*(e - size))] == size)
+      return space_size(e - size, e) == size ? size : 0;
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Predicates
+// -----------------------------------------------------------------------------
+
+/**
+ * @returns The pointer to the first character in `[b, e)` which is not a
+ * Unicode white space.
+ */
+inline const char* find_non_space(const char* b, const char* const e) noexcept
+{
+  while (true) {
+    b = str::detail::find_non_ascii_space(b, e);
+    if (b == e)
+      return b;
+    else if (const auto size = space_size(b, e))
+      b += size;
+    else
+      return b;
+  }
+}
+
+/**
+ * @returns The pointer past the last character in `[b, e)` which is not a
+ * Unicode white space, or `b` if there is no such a character.
+ */
+inline const char* rfind_non_space(const char* const b, const char* e) noexcept
+{
+  while (true) {
+    e = str::detail::rfind_non_ascii_space(b, e);
+    if (e == b)
+      return e;
+    else if (const auto size = rspace_size(b, e))
+      e -= size;
+    else
+      return e;
+  }
+}
+
+/// @returns `true` if `str` consists of Unicode white space characters only.
+inline bool is_blank(const std::string_view str) noexcept
+{
+  const auto e = str.data() + str.size();
+  return find_non_space(str.data(), e) == e;
+}
+
+/// @returns `true` if `str` has at least one Unicode white space character.
+inline bool has_space(const std::string_view str) noexcept
+{
+  const char* p = str.data();
+  const char* const e = p + str.size();
+  while (true) {
+    // Skip the runs of ASCII characters which are not white spaces.
+    p = str::detail::find_ascii_space_or_non_ascii(p, e);
+    if (p == e)
+      return false;
+    else if (space_size(p, e))
+      return true;
+    (void)decode(p, e);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Trimming
+// -----------------------------------------------------------------------------
+
+/// @returns The view of `str` without Unicode white spaces according to `tr`.
+inline std::string_view trimmed(const std::string_view str,
+  const Trim tr = Trim::all) noexcept
+{
+  const char* b = str.data();
+  const char* e = b + str.size();
+  if (static_cast<bool>(tr & Trim::lhs))
+    b = find_non_space(b, e);
+  if (static_cast<bool>(tr & Trim::rhs))
+    e = rfind_non_space(b, e);
+  return str.substr(static_cast<std::size_t>(b - str.data()),
+    static_cast<std::size_t>(e - b));
+}
+
+/// Trims Unicode white spaces of `str` according to `tr`.
+inline void trim(std::string& str, const Trim tr = Trim::all)
+{
+  const auto view = trimmed(std::string_view{str}, tr);
+  if (view.size() != str.size()) {
+    const auto offset = static_cast<std::size_t>(view.data() - str.data());
+    if (offset)
+      str.erase(0, offset);
+    str.resize(view.size());
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Splitting
+// -----------------------------------------------------------------------------
+
+/**
+ * @brief Splits the `input` string into the parts separated by the runs of
+ * Unicode white space characters.
+ *
+ * @details Unlike str::to_vector(), leading, trailing and repeated separators
+ * don't produce empty parts.
+ *
+ * @returns The vector of splitted parts.
+ */
+template<class S = std::string>
+std::vector<S> to_vector(const std::string_view input)
+{
+  std::vector<S> result;
+  const char* p = input.data();
+  const char* const e = p + input.size();
+  while (true) {
+    p = find_non_space(p, e);
+    if (p == e)
+      break;
+
+    const char* const b = p;
+    while (p != e) {
+      const auto ch = static_cast<unsigned char>(*p);
+      if (ch < 0x80) {
+        if (str::detail::is_ascii_space(ch))
+          break;
+        ++p;
+      } else if (space_size(p, e))
+        break;
+      else
+        (void)decode(p, e);
+    }
+    result.push_back(S{std::string_view{b, static_cast<std::size_t>(p - b)}});
+  }
+  return result;
+}
+
+} // namespace dmitigr::str::utf8
+
+#endif  // DMITIGR_STR_UTF8_HPP
@@ -0,0 +1,479 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_UTF8_CASE_HPP
+#define DMITIGR_STR_UTF8_CASE_HPP
+
+#include "simd.hpp"
+#include "ucd_case.hpp"
+#include "utf8.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace dmitigr::str::utf8 {
+
+// -----------------------------------------------------------------------------
+// Code points
+// -----------------------------------------------------------------------------
+
+namespace detail {
+
+/// Denotes a case mapping.
+enum class Case_mapping { lower, upper, fold };
+
+/// @returns The record of simple case mappings of `cp`.
+inline const ucd::Case_record& case_record(const char32_t cp) noexcept
+{
+  if (cp >= ucd::case_limit)
+    return ucd::case_records[0];
+  constexpr char32_t mask{(1 << ucd::case_block_shift) - 1};
+  const std::size_t block = ucd::case_stage1[cp >> ucd::case_block_shift];
+  return ucd::case_records[
+    ucd::case_stage2[(block << ucd::case_block_shift) + (cp & mask)]];
+}
+
+/// @returns The simple case mapping `M` of `cp`.
+template<Case_mapping M>
+char32_t to_case(const char32_t cp) noexcept
+{
+  const auto& record = case_record(cp);
+  if constexpr (M == Case_mapping::lower)
+    return static_cast<char32_t>(static_cast<std::int32_t>(cp) + record.lower);
+  else if constexpr (M == Case_mapping::upper)
+    return static_cast<char32_t>(static_cast<std::int32_t>(cp) + record.upper);
+  else
+    return static_cast<char32_t>(static_cast<std::int32_t>(cp) + record.fold);
+}
+
+/// @returns `true` if the invalid sequence was decoded from `[b, e)`.
+inline bool is_invalid(const char* const b, const char* const e,
+  const char32_t cp) noexcept
+{
+  return cp == replacement_character && e - b == 1;
+}
+
+} // namespace detail
+
+/// @returns The simple lowercase mapping of `cp`.
+inline char32_t to_lowercase(const char32_t cp) noexcept
+{
+  return detail::to_case<detail::Case_mapping::lower>(cp);
+}
+
+/// @returns The simple uppercase mapping of `cp`.
+inline char32_t to_uppercase(const char32_t cp) noexcept
+{
+  return detail::to_case<detail::Case_mapping::upper>(cp);
+}
+
+/// @returns The simple case folding of `cp`.
+inline char32_t to_casefolded(const char32_t cp) noexcept
+{
+  return detail::to_case<detail::Case_mapping::fold>(cp);
+}
+
+// -----------------------------------------------------------------------------
+// Strings
+// -----------------------------------------------------------------------------
+
+namespace detail {
+
+template<Case_mapping M>
+std::size_t mapped_size(const std::string_view str) noexcept
+{
+  std::size_t result{str.size()};
+  const char* p = str.data();
+  const char* const e = p + str.size();
+  while (true) {
+    p = str::detail::find_non_ascii(p, e);
+    if (p == e)
+      break;
+
+    const char* const b = p;
+    const auto cp = decode(p, e);
+    if (!is_invalid(b, p, cp))
+      result = result - encoded_size(cp) + encoded_size(to_case<M>(cp));
+  }
+  return result;
+}
+
+template<Case_mapping M>
+std::size_t map(char* const out, const std::string_view str) noexcept
+{
+  constexpr bool is_upper = M == Case_mapping::upper;
+  char* o = out;
+  const char* p = str.data();
+  const char* const e = p + str.size();
+  while (true) {
+    const char* const a = str::detail::ascii_to_case<is_upper>(p, e, o);
+    o += a - p;
+    p = a;
+    if (p == e)
+      break;
+
+    const char* const b = p;
+    const auto cp = decode(p, e);
+    if (!is_invalid(b, p, cp))
+      o += encode(to_case<M>(cp), o);
+    else
+      *o++ = *b;
+  }
+  return static_cast<std::size_t>(o - out);
+}
+
+template<Case_mapping M>
+void map(std::string& str)
+{
+  constexpr bool is_upper = M == Case_mapping::upper;
+  const char* const b = str.data();
+  const char* const e = b + str.size();
+  const auto a = str::detail::ascii_to_case<is_upper>(b, e, str.data());
+  if (a != e) {
+    const auto offset = static_cast<std::size_t>(a - b);
+    const std::string_view tail{a, static_cast<std::size_t>(e - a)};
+    std::string result(offset + mapped_size<M>(tail), '\0');
+    std::copy(b, a, result.data());
+    map<M>(result.data() + offset, tail);
+    str.swap(result);
+  }
+}
+
+} // namespace detail
+
+/**
+ * @returns The exact size in bytes of the result of the call of
+ * `lowercase(out, str)`.
+ */
+inline std::size_t lowercased_size(const std::string_view str) noexcept
+{
+  return detail::mapped_size<detail::Case_mapping::lower>(str);
+}
+
+/**
+ * @brief Writes `str` with all of the characters replaced by their simple
+ * lowercase mappings to `out`.
+ *
+ * @details Invalid UTF-8 sequences are copied as is.
+ *
+ * @par Requires
+ * `out` has space for `lowercased_size(str)` bytes.
+ *
+ * @returns The number of bytes written.
+ */
+inline std::size_t lowercase(char* const out, const std::string_view str) noexcept
+{
+  return detail::map<detail::Case_mapping::lower>(out, str);
+}
+
+/// @overload
+inline void lowercase(std::string& str)
+{
+  detail::map<detail::Case_mapping::lower>(str);
+}
+
+/// @returns The lowercased copy of `str`.
+inline std::string to_lowercase(const std::string_view str)
+{
+  std::string result(lowercased_size(str), '\0');
+  lowercase(result.data(), str);
+  return result;
+}
+
+/**
+ * @returns The exact size in bytes of the result of the call of
+ * `uppercase(out, str)`.
+ */
+inline std::size_t uppercased_size(const std::string_view str) noexcept
+{
+  return detail::mapped_size<detail::Case_mapping::upper>(str);
+}
+
+/**
+ * @brief Writes `str` with all of the characters replaced by their simple
+ * uppercase mappings to `out`.
+ *
+ * @details Invalid UTF-8 sequences are copied as is.
+ *
+ * @par Requires
+ * `out` has space for `uppercased_size(str)` bytes.
+ *
+ * @returns The number of bytes written.
+ */
+inline std::size_t uppercase(char* const out, const std::string_view str) noexcept
+{
+  return detail::map<detail::Case_mapping::upper>(out, str);
+}
+
+/// @overload
+inline void uppercase(std::string& str)
+{
+  detail::map<detail::Case_mapping::upper>(str);
+}
+
+/// @returns The uppercased copy of `str`.
+inline std::string to_uppercase(const std::string_view str)
+{
+  std::string result(uppercased_size(str), '\0');
+  uppercase(result.data(), str);
+  return result;
+}
+
+/**
+ * @returns The exact size in bytes of the result of the call of
+ * `casefold(out, str)`.
+ */
+inline std::size_t casefolded_size(const std::string_view str) noexcept
+{
+  return detail::mapped_size<detail::Case_mapping::fold>(str);
+}
+
+/**
+ * @brief Writes `str` with all of the characters replaced by their simple
+ * case foldings to `out`.
+ *
+ * @details Invalid UTF-8 sequences are copied as is.
+ *
+ * @par Requires
+ * `out` has space for `casefolded_size(str)` bytes.
+ *
+ * @returns The number of bytes written.
+ */
+inline std::size_t casefold(char* const out, const std::string_view str) noexcept
+{
+  return detail::map<detail::Case_mapping::fold>(out, str);
+}
+
+/// @overload
+inline void casefold(std::string& str)
+{
+  detail::map<detail::Case_mapping::fold>(str);
+}
+
+/// @returns The case folded copy of `str`.
+inline std::string to_casefolded(const std::string_view str)
+{
+  std::string result(casefolded_size(str), '\0');
+  casefold(result.data(), str);
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+// Case-insensitive comparison and hashing
+// -----------------------------------------------------------------------------
+
+namespace detail {
+
+/// The stream of bytes of the case folded string.
+class Casefold_stream final {
+public:
+  explicit Casefold_stream(const std::string_view str) noexcept
+    : p{str.data()}
+    , e{str.data() + str.size()}
+  {}
+
+  /// @returns `true` if the folded bytes of the last character are consumed.
+  bool is_drained() const noexcept
+  {
+    return pos_ == size_;
+  }
+
+  /// @returns The next byte, or `-1` at the end of stream.
+  int next() noexcept
+  {
+    if (pos_ != size_)
+      return static_cast<unsigned char>(buf_[pos_++]);
+    else if (p == e)
+      return -1;
+
+    const auto ch = static_cast<unsigned char>(*p);
+    if (ch < 0x80) {
+      ++p;
+      return static_cast<unsigned char>(
+        str::detail::ascii_to_case<false>(static_cast<char>(ch)));
+    }
+
+    const char* const b = p;
+    const auto cp = decode(p, e);
+    if (is_invalid(b, p, cp))
+      return ch;
+    size_ = static_cast<unsigned>(encode(to_casefolded(cp), buf_));
+    pos_ = 1;
+    return static_cast<unsigned char>(buf_[0]);
+  }
+
+  const char* p{};
+  const char* e{};
+
+private:
+  char buf_[4]{};
+  unsigned pos_{};
+  unsigned size_{};
+};
+
+/// The hasher of the byte stream which is independent of the chunking.
+class Stream_hasher final {
+public:
+  void append(const char* data, std::size_t size) noexcept
+  {
+    size_total_ += size;
+    if (fill_) {
+      for (; size && fill_ != 8; --size, ++data)
+        append_byte(*data);
+      if (fill_ == 8)
+        mix();
+    }
+    for (; size >= 8; size -= 8, data += 8) {
+      std::memcpy(&word_, data, 8);
+      mix();
+    }
+    for (; size; --size, ++data)
+      append_byte(*data);
+  }
+
+  std::size_t result() const noexcept
+  {
+    auto h = hash_;
+    if (fill_)
+      h = (h ^ word_) * multiplier;
+    h ^= size_total_;
+    // The finalizer of MurmurHash3.
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccd;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53;
+    h ^= h >> 33;
+    return static_cast<std::size_t>(h);
+  }
+
+private:
+  static constexpr std::uint64_t multiplier{0x9e3779b97f4a7c15};
+  std::uint64_t hash_{0xcbf29ce484222325};
+  std::uint64_t word_{};
+  std::uint64_t size_total_{};
+  unsigned fill_{};
+
+  void append_byte(const char ch) noexcept
+  {
+    word_ |= std::uint64_t{static_cast<unsigned char>(ch)} << (8 * fill_);
+    ++fill_;
+  }
+
+  void mix() noexcept
+  {
+    hash_ = (hash_ ^ word_) * multiplier;
+    hash_ ^= hash_ >> 29;
+    word_ = 0;
+    fill_ = 0;
+  }
+};
+
+} // namespace detail
+
+/**
+ * @returns The negative value, zero or the positive value if `lhs` is less
+ * than, equal to or greater than `rhs` respectively if both are case folded.
+ */
+inline int casefold_compare(const std::string_view lhs,
+  const std::string_view rhs) noexcept
+{
+  detail::Casefold_stream l{lhs};
+  detail::Casefold_stream r{rhs};
+  while (true) {
+    if (l.is_drained() && r.is_drained()) {
+      const auto n = str::detail::ascii_icase_mismatch(l.p, r.p,
+        static_cast<std::size_t>(std::min(l.e - l.p, r.e - r.p)));
+      l.p += n;
+      r.p += n;
+    }
+    const int lc = l.next();
+    const int rc = r.next();
+    if (lc != rc)
+      return lc < rc ? -1 : 1;
+    else if (lc < 0)
+      return 0;
+  }
+}
+
+/// @returns `true` if `lhs` and `rhs` are equal if both are case folded.
+inline bool is_casefold_equal(const std::string_view lhs,
+  const std::string_view rhs) noexcept
+{
+  return !casefold_compare(lhs, rhs);
+}
+
+/**
+ * @returns The hash of case folded `str`.
+ *
+ * @par Effects
+ * `casefold_hash(a) == casefold_hash(b)` if `is_casefold_equal(a, b)`.
+ */
+inline std::size_t casefold_hash(const std::string_view str) noexcept
+{
+  detail::Stream_hasher hasher;
+  char buf[64];
+  const char* p = str.data();
+  const char* const e = p + str.size();
+  while (p != e) {
+    const char* const chunk_end = p + std::min<std::ptrdiff_t>(e - p, sizeof(buf));
+    const char* const a = str::detail::ascii_to_case<false>(p, chunk_end, buf);
+    hasher.append(buf, static_cast<std::size_t>(a - p));
+    p = a;
+    if (p != chunk_end) {
+      const char* const b = p;
+      const auto cp = decode(p, e);
+      if (detail::is_invalid(b, p, cp))
+        hasher.append(b, 1);
+      else
+        hasher.append(buf, encode(to_casefolded(cp), buf));
+    }
+  }
+  return hasher.result();
+}
+
+/// The case-insensitive hash function object.
+struct Casefold_hash final {
+  std::size_t operator()(const std::string_view str) const noexcept
+  {
+    return casefold_hash(str);
+  }
+};
+
+/// The case-insensitive equality function object.
+struct Casefold_equal final {
+  bool operator()(const std::string_view lhs,
+    const std::string_view rhs) const noexcept
+  {
+    return is_casefold_equal(lhs, rhs);
+  }
+};
+
+/// The case-insensitive less function object.
+struct Casefold_less final {
+  bool operator()(const std::string_view lhs,
+    const std::string_view rhs) const noexcept
+  {
+    return casefold_compare(lhs, rhs) < 0;
+  }
+};
+
+} // namespace dmitigr::str::utf8
+
+#endif  // DMITIGR_STR_UTF8_CASE_HPP
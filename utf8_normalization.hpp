@@ -0,0 +1,439 @@
+// -*- C++ -*-
+//
+// Copyright 2023 Dmitry Igrishin
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DMITIGR_STR_UTF8_NORMALIZATION_HPP
+#define DMITIGR_STR_UTF8_NORMALIZATION_HPP
+
+#include "simd.hpp"
+#include "ucd_normalization.hpp"
+#include "utf8.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace dmitigr::str::utf8 {
+
+/// Denotes a Unicode normalization form.
+enum class Normalization_form {
+  /// Canonical Decomposition, followed by Canonical Composition.
+  nfc = 1,
+  /// Canonical Decomposition.
+  nfd
+};
+
+/// Denotes a result of the normalization quick check.
+enum class Quick_check {
+  yes = 1,
+  no,
+  maybe
+};
+
+namespace detail {
+
+// -----------------------------------------------------------------------------
+// Hangul
+// -----------------------------------------------------------------------------
+
+constexpr char32_t hangul_s_base{0xAC00};
+constexpr char32_t hangul_l_base{0x1100};
+constexpr char32_t hangul_v_base{0x1161};
+constexpr char32_t hangul_t_base{0x11A7};
+constexpr char32_t hangul_l_count{19};
+constexpr char32_t hangul_v_count{21};
+constexpr char32_t hangul_t_count{28};
+constexpr char32_t hangul_n_count{hangul_v_count * hangul_t_count};
+constexpr char32_t hangul_s_count{hangul_l_count * hangul_n_count};
+
+// -----------------------------------------------------------------------------
+// Properties
+// -----------------------------------------------------------------------------
+
+/// @returns The normalization properties of `cp`.
+inline const ucd::Normalization_record& normalization_record(
+  const char32_t cp) noexcept
+{
+  if (cp >= ucd::normalization_limit)
+    return ucd::normalization_records[0];
+  constexpr char32_t mask{(1 << ucd::normalization_block_shift) - 1};
+  const std::size_t block =
+    ucd::normalization_stage1[cp >> ucd::normalization_block_shift];
+  return ucd::normalization_records[ucd::normalization_stage2[
+      (block << ucd::normalization_block_shift) + (cp & mask)]];
+}
+
+/// @returns The canonical combining class of `cp`.
+inline std::uint8_t ccc(const char32_t cp) noexcept
+{
+  return normalization_record(cp).ccc;
+}
+
+/// @returns The quick check property of `cp` for the normalization `form`.
+inline Quick_check quick_check(const char32_t cp,
+  const Normalization_form form) noexcept
+{
+  const auto flags = normalization_record(cp).flags;
+  if (form == Normalization_form::nfd)
+    return flags & ucd::nfd_no ? Quick_check::no : Quick_check::yes;
+  else if (flags & ucd::nfc_no)
+    return Quick_check::no;
+  else if (flags & ucd::nfc_maybe)
+    return Quick_check::maybe;
+  else
+    return Quick_check::yes;
+}
+
+/**
+ * @returns `true` if the normalization of the text before `cp` is independent
+ * of the text starting from `cp` for the normalization `form`.
+ */
+inline bool is_boundary(const char32_t cp, const Normalization_form form) noexcept
+{
+  const auto& record = normalization_record(cp);
+  const auto no = form == Normalization_form::nfd ? ucd::nfd_no :
+    ucd::nfc_no | ucd::nfc_maybe;
+  return !record.ccc && !(record.flags & no);
+}
+
+// -----------------------------------------------------------------------------
+// Decomposition and composition
+// -----------------------------------------------------------------------------
+
+/// Appends the full canonical decomposition of `cp` to `result`.
+inline void decompose(const char32_t cp, std::vector<char32_t>& result)
+{
+  if (cp >= hangul_s_base && cp < hangul_s_base + hangul_s_count) {
+    const auto s = cp - hangul_s_base;
+    result.push_back(hangul_l_base + s / hangul_n_count);
+    result.push_back(hangul_v_base + (s % hangul_n_count) / hangul_t_count);
+    if (const auto t = s % hangul_t_count)
+      result.push_back(hangul_t_base + t);
+    return;
+  }
+
+  const auto b = std::cbegin(ucd::decomposition_keys);
+  const auto e = std::cend(ucd::decomposition_keys);
+  if (const auto i = std::lower_bound(b, e, cp); i != e && *i == cp) {
+    const auto index = i - b;
+    result.insert(result.end(),
+      ucd::decompositions + ucd::decomposition_offsets[index],
+      ucd::decompositions + ucd::decomposition_offsets[index + 1]);
+  } else
+    result.push_back(cp);
+}
+
+/// Sorts the runs of non-starters of `str` by the canonical combining class.
+inline void reorder(std::vector<char32_t>& str)
+{
+  const auto less = [](const char32_t a, const char32_t b)
+  {
+    return ccc(a) < ccc(b);
+  };
+  auto b = str.begin();
+  const auto e = str.end();
+  while (b != e) {
+    b = std::find_if(b, e, [](const char32_t cp){return ccc(cp);});
+    const auto run_end = std::find_if(b, e, [](const char32_t cp){return !ccc(cp);});
+    if (run_end - b > 1)
+      std::stable_sort(b, run_end, less);
+    b = run_end;
+  }
+}
+
+/**
+ * @returns The primary composite of `first` and `second`, or `0` if there is
+ * no such a composite.
+ */
+inline char32_t composite(const char32_t first, const char32_t second) noexcept
+{
+  if (first >= hangul_l_base && first < hangul_l_base + hangul_l_count &&
+      second >= hangul_v_base && second < hangul_v_base + hangul_v_count)
+    return hangul_s_base + ((first - hangul_l_base) * hangul_v_count
+      + (second - hangul_v_base)) * hangul_t_count;
+  else if (first >= hangul_s_base && first < hangul_s_base + hangul_s_count &&
+      !((first - hangul_s_base) % hangul_t_count) &&
+      second > hangul_t_base && second < hangul_t_base + hangul_t_count)
+    return first + (second - hangul_t_base);
+
+  const auto key = std::uint64_t{first} * 0x110000 + second;
+  const auto b = std::cbegin(ucd::composition_keys);
+  const auto e = std::cend(ucd::composition_keys);
+  if (const auto i = std::lower_bound(b, e, key); i != e && *i == key)
+    return ucd::compositions[i - b];
+  else
+    return 0;
+}
+
+/// Applies the canonical composition algorithm to `str`.
+inline void compose(std::vector<char32_t>& str)
+{
+  if (str.empty())
+    return;
+
+  std::size_t starter{};
+  bool is_starter_found = !ccc(str[0]);
+  int last_ccc = is_starter_found ? 0 : 256;
+  std::size_t out{1};
+  for (std::size_t i = 1; i < str.size(); ++i) {
+    const auto cp = str[i];
+    const int cp_ccc = ccc(cp);
+    if (is_starter_found && (!last_ccc || last_ccc < cp_ccc)) {
+      if (const auto comp = composite(str[starter], cp)) {
+        str[starter] = comp;
+        continue;
+      }
+    }
+    if (!cp_ccc) {
+      starter = out;
+      is_starter_found = true;
+    }
+    last_ccc = cp_ccc;
+    str[out++] = cp;
+  }
+  str.resize(out);
+}
+
+/**
+ * @brief Appends normalized `segment` to `result`.
+ *
+ * @param buf The working buffer.
+ */
+inline void append_normalized(std::string& result, const std::string_view segment,
+  const Normalization_form form, std::vector<char32_t>& buf)
+{
+  const auto flush = [&]
+  {
+    reorder(buf);
+    if (form == Normalization_form::nfc)
+      compose(buf);
+    for (const auto cp : buf)
+      append(result, cp);
+    buf.clear();
+  };
+
+  const char* p = segment.data();
+  const char* const e = p + segment.size();
+  while (p != e) {
+    const char* const b = p;
+    const auto cp = decode(p, e);
+    if (cp == replacement_character && p - b == 1) {
+      // Invalid sequences are copied as is.
+      flush();
+      result += *b;
+    } else
+      decompose(cp, buf);
+  }
+  flush();
+}
+
+/**
+ * @returns The position of the first byte of `str` starting from which the
+ * normalization `form` must be applied, or `str.size()` if `str` is already
+ * normalized.
+ *
+ * @param[out] qc The result of the quick check.
+ * @param[out] boundary The position of the last boundary before the result.
+ * @param is_exhaustive The indicator to continue the check after the first
+ * `Quick_check::maybe` in order to find `Quick_check::no`.
+ */
+inline std::size_t quick_check_prefix(const std::string_view str,
+  const Normalization_form form, Quick_check& qc, std::size_t& boundary,
+  const bool is_exhaustive = false) noexcept
+{
+  qc = Quick_check::yes;
+  const char* const b = str.data();
+  const char* const e = b + str.size();
+  const char* p = b;
+  const char* bp = b;
+  const char* maybe_bp{};
+  int last_ccc{};
+  while (true) {
+    const auto a = str::detail::find_non_ascii(p, e);
+    if (a != p) {
+      // The last ASCII character is a boundary.
+      bp = a - 1;
+      last_ccc = 0;
+      p = a;
+    }
+    if (p == e)
+      break;
+
+    const char* const cpb = p;
+    const auto cp = decode(p, e);
+    if (cp == replacement_character && p - cpb == 1) {
+      bp = p;
+      last_ccc = 0;
+      continue;
+    }
+
+    const int cp_ccc = ccc(cp);
+    if (cp_ccc && last_ccc > cp_ccc) {
+      qc = Quick_check::no;
+      break;
+    } else if (const auto cp_qc = quick_check(cp, form);
+      cp_qc == Quick_check::no) {
+      qc = cp_qc;
+      break;
+    } else if (cp_qc == Quick_check::maybe) {
+      if (!maybe_bp)
+        maybe_bp = bp;
+      qc = cp_qc;
+      if (!is_exhaustive)
+        break;
+    } else if (!cp_ccc)
+      bp = cpb;
+    last_ccc = cp_ccc;
+  }
+  if (maybe_bp)
+    bp = maybe_bp;
+  boundary = static_cast<std::size_t>(bp - b);
+  return qc == Quick_check::yes ? str.size() : boundary;
+}
+
+/// @returns The position of the first boundary of `str` after `pos`.
+inline std::size_t next_boundary(const std::string_view str, std::size_t pos,
+  const Normalization_form form) noexcept
+{
+  const char* const b = str.data();
+  const char* const e = b + str.size();
+  const char* p = b + pos;
+  if (p != e)
+    (void)decode(p, e);
+  while (p != e) {
+    if (static_cast<unsigned char>(*p) < 0x80)
+      break;
+    const char* const cpb = p;
+    const auto cp = decode(p, e);
+    if ((cp == replacement_character && p - cpb == 1) || is_boundary(cp, form)) {
+      p = cpb;
+      break;
+    }
+  }
+  return static_cast<std::size_t>(p - b);
+}
+
+/**
+ * @brief Normalizes `str`.
+ *
+ * @returns `true` if `result` is assigned, or `false` if `str` is already
+ * normalized.
+ */
+inline bool normalize(const std::string_view str, const Normalization_form form,
+  std::string& result)
+{
+  Quick_check qc;
+  std::size_t boundary;
+  auto pos = quick_check_prefix(str, form, qc, boundary);
+  if (pos == str.size())
+    return false;
+
+  std::vector<char32_t> buf;
+  result.clear();
+  result.reserve(str.size() + str.size() / 8);
+  result.append(str.data(), pos);
+  while (pos < str.size()) {
+    // Find the end of the segment which must be normalized.
+    std::size_t end{pos};
+    while (true) {
+      end = next_boundary(str, end, form);
+      if (end == str.size())
+        break;
+      // Stop at the boundary followed by the already normalized text.
+      const auto rest = str.substr(end);
+      const auto ok = quick_check_prefix(rest, form, qc, boundary);
+      if (ok || qc == Quick_check::yes)
+        break;
+    }
+    append_normalized(result, str.substr(pos, end - pos), form, buf);
+    if (end == str.size())
+      break;
+
+    // Copy the already normalized text as is.
+    const auto rest = str.substr(end);
+    const auto ok = quick_check_prefix(rest, form, qc, boundary);
+    result.append(rest.data(), ok);
+    pos = end + ok;
+  }
+  return true;
+}
+
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+// Normalization
+// -----------------------------------------------------------------------------
+
+/**
+ * @returns The result of the normalization quick check of `str` for the
+ * normalization `form`.
+ *
+ * @remarks `Quick_check::maybe` can be returned for `Normalization_form::nfc`
+ * only.
+ */
+inline Quick_check quick_check(const std::string_view str,
+  const Normalization_form form = Normalization_form::nfc) noexcept
+{
+  Quick_check result;
+  std::size_t boundary;
+  detail::quick_check_prefix(str, form, result, boundary, true);
+  return result;
+}
+
+/// @returns `true` if `str` is in the normalization `form`.
+inline bool is_normalized(const std::string_view str,
+  const Normalization_form form = Normalization_form::nfc)
+{
+  switch (quick_check(str, form)) {
+  case Quick_check::yes: return true;
+  case Quick_check::no: return false;
+  case Quick_check::maybe: break;
+  }
+  std::string normalized;
+  return !detail::normalize(str, form, normalized) || normalized == str;
+}
+
+/**
+ * @brief Normalizes `str` according to the normalization `form`.
+ *
+ * @details Invalid UTF-8 sequences are kept as is.
+ *
+ * @remarks No memory allocation performed if `str` is already normalized.
+ */
+inline void normalize(std::string& str,
+  const Normalization_form form = Normalization_form::nfc)
+{
+  std::string result;
+  if (detail::normalize(str, form, result))
+    str.swap(result);
+}
+
+/// @returns The copy of `str` normalized according to the normalization `form`.
+inline std::string to_normalized(const std::string_view str,
+  const Normalization_form form = Normalization_form::nfc)
+{
+  std::string result;
+  if (!detail::normalize(str, form, result))
+    result = str;
+  return result;
+}
+
+} // namespace dmitigr::str::utf8
+
+#endif  // DMITIGR_STR_UTF8_NORMALIZATION_HPP